@@ -0,0 +1,70 @@
+import os
+import sys
+sys.path.append(os.getcwd())
+import tempfile
+import numpy as np
+from trajectory_file import TrajectoryFile, HEADER, AGENT, INDEX, MAGIC, VERSION, BYTE_ORDER
+
+
+def write_trajectory(path, goals, times, positions, scalar):
+    agent_count = len(goals)
+    frame_count = len(times)
+    scalar_size = np.dtype(scalar).itemsize
+    frame_stride = (8 + 2 * agent_count * scalar_size + 7) // 8 * 8
+    frame_offset = (HEADER.itemsize + agent_count * AGENT.itemsize + 63) // 64 * 64
+    index_offset = frame_offset + frame_count * frame_stride
+
+    data = np.zeros(index_offset + frame_count * INDEX.itemsize, dtype=np.uint8)
+    header = data[:HEADER.itemsize].view(HEADER)
+    header[0] = (MAGIC, BYTE_ORDER, VERSION, scalar_size, agent_count, frame_count, frame_stride,
+                 HEADER.itemsize, frame_offset, index_offset)
+    agents = data[HEADER.itemsize:HEADER.itemsize + agent_count * AGENT.itemsize].view(AGENT)
+    for i, goal in enumerate(goals):
+        agents[i] = (i, 0) + goal
+    for k in range(frame_count):
+        offset = frame_offset + k * frame_stride
+        data[offset:offset + 8] = np.array([times[k]], dtype='<f8').view(np.uint8)
+        coordinates = np.array(positions[k], dtype=scalar).ravel().view(np.uint8)
+        data[offset + 8:offset + 8 + coordinates.size] = coordinates
+    index = data[index_offset:].view(INDEX)
+    index['time'] = times
+    index['offset'] = frame_offset + np.arange(frame_count) * frame_stride
+    data.tofile(path)
+
+
+def test_trajectory_file():
+    goals = [(2.0, 0.0, 0.3, 1.0), (0.0, 0.0, 0.3, 1.0), (1.0, 1.0, 0.5, 2.0)]
+    times = [0, 1, 2, 3]
+    positions = np.array([[(0, 0), (2, 0), (1, 2)], [(0, 1), (2, -1), (1, 1.5)],
+                          [(1, 1), (1, -1), (1, 1.25)], [(2, 0), (0, 0), (1, 1)]])
+
+    for scalar in ('<f4', '<f8'):
+        path = os.path.join(tempfile.mkdtemp(), 'test.traj')
+        write_trajectory(path, goals, times, positions, scalar)
+        traj = TrajectoryFile(path)
+
+        assert traj.positions.shape == (4, 3, 2)
+        assert traj.positions.dtype == np.dtype(scalar)
+        assert np.allclose(traj.positions, positions)
+        assert np.allclose(traj.times, times)
+        assert np.allclose(traj.frames['time'], times)
+        assert list(traj.agents['id']) == [0, 1, 2]
+        assert np.allclose(traj.agents['v_pref'], [1, 1, 2])
+        assert np.allclose(traj.positions[:, ::-1, :][1, 0], (1, 1.5))
+        assert traj.frame_at(-1) == 0
+        assert traj.frame_at(1.5) == 1
+        assert traj.frame_at(3) == 3
+
+
+def test_unfinished_file():
+    path = os.path.join(tempfile.mkdtemp(), 'test.traj')
+    write_trajectory(path, [(2.0, 0.0, 0.3, 1.0)], [0], [[(0, 0)]], '<f8')
+    data = np.fromfile(path, dtype=np.uint8)
+    data[:HEADER.itemsize].view(HEADER)['index_offset'] = 0
+    data.tofile(path)
+
+    try:
+        TrajectoryFile(path)
+        assert False
+    except ValueError as error:
+        assert 'did not close' in str(error)
@@ -20,6 +20,7 @@ from collections import defaultdict
 from model import ValueNetwork
 from env import ENV
 from utils import *
+from trajectory_file import TrajectoryFile
 
 
 def filter_velocity(joint_state, state_sequences, agent_idx):
@@ -212,7 +213,24 @@ def update_memory(duplicate_model, memory, state_sequences, reward_sequences, ga
 
 def initialize_memory(traj_dir, gamma, capacity, kinematic, device):
     memory = ReplayMemory(capacity=capacity)
-    for traj_file in os.listdir(traj_dir):
+    traj_files = os.listdir(traj_dir)
+    for traj_file in traj_files:
+        stem, extension = os.path.splitext(traj_file)
+        if extension == '.traj':
+            # binary trajectory, mapped rather than parsed
+            traj = TrajectoryFile(os.path.join(traj_dir, traj_file))
+            times = traj.times
+            positions = traj.positions
+            agents = traj.agents[['goal_x', 'goal_y', 'radius', 'v_pref']]
+            trajectory1 = Trajectory(gamma, *[float(x) for x in agents[0]], times, positions, kinematic)
+            trajectory2 = Trajectory(gamma, *[float(x) for x in agents[1]], times, positions[:, ::-1, :], kinematic)
+            generated_pairs = trajectory1.generate_state_value_pairs(device) + trajectory2.generate_state_value_pairs(device)
+            for pair in generated_pairs:
+                memory.push(pair)
+            continue
+        if stem + '.traj' in traj_files:
+            # already read from its binary conversion
+            continue
         # parse trajectory data to state-value pairs
         with open(os.path.join(traj_dir, traj_file)) as fo:
             lines=fo.readlines()
@@ -0,0 +1,69 @@
+"""
+Zero-copy reader for the binary trajectory files written by the ORCA runner
+and by ORCA/tools/trajectoryConvert (see ORCA/trajectory/trajectoryFormat.h).
+
+The file is mapped with numpy.memmap: the agents, times and positions returned
+are views into the mapping, and only the pages that are touched get read.
+
+"""
+import numpy as np
+
+MAGIC = b'ORCATRAJ'
+VERSION = 1
+BYTE_ORDER = 0x01020304
+
+HEADER = np.dtype([('magic', 'S8'), ('byte_order', '<u4'), ('version', '<u4'), ('scalar_size', '<u4'),
+                   ('agent_count', '<u4'), ('frame_count', '<u8'), ('frame_stride', '<u8'),
+                   ('agent_offset', '<u8'), ('frame_offset', '<u8'), ('index_offset', '<u8')])
+AGENT = np.dtype([('id', '<i4'), ('reserved', '<u4'), ('goal_x', '<f8'), ('goal_y', '<f8'),
+                  ('radius', '<f8'), ('v_pref', '<f8')])
+INDEX = np.dtype([('time', '<f8'), ('offset', '<u8')])
+
+
+class TrajectoryFile(object):
+    def __init__(self, path):
+        self.path = path
+        self.data = np.memmap(path, dtype=np.uint8, mode='r')
+        if self.data.size < HEADER.itemsize:
+            raise ValueError('{}: not a trajectory file'.format(path))
+
+        header = self.data[:HEADER.itemsize].view(HEADER)[0]
+        if header['magic'] != MAGIC:
+            raise ValueError('{}: not a trajectory file'.format(path))
+        if header['byte_order'] != BYTE_ORDER:
+            raise ValueError('{}: written with another byte order'.format(path))
+        if header['version'] != VERSION:
+            raise ValueError('{}: unsupported version {}'.format(path, header['version']))
+        if header['index_offset'] == 0:
+            raise ValueError('{}: the writer did not close the file'.format(path))
+
+        agent_count = int(header['agent_count'])
+        frame_count = int(header['frame_count'])
+        scalar = {4: '<f4', 8: '<f8'}[int(header['scalar_size'])]
+        frame = np.dtype({'names': ['time', 'positions'],
+                          'formats': ['<f8', (scalar, (agent_count, 2))],
+                          'offsets': [0, 8],
+                          'itemsize': int(header['frame_stride'])})
+        if int(header['index_offset']) + frame_count * INDEX.itemsize > self.data.size:
+            raise ValueError('{}: truncated or corrupted'.format(path))
+
+        self.agents = np.ndarray((agent_count,), AGENT, self.data, int(header['agent_offset']))
+        self.frames = np.ndarray((frame_count,), frame, self.data, int(header['frame_offset']))
+        self.index = np.ndarray((frame_count,), INDEX, self.data, int(header['index_offset']))
+
+    @property
+    def times(self):
+        # read from the index, so that the frames are not touched
+        return self.index['time']
+
+    @property
+    def positions(self):
+        # time steps, agents, xy coordinates
+        return self.frames['positions']
+
+    def frame_at(self, time):
+        """
+        Index of the last frame whose time is not after the given time, or 0 if they all are
+
+        """
+        return max(int(np.searchsorted(self.times, time, side='right')) - 1, 0)
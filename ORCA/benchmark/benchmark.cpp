@@ -0,0 +1,200 @@
+/**
+ * File  : benchmark.cpp
+ * Author: Raja Soufi
+ * 
+ * Implementation of the Benchmark class defined
+ * in benchmark.h.
+ */
+
+// Include header file
+#include "benchmark.h"
+
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+
+/*
+    Constructor
+*/
+
+/**
+ * Constructs a harness running the benchmarks whose
+ * full name contains FILTER, each for at least
+ * MIN_TIME seconds per repetition.
+ * 
+ * @param MIN_TIME    - The shortest time a repetition
+ *                      may last, in seconds
+ * @param REPETITIONS - The number of timed repetitions
+ * @param FILTER      - What the full name of the
+ *                      benchmarks to run must contain
+ */
+Benchmark::Benchmark(const double MIN_TIME, const size_t REPETITIONS, const std::string& FILTER) :
+    minTime_(MIN_TIME), repetitions_(std::max<size_t>(REPETITIONS, 1)), filter_(FILTER), results_()
+{}
+
+/*
+    Other methods
+*/
+
+/**
+ * Prints the results of the benchmarks run so far
+ * as a table, in nanoseconds per operation.
+ * 
+ * @param file - The file to print to
+ */
+void Benchmark::print(FILE* file) const {
+    
+    size_t width = 9;
+    for (const Result& RESULT : this->results_) {
+        width = std::max(width, Benchmark::fullName(RESULT.name, RESULT.parameters).size());
+    }
+    
+    fprintf(file, "%-*s %12s %12s %12s %12s\n", (int) width, "benchmark", "iterations",
+        "min ns/op", "median ns/op", "mean ns/op");
+    for (const Result& RESULT : this->results_) {
+        fprintf(file, "%-*s %12u %12.2f %12.2f %12.2f\n", (int) width,
+            Benchmark::fullName(RESULT.name, RESULT.parameters).c_str(), (unsigned) RESULT.iterations,
+            RESULT.minimum, RESULT.median, RESULT.mean);
+    }
+    
+}
+
+/**
+ * Writes the results of the benchmarks run so far
+ * to the JSON file with the path given as a
+ * parameter, after a description of the context in
+ * which they were run.
+ * 
+ * @param PATH    - The path of the file
+ * @param CONTEXT - The context, as (name, value) pairs
+ */
+void Benchmark::writeJson(const std::string& PATH, const Parameters& CONTEXT) const {
+    
+    std::unique_ptr<FILE, int (*)(FILE*)> file(fopen(PATH.c_str(), "w"), fclose);
+    if (!file) {
+        throw std::runtime_error(PATH + ": cannot open the file for writing");
+    }
+    
+    fprintf(file.get(), "{\n  \"context\": {");
+    for (size_t i = 0 ; i < CONTEXT.size() ; i++) {
+        fprintf(file.get(), "%s\n    \"%s\": \"%s\"", (i == 0) ? "" : ",",
+            Benchmark::escape(CONTEXT[i].first).c_str(), Benchmark::escape(CONTEXT[i].second).c_str());
+    }
+    fprintf(file.get(), "%s},\n  \"benchmarks\": [", CONTEXT.empty() ? "" : "\n  ");
+    
+    for (size_t i = 0 ; i < this->results_.size() ; i++) {
+        
+        const Result& RESULT = this->results_[i];
+        
+        fprintf(file.get(), "%s\n    {\n", (i == 0) ? "" : ",");
+        fprintf(file.get(), "      \"name\": \"%s\",\n",
+            Benchmark::escape(Benchmark::fullName(RESULT.name, RESULT.parameters)).c_str());
+        fprintf(file.get(), "      \"benchmark\": \"%s\",\n", Benchmark::escape(RESULT.name).c_str());
+        fprintf(file.get(), "      \"parameters\": {");
+        for (size_t j = 0 ; j < RESULT.parameters.size() ; j++) {
+            fprintf(file.get(), "%s\"%s\": \"%s\"", (j == 0) ? "" : ", ",
+                Benchmark::escape(RESULT.parameters[j].first).c_str(),
+                Benchmark::escape(RESULT.parameters[j].second).c_str());
+        }
+        fprintf(file.get(), "},\n");
+        fprintf(file.get(), "      \"iterations\": %u,\n", (unsigned) RESULT.iterations);
+        fprintf(file.get(), "      \"repetitions\": %u,\n", (unsigned) RESULT.repetitions);
+        fprintf(file.get(), "      \"minNsPerOp\": %.4f,\n", RESULT.minimum);
+        fprintf(file.get(), "      \"medianNsPerOp\": %.4f,\n", RESULT.median);
+        fprintf(file.get(), "      \"meanNsPerOp\": %.4f\n", RESULT.mean);
+        fprintf(file.get(), "    }");
+        
+    }
+    
+    fprintf(file.get(), "%s]\n}\n", this->results_.empty() ? "" : "\n  ");
+    
+    if (ferror(file.get())) {
+        throw std::runtime_error(PATH + ": cannot write the file");
+    }
+    
+}
+
+/*
+    Helpers
+*/
+
+/**
+ * Returns the name of a benchmark followed by its
+ * parameters, as in "name/key=value/key=value".
+ * 
+ * @param NAME       - The name of the benchmark
+ * @param PARAMETERS - The parameters of the benchmark
+ */
+std::string Benchmark::fullName(const std::string& NAME, const Parameters& PARAMETERS) {
+    
+    std::string name = NAME;
+    for (const std::pair<std::string, std::string>& PARAMETER : PARAMETERS) {
+        name += "/" + PARAMETER.first + "=" + PARAMETER.second;
+    }
+    
+    return name;
+    
+}
+
+/**
+ * Returns the text given as a parameter with the
+ * characters which cannot appear as such in a JSON
+ * string escaped.
+ * 
+ * @param TEXT - The text to escape
+ */
+std::string Benchmark::escape(const std::string& TEXT) {
+    
+    std::string escaped;
+    
+    for (const char C : TEXT) {
+        if ((C == '"') || (C == '\\')) {
+            escaped += '\\';
+            escaped += C;
+        } else if (static_cast<unsigned char>(C) < 0x20) {
+            char code[8];
+            snprintf(code, sizeof(code), "\\u%04x", (unsigned) C);
+            escaped += code;
+        } else {
+            escaped += C;
+        }
+    }
+    
+    return escaped;
+    
+}
+
+/**
+ * Records the outcome of a benchmark from the times
+ * taken by its repetitions, in seconds.
+ * 
+ * @param NAME       - The name of the benchmark
+ * @param PARAMETERS - The parameters of the benchmark
+ * @param ITERATIONS - The number of operations of
+ *                     each repetition
+ * @param seconds    - The time taken by each
+ *                     repetition, sorted by this
+ *                     function
+ * @param CHECKSUM   - The checksum of the results
+ */
+void Benchmark::add(const std::string& NAME, const Parameters& PARAMETERS, const size_t ITERATIONS,
+    std::vector<double>& seconds, const double CHECKSUM)
+{
+    std::sort(seconds.begin(), seconds.end());
+    
+    const double SCALE = 1e9 / ITERATIONS;
+    const size_t MIDDLE = seconds.size() / 2;
+    
+    Result result;
+    result.name = NAME;
+    result.parameters = PARAMETERS;
+    result.iterations = ITERATIONS;
+    result.repetitions = seconds.size();
+    result.minimum = SCALE * seconds.front();
+    result.median = SCALE * ((seconds.size() % 2 == 1) ? seconds[MIDDLE] :
+        0.5 * (seconds[MIDDLE - 1] + seconds[MIDDLE]));
+    result.mean = SCALE * std::accumulate(seconds.begin(), seconds.end(), 0.0) / seconds.size();
+    result.checksum = CHECKSUM;
+    
+    this->results_.push_back(result);
+}
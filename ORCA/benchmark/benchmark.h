@@ -0,0 +1,165 @@
+/**
+ * File  : benchmark.h
+ * Author: Raja Soufi
+ * 
+ * Class definition of the Benchmark class, a small
+ * harness timing pieces of code in isolation and
+ * reporting their cost in nanoseconds per operation.
+ * 
+ * Each benchmark is a body running a given number of
+ * operations and returning a checksum of what they
+ * computed, so that the compiler cannot drop them.
+ * The number of operations is first calibrated so
+ * that a run lasts at least minTime seconds, and the
+ * body is then run repetitions times with that
+ * number, the fastest, median and mean times per
+ * operation being kept. The results are printed as a
+ * table and can be written to a JSON file, so that
+ * they can be compared from one revision to the next.
+ */
+
+// Include guard
+#ifndef _BENCHMARK_H_
+#define _BENCHMARK_H_
+
+// Inclusions
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Class definition
+class Benchmark {
+    
+    public:
+    
+    // Parameters of a benchmark, as (name, value) pairs
+    typedef std::vector<std::pair<std::string, std::string> > Parameters;
+    
+    // Outcome of a benchmark
+    struct Result {
+        std::string name;
+        Parameters parameters;
+        size_t iterations;
+        size_t repetitions;
+        double minimum;
+        double median;
+        double mean;
+        double checksum;
+    };
+    
+    private:
+    
+    // Attributes
+    double minTime_;
+    size_t repetitions_;
+    std::string filter_;
+    std::vector<Result> results_;
+    
+    // Helpers
+    static std::string fullName(const std::string& NAME, const Parameters& PARAMETERS);
+    static std::string escape(const std::string& TEXT);
+    
+    template <typename Body>
+    static double time(Body& body, const size_t ITERATIONS, double& checksum);
+    
+    void add(const std::string& NAME, const Parameters& PARAMETERS, const size_t ITERATIONS,
+        std::vector<double>& seconds, const double CHECKSUM);
+        
+    public:
+    
+    // Constructor
+    Benchmark(const double MIN_TIME, const size_t REPETITIONS, const std::string& FILTER);
+    
+    // Getters
+    inline const std::vector<Result>& results(void) const;
+    
+    // Other methods
+    template <typename Body>
+    void run(const std::string& NAME, const Parameters& PARAMETERS, Body body);
+    
+    void print(FILE* file) const;
+    void writeJson(const std::string& PATH, const Parameters& CONTEXT) const;
+    
+};
+
+/*
+    Getters
+*/
+
+/**
+ * Returns the results of the benchmarks run so far,
+ * in the order in which they were run.
+ */
+inline const std::vector<Benchmark::Result>& Benchmark::results(void) const {
+    return this->results_;
+}
+
+/*
+    Other methods
+*/
+
+/**
+ * Runs the benchmark with the name and parameters
+ * given as parameters, unless it does not match the
+ * filter. BODY is called with a number of operations
+ * to run and returns a checksum of their results.
+ * 
+ * @param NAME       - The name of the benchmark
+ * @param PARAMETERS - The parameters of the benchmark
+ * @param body       - The code to time
+ */
+template <typename Body>
+void Benchmark::run(const std::string& NAME, const Parameters& PARAMETERS, Body body) {
+    
+    if (Benchmark::fullName(NAME, PARAMETERS).find(this->filter_) == std::string::npos) {
+        return;
+    }
+    
+    double checksum = 0.0;
+    
+    // Find a number of operations lasting at least minTime
+    size_t iterations = 1;
+    for (;;) {
+        double elapsed = Benchmark::time(body, iterations, checksum);
+        if (elapsed >= this->minTime_) {
+            break;
+        }
+        double factor = (elapsed > 0.0) ? 1.4 * this->minTime_ / elapsed : 100.0;
+        iterations = static_cast<size_t>(iterations * std::min(std::max(factor, 2.0), 100.0));
+    }
+    
+    // Time the repetitions with that number of operations
+    std::vector<double> seconds;
+    for (size_t i = 0 ; i < this->repetitions_ ; i++) {
+        seconds.push_back(Benchmark::time(body, iterations, checksum));
+    }
+    
+    this->add(NAME, PARAMETERS, iterations, seconds, checksum);
+    
+}
+
+/*
+    Helpers
+*/
+
+/**
+ * Returns the time taken by BODY to run ITERATIONS
+ * operations, in seconds, and adds its checksum to
+ * the one given as a parameter.
+ * 
+ * @param body       - The code to time
+ * @param ITERATIONS - The number of operations to run
+ * @param checksum   - The sum of the checksums so far
+ */
+template <typename Body>
+double Benchmark::time(Body& body, const size_t ITERATIONS, double& checksum) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    checksum += body(ITERATIONS);
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+#endif // _BENCHMARK_H_
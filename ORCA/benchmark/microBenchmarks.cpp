@@ -0,0 +1,462 @@
+/**
+ * File  : microBenchmarks.cpp
+ * Author: Raja Soufi
+ * 
+ * Implementation of the main function of the
+ * micro-benchmarks, timing the hot kernels of ORCA in
+ * isolation: the half-plane tests, the computation of
+ * ORCA_A|B^TAU and ORCA_A^TAU, and the linear
+ * programs, over numbers of neighbors and
+ * configurations of constraints.
+ * 
+ * The linear programs are solved in three
+ * configurations of N constraints:
+ * 
+ *     - feasible, the half-planes being tangent to a
+ *       circle around the origin and containing it,
+ *       so that the solution lies on their boundary;
+ *     - infeasible, the same half-planes facing out,
+ *       so that the program falls back to minimizing
+ *       the violation of the constraints;
+ *     - vertical, every bounding line being vertical,
+ *       so that the lines are all parallel, which is
+ *       the degenerate case of the 1D programs.
+ * 
+ * Since ORCA::solveLinearProgram shuffles the
+ * half-planes it is given, each operation first
+ * copies them into a vector allocated once, the copy
+ * being part of the time measured.
+ */
+
+// Inclusions
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <exception>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../geom/directedHalfPlane.h"
+#include "../geom/halfPlane.h"
+#include "../geom/point.h"
+#include "../geom/vector.h"
+
+#include "../orca/agent.h"
+#include "../orca/agentStore.h"
+#include "../orca/kdTree.h"
+#include "../orca/orca.h"
+#include "../orca/orcaKernel.h"
+
+#include "benchmark.h"
+
+/*
+    Constants
+*/
+
+// The number of inputs cycled through by the
+// benchmarks timing a single call
+static const size_t INPUT_COUNT = 1024;
+
+// The numbers of neighbors or constraints
+static const size_t COUNTS[] = {4, 16, 64};
+
+// The radius and maximum speed of the agents
+static const double AGENT_RADIUS = 8.0;
+static const double AGENT_MAX_SPEED = 20.0;
+
+// The value of tau
+static const double TAU = 2.0;
+
+/*
+    Helpers
+*/
+
+/**
+ * Returns the name of the scalar type T.
+ */
+template <typename T>
+static const char* precision(void) {
+    return (sizeof(T) == sizeof(float)) ? "float" : "double";
+}
+
+/**
+ * Returns a crowd made of an agent at the origin and
+ * COUNT neighbors spread around it at random, all
+ * within its neighbor distance, with random
+ * velocities. The density of the crowd does not
+ * depend on its size.
+ * 
+ * @param COUNT - The number of neighbors
+ */
+static std::vector<Agent> crowd(const size_t COUNT) {
+    
+    std::minstd_rand engine(static_cast<unsigned>(COUNT));
+    const double SIDE = 3.0 * AGENT_RADIUS * std::sqrt(static_cast<double>(COUNT));
+    std::uniform_real_distribution<double> position(-SIDE, SIDE);
+    std::uniform_real_distribution<double> angle(0.0, 2.0 * M_PI);
+    
+    std::vector<Agent> agents;
+    for (size_t i = 0 ; i <= COUNT ; i++) {
+        Point p = (i == 0) ? Point(0.0, 0.0) : Point(position(engine), position(engine));
+        double theta = angle(engine);
+        Point destination = p + Point(1000.0 * std::cos(theta), 1000.0 * std::sin(theta));
+        agents.push_back(Agent(p, destination, AGENT_RADIUS, AGENT_MAX_SPEED,
+            4.0 * SIDE, static_cast<int>(COUNT)));
+        agents.back().updateVelocity(Vector(AGENT_MAX_SPEED * std::cos(theta),
+            AGENT_MAX_SPEED * std::sin(theta)));
+    }
+    
+    return agents;
+    
+}
+
+/**
+ * Returns the set of COUNT constraints of the
+ * configuration with the name given as a parameter.
+ * 
+ * @param CONFIGURATION - feasible, infeasible or
+ *                        vertical
+ * @param COUNT         - The number of constraints
+ */
+template <typename T>
+static std::vector<BasicDirectedHalfPlane<T> > constraints(const std::string& CONFIGURATION,
+    const size_t COUNT)
+{
+    std::minstd_rand engine(static_cast<unsigned>(COUNT));
+    std::uniform_real_distribution<double> jitter(0.0, 0.25);
+    
+    std::vector<BasicDirectedHalfPlane<T> > H;
+    for (size_t i = 0 ; i < COUNT ; i++) {
+        
+        double theta = 2.0 * M_PI * (i + jitter(engine)) / COUNT;
+        double distance = 1.0 + jitter(engine);
+        if (CONFIGURATION == "vertical") {
+            theta = (i % 2 == 0) ? 0.0 : M_PI;
+        }
+        
+        BasicVector<T> normal(static_cast<T>(std::cos(theta)), static_cast<T>(std::sin(theta)));
+        BasicVector<T> direction(-normal.y(), normal.x());
+        if (CONFIGURATION == "infeasible") {
+            direction = -direction;
+        }
+        H.push_back(BasicDirectedHalfPlane<T>(normal * static_cast<T>(distance), direction));
+        
+    }
+    
+    return H;
+}
+
+/*
+    Benchmarks
+*/
+
+/**
+ * Times HalfPlane::contains and
+ * DirectedHalfPlane::contains on random points.
+ * 
+ * @param benchmark - The harness running the benchmarks
+ */
+template <typename T>
+static void benchmarkContains(Benchmark& benchmark) {
+    
+    std::minstd_rand engine(1);
+    std::uniform_real_distribution<double> coordinate(-1.0, 1.0);
+    
+    std::vector<BasicPoint<T> > points;
+    for (size_t i = 0 ; i < INPUT_COUNT ; i++) {
+        points.push_back(BasicPoint<T>(static_cast<T>(coordinate(engine)), static_cast<T>(coordinate(engine))));
+    }
+    
+    const BasicHalfPlane<T> HALF_PLANE(BasicPoint<T>(T(0.1), T(0.2)), BasicVector<T>(T(0.6), T(0.8)));
+    const BasicDirectedHalfPlane<T> DIRECTED(BasicVector<T>(T(0.1), T(0.2)), BasicVector<T>(T(-0.8), T(0.6)));
+    const Benchmark::Parameters PARAMETERS = {{"precision", precision<T>()}};
+    
+    benchmark.run("HalfPlane::contains", PARAMETERS, [&](const size_t ITERATIONS) {
+        size_t inside = 0;
+        for (size_t i = 0 ; i < ITERATIONS ; i++) {
+            inside += HALF_PLANE.contains(points[i % INPUT_COUNT]);
+        }
+        return static_cast<double>(inside);
+    });
+    
+    benchmark.run("DirectedHalfPlane::contains", PARAMETERS, [&](const size_t ITERATIONS) {
+        size_t inside = 0;
+        for (size_t i = 0 ; i < ITERATIONS ; i++) {
+            inside += DIRECTED.contains(BasicVector<T>(points[i % INPUT_COUNT]));
+        }
+        return static_cast<double>(inside);
+    });
+    
+}
+
+/**
+ * Times the computation of a single ORCA_A|B^TAU,
+ * through ORCA::orca_A_B and its trigonometric
+ * version, on random pairs of agents. That the two
+ * agree is checked by tools/accuracyReport.cpp,
+ * which should pass before these times are compared.
+ * 
+ * @param benchmark - The harness running the benchmarks
+ */
+template <typename T>
+static void benchmarkOrcaAB(Benchmark& benchmark) {
+    
+    const std::vector<Agent> AGENTS = crowd(INPUT_COUNT);
+    const BasicAgentStore<T> STORE(AGENTS);
+    const T R = static_cast<T>(AGENT_RADIUS);
+    const Benchmark::Parameters PARAMETERS = {{"precision", precision<T>()}};
+    
+    benchmark.run("ORCA::orca_A_B", PARAMETERS, [&](const size_t ITERATIONS) {
+        double sum = 0.0;
+        for (size_t i = 0 ; i < ITERATIONS ; i++) {
+            size_t j = 1 + i % INPUT_COUNT;
+            sum += ORCA::orca_A_B(STORE.position(0), STORE.velocity(0), R,
+                STORE.position(j), STORE.velocity(j), R, static_cast<T>(TAU)).point().x();
+        }
+        return sum;
+    });
+    
+    benchmark.run("ORCA::orca_A_B_trigonometric", PARAMETERS, [&](const size_t ITERATIONS) {
+        double sum = 0.0;
+        for (size_t i = 0 ; i < ITERATIONS ; i++) {
+            size_t j = 1 + i % INPUT_COUNT;
+            sum += ORCA::orca_A_B_trigonometric(STORE.position(0), STORE.velocity(0), R,
+                STORE.position(j), STORE.velocity(j), R, static_cast<T>(TAU)).point().x();
+        }
+        return sum;
+    });
+    
+}
+
+/**
+ * Times Agent::orca_A_B on random pairs of agents.
+ * 
+ * @param benchmark - The harness running the benchmarks
+ */
+static void benchmarkAgentOrcaAB(Benchmark& benchmark) {
+    
+    const std::vector<Agent> AGENTS = crowd(INPUT_COUNT);
+    
+    benchmark.run("Agent::orca_A_B", {}, [&](const size_t ITERATIONS) {
+        double sum = 0.0;
+        for (size_t i = 0 ; i < ITERATIONS ; i++) {
+            sum += AGENTS[0].orca_A_B(AGENTS[1 + i % INPUT_COUNT], TAU).point().x();
+        }
+        return sum;
+    });
+    
+}
+
+/**
+ * Times the computation of ORCA_A^TAU for an agent
+ * with each number of neighbors, by Agent::orca_A
+ * and by the agent store, searching the neighbors
+ * by brute force and in a k-d tree.
+ * 
+ * @param benchmark - The harness running the benchmarks
+ */
+template <typename T>
+static void benchmarkOrcaA(Benchmark& benchmark) {
+    
+    for (const size_t COUNT : COUNTS) {
+        
+        std::vector<Agent> agents = crowd(COUNT);
+        const BasicAgentStore<T> STORE(agents);
+        BasicKdTree<T> tree;
+        tree.build(STORE);
+        typename BasicAgentStore<T>::Workspace workspace = typename BasicAgentStore<T>::Workspace();
+        
+        const Benchmark::Parameters PARAMETERS = {
+            {"precision", precision<T>()}, {"neighbors", std::to_string(COUNT)}
+        };
+        
+        if (sizeof(T) == sizeof(double)) {
+            benchmark.run("Agent::orca_A", {{"neighbors", std::to_string(COUNT)}},
+                [&](const size_t ITERATIONS) {
+                    double sum = 0.0;
+                    for (size_t i = 0 ; i < ITERATIONS ; i++) {
+                        sum += agents[0].orca_A(agents, TAU).size();
+                    }
+                    return sum;
+                });
+        }
+        
+        benchmark.run("AgentStore::orca_A/brute", PARAMETERS, [&](const size_t ITERATIONS) {
+            double sum = 0.0;
+            for (size_t i = 0 ; i < ITERATIONS ; i++) {
+                STORE.orca_A(0, static_cast<T>(TAU), workspace);
+                sum += workspace.halfPlanes.size();
+            }
+            return sum;
+        });
+        
+        benchmark.run("AgentStore::orca_A/kdtree", PARAMETERS, [&](const size_t ITERATIONS) {
+            double sum = 0.0;
+            for (size_t i = 0 ; i < ITERATIONS ; i++) {
+                STORE.orca_A(0, tree, static_cast<T>(TAU), workspace);
+                sum += workspace.halfPlanes.size();
+            }
+            return sum;
+        });
+        
+    }
+    
+}
+
+/**
+ * Times ORCA::solveLinearProgram for each number of
+ * constraints and each configuration.
+ * 
+ * @param benchmark - The harness running the benchmarks
+ */
+template <typename T>
+static void benchmarkLinearProgram(Benchmark& benchmark) {
+    
+    static const char* const CONFIGURATIONS[] = {"feasible", "infeasible", "vertical"};
+    
+    const BasicVector<T> V_PREF(T(2), T(0.5));
+    const T MAX_SPEED = T(2);
+    
+    for (const char* const CONFIGURATION : CONFIGURATIONS) {
+        for (const size_t COUNT : COUNTS) {
+            
+            const std::vector<BasicDirectedHalfPlane<T> > H = constraints<T>(CONFIGURATION, COUNT);
+            std::vector<BasicDirectedHalfPlane<T> > copy(H);
+            
+            const Benchmark::Parameters PARAMETERS = {
+                {"precision", precision<T>()}, {"constraints", std::to_string(COUNT)},
+                {"configuration", CONFIGURATION}
+            };
+            
+            benchmark.run("ORCA::solveLinearProgram", PARAMETERS, [&](const size_t ITERATIONS) {
+                double sum = 0.0;
+                BasicPoint<T> solution;
+                for (size_t i = 0 ; i < ITERATIONS ; i++) {
+                    copy.assign(H.begin(), H.end());
+                    sum += ORCA::solveLinearProgram(copy, V_PREF, MAX_SPEED, solution);
+                    sum += solution.x();
+                }
+                return sum;
+            });
+            
+        }
+    }
+    
+}
+
+/**
+ * Prints how to use the program.
+ * 
+ * @param PROGRAM - The name of the program
+ */
+static void usage(const char* const PROGRAM) {
+    fprintf(stderr,
+        "Usage: %s [options]\n"
+        "\n"
+        "Options:\n"
+        "  --filter TEXT         Only run the benchmarks whose name contains TEXT\n"
+        "  --json PATH           Write the results to PATH as JSON\n"
+        "  --min-time SECONDS    Make each repetition last at least SECONDS (0.1)\n"
+        "  --repetitions N       Time each benchmark N times (5)\n",
+        PROGRAM);
+}
+
+/**
+ * Returns the date and time, in UTC and ISO 8601
+ * format.
+ */
+static std::string now(void) {
+    char date[32];
+    time_t seconds = time(NULL);
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", gmtime(&seconds));
+    return date;
+}
+
+/*
+    Main function
+*/
+
+/**
+ * The main function of the program.
+ * 
+ * @param argc - The number of parameters passed to
+ *               the program
+ * @param argv - A pointer to the parameters passed
+ *               to the program
+ */
+int main(int argc, char** argv) {
+    
+    std::string filter;
+    std::string jsonPath;
+    double minTime = 0.1;
+    long repetitions = 5;
+    
+    for (int i = 1 ; i < argc ; i++) {
+        
+        bool hasValue = (i + 1 < argc);
+        char* end = NULL;
+        
+        if ((strcmp(argv[i], "--filter") == 0) && hasValue) {
+            filter = argv[++i];
+        } else if ((strcmp(argv[i], "--json") == 0) && hasValue) {
+            jsonPath = argv[++i];
+        } else if ((strcmp(argv[i], "--min-time") == 0) && hasValue) {
+            minTime = strtod(argv[++i], &end);
+        } else if ((strcmp(argv[i], "--repetitions") == 0) && hasValue) {
+            repetitions = strtol(argv[++i], &end, 10);
+        } else {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        
+        if ((end != NULL) && ((end == argv[i]) || (*end != '\0') || (minTime <= 0.0) || (repetitions <= 0))) {
+            fprintf(stderr, "%s: '%s' is not a positive number\n", argv[0], argv[i]);
+            return EXIT_FAILURE;
+        }
+        
+    }
+    
+    try {
+        
+        Benchmark benchmark(minTime, static_cast<size_t>(repetitions), filter);
+        
+        benchmarkContains<float>(benchmark);
+        benchmarkContains<double>(benchmark);
+        benchmarkOrcaAB<float>(benchmark);
+        benchmarkOrcaAB<double>(benchmark);
+        benchmarkAgentOrcaAB(benchmark);
+        benchmarkOrcaA<float>(benchmark);
+        benchmarkOrcaA<double>(benchmark);
+        benchmarkLinearProgram<float>(benchmark);
+        benchmarkLinearProgram<double>(benchmark);
+        
+        benchmark.print(stdout);
+        
+        if (!jsonPath.empty()) {
+            benchmark.writeJson(jsonPath, {
+                {"date", now()},
+                #ifdef __VERSION__
+                {"compiler", __VERSION__},
+                #endif
+                #ifdef NDEBUG
+                {"assertions", "off"},
+                #else
+                {"assertions", "on"},
+                #endif
+                {"kernel", OrcaKernel::instructionSetName(OrcaKernel::instructionSet())},
+                {"minTime", std::to_string(minTime)},
+                {"repetitions", std::to_string(repetitions)}
+            });
+        }
+        
+    } catch (const std::exception& e) {
+        fprintf(stderr, "%s: %s\n", argv[0], e.what());
+        return EXIT_FAILURE;
+    }
+    
+    return EXIT_SUCCESS;
+    
+}
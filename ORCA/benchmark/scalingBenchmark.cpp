@@ -0,0 +1,460 @@
+/**
+ * File  : scalingBenchmark.cpp
+ * Author: Raja Soufi
+ * 
+ * Implementation of the main function of the scaling
+ * benchmark, timing whole steps of the simulation,
+ * that is ORCA::iteration followed by moveAgents,
+ * over numbers of agents, densities, thread counts
+ * and precisions.
+ * 
+ * The agents are laid out by the generated
+ * scenarios, which scale the configurations of the
+ * demo: circle for CIRCLE, crossing for TWO_LINE,
+ * grid for SQUARE and random for RANDOM. Each run is
+ * given about the same number of agent-steps, so that
+ * the small crowds run many steps and the large ones
+ * only a few, and stops early if the agents arrive.
+ * The preferred velocities are skewed as in the
+ * demo, so that the symmetric layouts do not
+ * deadlock.
+ * Each run is repeated and the fastest repetition
+ * kept, to make up for the noise of the machine.
+ * 
+ * A line is written per run, as CSV, with the
+ * throughput in agent-steps per second, the speedup
+ * over one thread, and the percentiles of the time
+ * taken by a step. Given the CSV of an earlier run as
+ * a baseline, the runs whose throughput or speedup
+ * fell by more than the tolerance are reported, and
+ * the program fails.
+ */
+
+// Inclusions
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../runner/runner.h"
+
+#include "../scenario/scenario.h"
+
+/*
+    Constants
+*/
+
+// The columns of the CSV files
+static const char* const HEADER = "scenario,agents,density,precision,threads,steps,converged,"
+    "setup_seconds,run_seconds,agent_steps_per_second,speedup,"
+    "step_p50_ms,step_p90_ms,step_p99_ms,step_max_ms";
+    
+// The default sweeps
+static const char* const DEFAULT_SCENARIOS = "circle,crossing,grid,random";
+static const char* const DEFAULT_AGENTS = "10,100,1000,10000,100000,1000000";
+static const char* const DEFAULT_DENSITIES = "0.5,1,2";
+static const char* const DEFAULT_PRECISIONS = "double,float";
+
+// The smallest number of steps of a run
+static const size_t MIN_STEPS = 5;
+
+/*
+    Helpers
+*/
+
+// A file closed when it goes out of scope
+typedef std::unique_ptr<FILE, int (*)(FILE*)> Output;
+
+// The throughput and speedup of a run, by the
+// scenario, agents, density, precision and threads
+typedef std::map<std::string, std::pair<double, double> > Baseline;
+
+/**
+ * Prints how to use the program.
+ * 
+ * @param PROGRAM - The name of the program
+ */
+static void usage(const char* const PROGRAM) {
+    fprintf(stderr,
+        "Usage: %s [options]\n"
+        "\n"
+        "Lists are separated by commas.\n"
+        "\n"
+        "Options:\n"
+        "  --scenarios LIST      Among circle, crossing, grid and random (all)\n"
+        "  --agents LIST         Numbers of agents (%s)\n"
+        "  --densities LIST      Densities of the agents (%s)\n"
+        "  --threads LIST        Thread counts (powers of two up to the cores)\n"
+        "  --precisions LIST     Among double and float (both)\n"
+        "  --steps N             Run at most N steps (200)\n"
+        "  --skew F              Skew the preferred velocities by at most F (0.01)\n"
+        "  --budget N            Give each run about N agent-steps (2000000)\n"
+        "  --repetitions N       Repeat each run N times and keep the fastest (3)\n"
+        "  --csv PATH            Write the results to PATH as CSV\n"
+        "  --baseline PATH       Compare with the CSV written by an earlier run\n"
+        "  --tolerance F         Flag the runs more than F slower (0.15)\n",
+        PROGRAM, DEFAULT_AGENTS, DEFAULT_DENSITIES);
+}
+
+/**
+ * Returns the items of a list separated by commas.
+ * 
+ * @param LIST - The list to split
+ */
+static std::vector<std::string> split(const std::string& LIST) {
+    
+    std::vector<std::string> items;
+    std::istringstream stream(LIST);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        items.push_back(item);
+    }
+    
+    return items;
+    
+}
+
+/**
+ * Reads a positive number from the text given as a
+ * parameter, or throws an exception if it is not
+ * one.
+ * 
+ * @param TEXT - The text to read
+ */
+static double positive(const std::string& TEXT) {
+    char* end;
+    double value = strtod(TEXT.c_str(), &end);
+    if (TEXT.empty() || (*end != '\0') || !(value > 0.0)) {
+        throw std::invalid_argument("'" + TEXT + "' is not a positive number");
+    }
+    return value;
+}
+
+/**
+ * Reads a non-negative number from the text given as
+ * a parameter, or throws an exception if it is not
+ * one.
+ * 
+ * @param TEXT - The text to read
+ */
+static double nonNegative(const std::string& TEXT) {
+    char* end;
+    double value = strtod(TEXT.c_str(), &end);
+    if (TEXT.empty() || (*end != '\0') || !(value >= 0.0)) {
+        throw std::invalid_argument("'" + TEXT + "' is not a non-negative number");
+    }
+    return value;
+}
+
+/**
+ * Reads a list of positive counts separated by
+ * commas.
+ * 
+ * @param LIST - The list to read
+ */
+static std::vector<size_t> counts(const std::string& LIST) {
+    std::vector<size_t> values;
+    for (const std::string& ITEM : split(LIST)) {
+        values.push_back(static_cast<size_t>(positive(ITEM)));
+    }
+    return values;
+}
+
+/**
+ * Returns the default thread counts: the powers of
+ * two below the number of cores, and the number of
+ * cores.
+ */
+static std::string defaultThreads(void) {
+    
+    size_t cores = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    
+    std::string list;
+    for (size_t threads = 1 ; threads < cores ; threads *= 2) {
+        list += std::to_string(threads) + ",";
+    }
+    
+    return list + std::to_string(cores);
+    
+}
+
+/**
+ * Returns the key identifying a run in a baseline.
+ * 
+ * @param SCENARIO  - The kind of scenario
+ * @param AGENTS    - The number of agents
+ * @param DENSITY   - The density of the agents
+ * @param PRECISION - The precision, double or float
+ * @param THREADS   - The number of threads
+ */
+static std::string key(const std::string& SCENARIO, const std::string& AGENTS,
+    const std::string& DENSITY, const std::string& PRECISION, const std::string& THREADS)
+{
+    return SCENARIO + "," + AGENTS + "," + DENSITY + "," + PRECISION + "," + THREADS;
+}
+
+/**
+ * Reads the throughput and speedup of each run from
+ * the CSV file written by an earlier run of this
+ * program.
+ * 
+ * @param PATH - The path of the file
+ */
+static Baseline readBaseline(const std::string& PATH) {
+    
+    std::ifstream file(PATH.c_str());
+    std::string line;
+    if (!file || !std::getline(file, line)) {
+        throw std::runtime_error(PATH + ": cannot read the baseline");
+    }
+    
+    // Find the columns by name
+    const std::vector<std::string> COLUMNS = split(line);
+    std::map<std::string, size_t> index;
+    for (size_t i = 0 ; i < COLUMNS.size() ; i++) {
+        index[COLUMNS[i]] = i;
+    }
+    for (const char* const NAME : {"scenario", "agents", "density", "precision", "threads",
+        "agent_steps_per_second", "speedup"})
+    {
+        if (index.find(NAME) == index.end()) {
+            throw std::runtime_error(PATH + ": no column " + NAME);
+        }
+    }
+    
+    Baseline baseline;
+    while (std::getline(file, line)) {
+        std::vector<std::string> fields = split(line);
+        if (fields.size() != COLUMNS.size()) {
+            continue;
+        }
+        baseline[key(fields[index["scenario"]], fields[index["agents"]], fields[index["density"]],
+            fields[index["precision"]], fields[index["threads"]])] = std::make_pair(
+            atof(fields[index["agent_steps_per_second"]].c_str()), atof(fields[index["speedup"]].c_str()));
+    }
+    
+    return baseline;
+    
+}
+
+/**
+ * Returns the scenario of the kind given as a
+ * parameter.
+ * 
+ * @param KIND    - circle, crossing, grid or random
+ * @param COUNT   - The number of agents
+ * @param DENSITY - The density of the agents
+ */
+static Scenario scenario(const std::string& KIND, const size_t COUNT, const double DENSITY) {
+    if (KIND == "circle") {
+        return Scenario::circle(COUNT, DENSITY);
+    } else if (KIND == "crossing") {
+        return Scenario::crossing(COUNT, DENSITY);
+    } else if (KIND == "grid") {
+        return Scenario::grid(COUNT, DENSITY);
+    } else if (KIND == "random") {
+        return Scenario::random(COUNT, 1, DENSITY);
+    }
+    throw std::invalid_argument("unknown scenario '" + KIND + "'");
+}
+
+/*
+    Main function
+*/
+
+/**
+ * The main function of the program.
+ * 
+ * @param argc - The number of parameters passed to
+ *               the program
+ * @param argv - A pointer to the parameters passed
+ *               to the program
+ */
+int main(int argc, char** argv) {
+    
+    std::string scenarioList = DEFAULT_SCENARIOS;
+    std::string agentList = DEFAULT_AGENTS;
+    std::string densityList = DEFAULT_DENSITIES;
+    std::string threadList = defaultThreads();
+    std::string precisionList = DEFAULT_PRECISIONS;
+    std::string steps = "200";
+    std::string skew = "0.01";
+    std::string budget = "2000000";
+    std::string repetitions = "3";
+    std::string csvPath;
+    std::string baselinePath;
+    std::string tolerance = "0.15";
+    
+    for (int i = 1 ; i < argc ; i++) {
+        
+        bool hasValue = (i + 1 < argc);
+        
+        if ((strcmp(argv[i], "--scenarios") == 0) && hasValue) {
+            scenarioList = argv[++i];
+        } else if ((strcmp(argv[i], "--agents") == 0) && hasValue) {
+            agentList = argv[++i];
+        } else if ((strcmp(argv[i], "--densities") == 0) && hasValue) {
+            densityList = argv[++i];
+        } else if ((strcmp(argv[i], "--threads") == 0) && hasValue) {
+            threadList = argv[++i];
+        } else if ((strcmp(argv[i], "--precisions") == 0) && hasValue) {
+            precisionList = argv[++i];
+        } else if ((strcmp(argv[i], "--steps") == 0) && hasValue) {
+            steps = argv[++i];
+        } else if ((strcmp(argv[i], "--skew") == 0) && hasValue) {
+            skew = argv[++i];
+        } else if ((strcmp(argv[i], "--budget") == 0) && hasValue) {
+            budget = argv[++i];
+        } else if ((strcmp(argv[i], "--repetitions") == 0) && hasValue) {
+            repetitions = argv[++i];
+        } else if ((strcmp(argv[i], "--csv") == 0) && hasValue) {
+            csvPath = argv[++i];
+        } else if ((strcmp(argv[i], "--baseline") == 0) && hasValue) {
+            baselinePath = argv[++i];
+        } else if ((strcmp(argv[i], "--tolerance") == 0) && hasValue) {
+            tolerance = argv[++i];
+        } else {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        
+    }
+    
+    size_t regressions = 0;
+    
+    try {
+        
+        const std::vector<std::string> SCENARIOS = split(scenarioList);
+        const std::vector<size_t> AGENTS = counts(agentList);
+        const std::vector<std::string> DENSITIES = split(densityList);
+        const std::vector<size_t> THREADS = counts(threadList);
+        const std::vector<std::string> PRECISIONS = split(precisionList);
+        const size_t MAX_STEPS = static_cast<size_t>(positive(steps));
+        const double SKEW = nonNegative(skew);
+        const double BUDGET = positive(budget);
+        const size_t REPETITIONS = static_cast<size_t>(positive(repetitions));
+        const double TOLERANCE = positive(tolerance);
+        
+        for (const std::string& PRECISION : PRECISIONS) {
+            if ((PRECISION != "double") && (PRECISION != "float")) {
+                throw std::invalid_argument("unknown precision '" + PRECISION + "'");
+            }
+        }
+        
+        const Baseline BASELINE = baselinePath.empty() ? Baseline() : readBaseline(baselinePath);
+        
+        Output csv(NULL, fclose);
+        if (!csvPath.empty()) {
+            csv.reset(fopen(csvPath.c_str(), "w"));
+            if (!csv) {
+                throw std::runtime_error(csvPath + ": cannot open the file for writing");
+            }
+            fprintf(csv.get(), "%s\n", HEADER);
+        }
+        
+        printf("%-9s %8s %7s %-9s %7s %6s %14s %8s %10s %10s\n", "scenario", "agents", "density",
+            "precision", "threads", "steps", "agent-steps/s", "speedup", "p50 ms", "p99 ms");
+            
+        for (const std::string& KIND : SCENARIOS) {
+            for (const size_t COUNT : AGENTS) {
+                for (const std::string& DENSITY : DENSITIES) {
+                    
+                    const Scenario SCENARIO = scenario(KIND, COUNT, positive(DENSITY));
+                    
+                    for (const std::string& PRECISION : PRECISIONS) {
+                        
+                        double singleThroughput = 0.0;
+                        
+                        for (const size_t THREAD_COUNT : THREADS) {
+                            
+                            Runner::Options options;
+                            options.singlePrecision = (PRECISION == "float");
+                            options.threadCount = THREAD_COUNT;
+                            options.skew = SKEW;
+                            options.maxSteps = std::min(MAX_STEPS,
+                                std::max(MIN_STEPS, static_cast<size_t>(BUDGET / COUNT)));
+                                
+                            Runner::Report report = Runner::run(SCENARIO, options);
+                            for (size_t k = 1 ; k < REPETITIONS ; k++) {
+                                Runner::Report repetition = Runner::run(SCENARIO, options);
+                                if (repetition.runSeconds / repetition.steps < report.runSeconds / report.steps) {
+                                    report = repetition;
+                                }
+                            }
+                            
+                            double throughput = (report.runSeconds > 0.0) ?
+                                report.agentCount * report.steps / report.runSeconds : 0.0;
+                            if (THREAD_COUNT == 1) {
+                                singleThroughput = throughput;
+                            }
+                            double speedup = (singleThroughput > 0.0) ? throughput / singleThroughput : 0.0;
+                            
+                            printf("%-9s %8u %7s %-9s %7u %6u %14.0f %8.2f %10.3f %10.3f\n", KIND.c_str(),
+                                (unsigned) COUNT, DENSITY.c_str(), PRECISION.c_str(), (unsigned) THREAD_COUNT,
+                                (unsigned) report.steps, throughput, speedup, 1e3 * report.medianStepSeconds,
+                                1e3 * report.p99StepSeconds);
+                            fflush(stdout);
+                            
+                            if (csv) {
+                                fprintf(csv.get(), "%s,%u,%s,%s,%u,%u,%d,%.6f,%.6f,%.1f,%.4f,%.6f,%.6f,%.6f,%.6f\n",
+                                    KIND.c_str(), (unsigned) COUNT, DENSITY.c_str(), PRECISION.c_str(),
+                                    (unsigned) THREAD_COUNT, (unsigned) report.steps, report.converged ? 1 : 0,
+                                    report.setupSeconds, report.runSeconds, throughput, speedup,
+                                    1e3 * report.medianStepSeconds, 1e3 * report.p90StepSeconds,
+                                    1e3 * report.p99StepSeconds, 1e3 * report.maxStepSeconds);
+                                fflush(csv.get());
+                            }
+                            
+                            // Compare with the baseline
+                            Baseline::const_iterator before = BASELINE.find(key(KIND, std::to_string(COUNT),
+                                DENSITY, PRECISION, std::to_string(THREAD_COUNT)));
+                            if (before == BASELINE.end()) {
+                                continue;
+                            }
+                            if (throughput < (1.0 - TOLERANCE) * before->second.first) {
+                                fprintf(stderr, "regression: %s: %.0f agent-steps/s instead of %.0f\n",
+                                    before->first.c_str(), throughput, before->second.first);
+                                regressions++;
+                            }
+                            if ((THREAD_COUNT > 1) && (speedup > 0.0) &&
+                                (speedup < (1.0 - TOLERANCE) * before->second.second))
+                            {
+                                fprintf(stderr, "regression: %s: speedup of %.2f instead of %.2f\n",
+                                    before->first.c_str(), speedup, before->second.second);
+                                regressions++;
+                            }
+                            
+                        }
+                        
+                    }
+                    
+                }
+            }
+        }
+        
+        if (csv && ferror(csv.get())) {
+            throw std::runtime_error(csvPath + ": cannot write the file");
+        }
+        
+    } catch (const std::exception& e) {
+        fprintf(stderr, "%s: %s\n", argv[0], e.what());
+        return EXIT_FAILURE;
+    }
+    
+    if (regressions > 0) {
+        fprintf(stderr, "%s: %u regressions against the baseline\n", argv[0], (unsigned) regressions);
+        return EXIT_FAILURE;
+    }
+    
+    return EXIT_SUCCESS;
+    
+}
@@ -0,0 +1,328 @@
+/**
+ * File  : crowdRenderer.cpp
+ * Author: Raja Soufi
+ * 
+ * Implementation of the CrowdRenderer class defined
+ * in crowdRenderer.h.
+ */
+
+// Declare the OpenGL 2 and 3 functions, which the
+// OpenGL library exports, before anything includes
+// the OpenGL header
+#define GL_GLEXT_PROTOTYPES
+
+// Include header file
+#include "crowdRenderer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <GL/glext.h>
+
+#include "../utilities/utilities.h"
+
+#include "color.h"
+
+/*
+    Constants
+*/
+
+/**
+ * The number of segments of the circle meshes, from
+ * the coarsest to the finest.
+ */
+const int CrowdRenderer::SEGMENTS[CrowdRenderer::LEVEL_COUNT] = {6, 12, 36};
+
+/**
+ * The number of floats per agent in the instance
+ * buffer: its position, radius and color.
+ */
+const size_t CrowdRenderer::INSTANCE_SIZE = 7;
+
+/**
+ * The vertex shader, which scales the unit circle
+ * by the radius of the agent and moves it to its
+ * position.
+ */
+const char* const CrowdRenderer::VERTEX_SHADER =
+    "#version 120\n"
+    "attribute vec2 vertex;\n"
+    "attribute vec3 agent;\n"
+    "attribute vec4 color;\n"
+    "varying vec4 agentColor;\n"
+    "void main(void) {\n"
+    "    agentColor = color;\n"
+    "    gl_Position = gl_ModelViewProjectionMatrix * vec4(agent.xy + agent.z * vertex, 0.0, 1.0);\n"
+    "}\n";
+    
+/**
+ * The fragment shader, which paints the agent in
+ * its color.
+ */
+const char* const CrowdRenderer::FRAGMENT_SHADER =
+    "#version 120\n"
+    "varying vec4 agentColor;\n"
+    "void main(void) {\n"
+    "    gl_FragColor = agentColor;\n"
+    "}\n";
+    
+/*
+    Constructor
+*/
+
+/**
+ * Constructs a renderer which does not draw anything
+ * until it is initialized.
+ */
+CrowdRenderer::CrowdRenderer(void) :
+    supported_(false),
+    arbDivisor_(false),
+    program_(0),
+    mesh_(0),
+    instances_(0),
+    first_(),
+    data_(),
+    colors_()
+{}
+
+/*
+    Other methods
+*/
+
+/**
+ * Compiles the shaders and uploads the circle mesh
+ * if the current OpenGL context can draw instances,
+ * and returns whether it can. Must be called once
+ * the context has been created.
+ */
+bool CrowdRenderer::initialize(void) {
+    
+    // Check the version of the context for instancing
+    int major = 0, minor = 0;
+    const char* version = reinterpret_cast<const char*>(glGetString(GL_VERSION));
+    const char* extensions = reinterpret_cast<const char*>(glGetString(GL_EXTENSIONS));
+    
+    if ((version == NULL) || (sscanf(version, "%d.%d", &major, &minor) != 2)) {
+        return false;
+    }
+    
+    if ((major > 3) || ((major == 3) && (minor >= 3))) {
+        this->arbDivisor_ = false;
+    } else if ((major == 3) && (minor >= 1) && (extensions != NULL) &&
+        (strstr(extensions, "GL_ARB_instanced_arrays") != NULL))
+    {
+        this->arbDivisor_ = true;
+    } else {
+        return false;
+    }
+    
+    // Build the program, with the circle mesh bound to
+    // attribute 0 as it must not be instanced
+    GLuint vertexShader = CrowdRenderer::compile(GL_VERTEX_SHADER, CrowdRenderer::VERTEX_SHADER);
+    GLuint fragmentShader = CrowdRenderer::compile(GL_FRAGMENT_SHADER, CrowdRenderer::FRAGMENT_SHADER);
+    
+    if ((vertexShader == 0) || (fragmentShader == 0)) {
+        glDeleteShader(vertexShader);
+        glDeleteShader(fragmentShader);
+        return false;
+    }
+    
+    this->program_ = glCreateProgram();
+    glAttachShader(this->program_, vertexShader);
+    glAttachShader(this->program_, fragmentShader);
+    glBindAttribLocation(this->program_, 0, "vertex");
+    glBindAttribLocation(this->program_, 1, "agent");
+    glBindAttribLocation(this->program_, 2, "color");
+    glLinkProgram(this->program_);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+    
+    GLint linked = GL_FALSE;
+    glGetProgramiv(this->program_, GL_LINK_STATUS, &linked);
+    if (linked != GL_TRUE) {
+        glDeleteProgram(this->program_);
+        this->program_ = 0;
+        return false;
+    }
+    
+    // Upload the unit circles one after the other, each
+    // as a triangle fan around its center
+    std::vector<GLfloat> circle;
+    for (size_t level = 0 ; level < CrowdRenderer::LEVEL_COUNT ; level++) {
+        const int SEGMENTS = CrowdRenderer::SEGMENTS[level];
+        this->first_[level] = circle.size() / 2;
+        circle.push_back(0.0f);
+        circle.push_back(0.0f);
+        for (int i = 0 ; i <= SEGMENTS ; i++) {
+            double angle = i * 360.0 / SEGMENTS * ONE_DEGREE_IN_RADIAN;
+            circle.push_back(static_cast<GLfloat>(cos(angle)));
+            circle.push_back(static_cast<GLfloat>(sin(angle)));
+        }
+    }
+    
+    glGenBuffers(1, &this->mesh_);
+    glBindBuffer(GL_ARRAY_BUFFER, this->mesh_);
+    glBufferData(GL_ARRAY_BUFFER, circle.size() * sizeof(GLfloat), circle.data(), GL_STATIC_DRAW);
+    
+    glGenBuffers(1, &this->instances_);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    
+    this->supported_ = true;
+    return true;
+    
+}
+
+/**
+ * Draws the agents given as a parameter with a
+ * single instanced call, each in the color given by
+ * its id relative to FIRST_ID, as in immediate mode.
+ * The circles get about one segment per 4 pixels of
+ * their circumference on the screen.
+ * 
+ * @param AGENTS          - The agents to draw
+ * @param FIRST_ID        - The id of the first agent
+ * @param PIXELS_PER_UNIT - The number of pixels a unit of
+ *                          length spans on the screen
+ */
+void CrowdRenderer::draw(const AgentStore& AGENTS, const int FIRST_ID, const double PIXELS_PER_UNIT) {
+    
+    if (!this->supported_ || (AGENTS.size() == 0)) {
+        return;
+    }
+    
+    const size_t COUNT = AGENTS.size();
+    this->updateColors(AGENTS);
+    
+    // Gather the instances of the frame
+    this->data_.resize(COUNT * CrowdRenderer::INSTANCE_SIZE);
+    GLfloat* instance = this->data_.data();
+    double maxRadius = 0.0;
+    
+    for (size_t i = 0 ; i < COUNT ; i++, instance += CrowdRenderer::INSTANCE_SIZE) {
+        size_t color = 4 * static_cast<size_t>(AGENTS.id(i) - FIRST_ID);
+        if (color >= this->colors_.size()) {
+            color = 0;
+        }
+        instance[0] = static_cast<GLfloat>(AGENTS.positionX()[i]);
+        instance[1] = static_cast<GLfloat>(AGENTS.positionY()[i]);
+        instance[2] = static_cast<GLfloat>(AGENTS.radius()[i]);
+        maxRadius = std::max(maxRadius, static_cast<double>(instance[2]));
+        std::memcpy(instance + 3, &this->colors_[color], 4 * sizeof(GLfloat));
+    }
+    
+    // Upload them to a fresh buffer, so that the driver
+    // need not wait for the previous frame to be drawn
+    const GLsizei STRIDE = CrowdRenderer::INSTANCE_SIZE * sizeof(GLfloat);
+    
+    glBindBuffer(GL_ARRAY_BUFFER, this->instances_);
+    glBufferData(GL_ARRAY_BUFFER, this->data_.size() * sizeof(GLfloat), NULL, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, this->data_.size() * sizeof(GLfloat), this->data_.data());
+    
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, STRIDE, reinterpret_cast<const GLvoid*>(0));
+    this->divisor(1, 1);
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, STRIDE,
+        reinterpret_cast<const GLvoid*>(3 * sizeof(GLfloat)));
+    this->divisor(2, 1);
+    
+    glBindBuffer(GL_ARRAY_BUFFER, this->mesh_);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, reinterpret_cast<const GLvoid*>(0));
+    
+    // Pick the coarsest circle that still looks round
+    size_t level = 0;
+    while ((level + 1 < CrowdRenderer::LEVEL_COUNT) &&
+        (CrowdRenderer::SEGMENTS[level] < 2.0 * M_PI * maxRadius * PIXELS_PER_UNIT / 4.0))
+    {
+        level++;
+    }
+    
+    // Draw all agents at once
+    glUseProgram(this->program_);
+    glDrawArraysInstanced(GL_TRIANGLE_FAN, this->first_[level], CrowdRenderer::SEGMENTS[level] + 2, COUNT);
+    glUseProgram(0);
+    
+    // Leave the state as immediate mode expects it
+    this->divisor(1, 0);
+    this->divisor(2, 0);
+    glDisableVertexAttribArray(0);
+    glDisableVertexAttribArray(1);
+    glDisableVertexAttribArray(2);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    
+}
+
+/*
+    Helpers
+*/
+
+/**
+ * Compiles the shader of the type given as a
+ * parameter from its source, and returns it, or 0
+ * if it does not compile.
+ * 
+ * @param TYPE   - The type of the shader
+ * @param SOURCE - The source of the shader
+ */
+GLuint CrowdRenderer::compile(const GLenum TYPE, const char* const SOURCE) {
+    
+    GLuint shader = glCreateShader(TYPE);
+    glShaderSource(shader, 1, &SOURCE, NULL);
+    glCompileShader(shader);
+    
+    GLint compiled = GL_FALSE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+    if (compiled != GL_TRUE) {
+        glDeleteShader(shader);
+        return 0;
+    }
+    
+    return shader;
+    
+}
+
+/**
+ * Sets the number of instances drawn before the
+ * attribute given as a parameter moves to its next
+ * value, through the core function or its
+ * GL_ARB_instanced_arrays counterpart.
+ * 
+ * @param ATTRIBUTE - The index of the attribute
+ * @param DIVISOR   - The number of instances per value,
+ *                    or 0 for one value per vertex
+ */
+void CrowdRenderer::divisor(const GLuint ATTRIBUTE, const GLuint DIVISOR) const {
+    if (this->arbDivisor_) {
+        glVertexAttribDivisorARB(ATTRIBUTE, DIVISOR);
+    } else {
+        glVertexAttribDivisor(ATTRIBUTE, DIVISOR);
+    }
+}
+
+/**
+ * Computes the colors of the agents, by id relative
+ * to the first one, unless they are already known,
+ * spreading the agents over the color wheel.
+ * 
+ * @param AGENTS - The agents to color
+ */
+void CrowdRenderer::updateColors(const AgentStore& AGENTS) {
+    
+    if (this->colors_.size() == 4 * AGENTS.size()) {
+        return;
+    }
+    
+    const double HUE_OFFSET = 1.0 / AGENTS.size();
+    
+    this->colors_.resize(4 * AGENTS.size());
+    for (size_t k = 0 ; k < AGENTS.size() ; k++) {
+        Color color(k * HUE_OFFSET, 1.0, 1.0, 0.7, false);
+        this->colors_[4 * k + 0] = static_cast<GLfloat>(color.red());
+        this->colors_[4 * k + 1] = static_cast<GLfloat>(color.green());
+        this->colors_[4 * k + 2] = static_cast<GLfloat>(color.blue());
+        this->colors_[4 * k + 3] = static_cast<GLfloat>(color.alpha());
+    }
+    
+}
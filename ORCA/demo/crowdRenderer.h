@@ -0,0 +1,94 @@
+/**
+ * File  : crowdRenderer.h
+ * Author: Raja Soufi
+ * 
+ * Class definition of a renderer drawing all the
+ * agents of a crowd with a single instanced call.
+ * 
+ * Unit circle meshes, with more or fewer segments,
+ * are uploaded once to a vertex buffer. At each
+ * frame, the position, radius and
+ * color of every agent are written to a second
+ * buffer, read once per instance, and a small shader
+ * scales and moves the circle onto each agent. The
+ * fewer segments the agents need to look round on
+ * the screen, the fewer vertices are drawn, which
+ * matters most to software renderers.
+ * 
+ * Instancing needs OpenGL 3.3, or OpenGL 3.1 with
+ * GL_ARB_instanced_arrays, as provided by Mesa's
+ * llvmpipe among others. When neither is available,
+ * supported returns false and the agents must be
+ * drawn in immediate mode instead.
+ */
+
+// Include guard
+#ifndef _CROWD_RENDERER_H_
+#define _CROWD_RENDERER_H_
+
+// Inclusions
+#include <GL/gl.h>
+#include <vector>
+
+#include "../orca/agentStore.h"
+
+// Class definition
+class CrowdRenderer {
+    
+    private:
+    
+    // Constants
+    static const size_t LEVEL_COUNT = 3;
+    static const int SEGMENTS[LEVEL_COUNT];
+    static const size_t INSTANCE_SIZE;
+    static const char* const VERTEX_SHADER;
+    static const char* const FRAGMENT_SHADER;
+    
+    // Attributes
+    bool supported_;
+    bool arbDivisor_;
+    GLuint program_;
+    GLuint mesh_;
+    GLuint instances_;
+    GLint first_[LEVEL_COUNT];
+    
+    std::vector<GLfloat> data_;
+    std::vector<GLfloat> colors_;
+    
+    // Helpers
+    static GLuint compile(const GLenum TYPE, const char* const SOURCE);
+    void divisor(const GLuint ATTRIBUTE, const GLuint DIVISOR) const;
+    void updateColors(const AgentStore& AGENTS);
+    
+    // Non-copyable
+    CrowdRenderer(const CrowdRenderer& THAT);
+    CrowdRenderer& operator=(const CrowdRenderer& THAT);
+    
+    public:
+    
+    // Constructor
+    CrowdRenderer(void);
+    
+    // Getters
+    inline bool supported(void) const;
+    
+    // Other methods
+    bool initialize(void);
+    void draw(const AgentStore& AGENTS, const int FIRST_ID, const double PIXELS_PER_UNIT);
+    
+};
+
+/*
+    Getters
+*/
+
+/**
+ * Tests whether the current OpenGL context can draw
+ * instances, which is only known once initialize
+ * has been called.
+ */
+inline bool CrowdRenderer::supported(void) const {
+    return this->supported_;
+}
+
+#endif // _CROWD_RENDERER_H_
@@ -1,534 +1,694 @@
-/**
- * File  : demo.cpp
- * Author: Raja Soufi
- * 
- * Implementation of the Demo class defined
- * in demo.h.
- */
-
-// Include header file
-#include "demo.h"
-
-/**
- * The width of the screen used for the demo.
- */
-const int Demo::SCREEN_WIDTH = 640;
-
-/**
- * The height of the screen used for the demo.
- */
-const int Demo::SCREEN_HEIGHT = Demo::SCREEN_WIDTH;
-
-/**
- * The zoom factor of the screen used for the demo.
- */
-const double Demo::ZOOM = 0.01;
-
-/**
- * Determines whether the demo is playing or paused.
- */
-volatile bool Demo::paused = false;
-
-/**
- * The speed factor of the demo.
- */
-volatile double Demo::speed = 1.0;
-
-/**
- * Determines whether an agent is being followed.
- */
-bool Demo::following = false;
-
-/**
- * The index of the agent being followed.
- */
-int Demo::followed = 0;
-
-/**
- * A configuration with 10 agents laid out in a
- * circle around the origin.
- * Each agent's destination is the antipode of its
- * initial position on the circle.
- */
-const vector<Agent> Demo::CIRCLE_CONFIGURATION = {
-    Agent(Point( 60.0,   0.0), Point(-60.0,   0.0), 8.0, 20.0),
-    Agent(Point( 48.5,  35.3), Point(-48.5, -35.3), 8.0, 20.0),
-    Agent(Point( 18.5,  57.1), Point(-18.5, -57.1), 8.0, 20.0),
-    Agent(Point(-18.5,  57.1), Point( 18.5, -57.1), 8.0, 20.0),
-    Agent(Point(-48.5,  35.3), Point( 48.5, -35.3), 8.0, 20.0),
-    Agent(Point(-60.0,   0.0), Point( 60.0,   0.0), 8.0, 20.0),
-    Agent(Point(-48.5, -35.3), Point( 48.5,  35.3), 8.0, 20.0),
-    Agent(Point(-18.5, -57.1), Point( 18.5,  57.1), 8.0, 20.0),
-    Agent(Point( 18.5, -57.1), Point(-18.5,  57.1), 8.0, 20.0),
-    Agent(Point( 48.5, -35.3), Point(-48.5,  35.3), 8.0, 20.0)
-};
-
-/**
- * A configuration with 10 agents divided into two
- * groups positioned at either sides of the screen.
- * Each agent's destination is at the opposite side
- * of the screen.
- */
-const vector<Agent> Demo::TWO_LINE_CONFIGURATION = {
-    Agent(Point( 60.0,  80.0), Point(-60.0,  80.0), 8.0, 20.0),
-    Agent(Point( 60.0,  40.0), Point(-60.0,  40.0), 8.0, 20.0),
-    Agent(Point( 60.0,   0.0), Point(-60.0,   0.0), 8.0, 20.0),
-    Agent(Point( 60.0, -40.0), Point(-60.0, -40.0), 8.0, 20.0),
-    Agent(Point( 60.0, -80.0), Point(-60.0, -80.0), 8.0, 20.0),
-    Agent(Point(-60.0,  80.0), Point( 60.0,  80.0), 8.0, 20.0),
-    Agent(Point(-60.0,  40.0), Point( 60.0,  40.0), 8.0, 20.0),
-    Agent(Point(-60.0,   0.0), Point( 60.0,   0.0), 8.0, 20.0),
-    Agent(Point(-60.0, -40.0), Point( 60.0, -40.0), 8.0, 20.0),
-    Agent(Point(-60.0, -80.0), Point( 60.0, -80.0), 8.0, 20.0)
-};
-
-/**
- * A configuration with 4 agents positioned at the
- * corners of a square centered at the origin.
- * Each agent's destination is at the opposite
- * end of the square following the diagonals.
- */
-const vector<Agent> Demo::SQUARE_CONFIGURATION = {
-    Agent(Point(-60.0,  60.0), Point( 60.0, -60.0), 8.0, 20.0),
-    Agent(Point( 60.0, -60.0), Point(-60.0,  60.0), 8.0, 20.0),
-    Agent(Point( 60.0,  60.0), Point(-60.0, -60.0), 8.0, 20.0),
-    Agent(Point(-60.0, -60.0), Point( 60.0,  60.0), 8.0, 20.0)
-};
-
-/**
- * A configuration with 6 agents positioned randomly
- * and with random destinations.
- */
-const vector<Agent> Demo::RANDOM_CONFIGURATION = {
-    Agent(Point(  1.0,   1.0), Point(  0.0,   0.0), 8.0, 20.0),
-    Agent(Point( 60.0,  15.0), Point(-60.0,   0.0), 8.0, 20.0),
-    Agent(Point( 40.0,  -5.0), Point(-20.0,  30.0), 8.0, 20.0),
-    Agent(Point( -5.0, -30.0), Point(-40.0,  50.0), 8.0, 20.0),
-    Agent(Point(-50.0,  15.0), Point( 40.0, -10.0), 8.0, 20.0),
-    Agent(Point(-60.0,   0.0), Point( 60.0,   0.0), 8.0, 20.0)
-};
-
-/**
- * The configuration to use for the demo.
- */
-const vector<Agent>& Demo::CONFIGURATION = Demo::SQUARE_CONFIGURATION;
-
-/*
-    Function definitions
-*/
-
-/**
- * Initialises the drawing configuration.
- */
-void Demo::initDrawing(void) {
-    
-    // Enable blending
-    glEnable(GL_BLEND);
-    
-    // Set blending function.
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    
-    // Set background color
-    glClearColor(0.4f, 0.4f, 0.4f, 1.0f);
-    
-}
-
-/*
-    Drawing functions
-*/
-
-/**
- * Draws a frame to the screen.
- */
-void Demo::draw(void) {
-    
-    // Clear the current window
-    glClear(GL_COLOR_BUFFER_BIT);
-    // Set the matrix mode to modify the modelview matrix
-    glMatrixMode(GL_MODELVIEW);
-    // Initialise the modelview matrix to the identity matrix
-    glLoadIdentity();
-    
-    // If following mode is enabled, then follow an agent
-    if (Demo::following) {
-        Demo::follow(Demo::followed);
-    }
-    
-    const int FIRST_ID = ORCA::agents()[0].id();
-    const double HUE_OFFSET = 1.0 / ORCA::agentCount();
-    
-    // Draw agents
-    for (Agent& agent : ORCA::agents()) {
-        Demo::drawCircle(agent.position(), agent.radius(),
-            Color((agent.id() - FIRST_ID) * HUE_OFFSET, 1.0, 1.0, 0.7, false));
-    }
-    
-    // Draw x/y unit vectors
-    Demo::drawVector(Point(), Vector(1.0, 0.0), Color::RED);
-    Demo::drawVector(Point(), Vector(0.0, 1.0), Color::GREEN);
-    
-    // Swap the back buffer with the front buffer
-    glutSwapBuffers();
-    
-}
-
-/**
- * Follows the agent with index equal to the integer
- * given as a parameter by drawing useful information
- * related to that agent to the screen, such as its
- * maximum speed radius, half-planes in its ORCA
- * domain, its preferred velocity and current
- * velocity, and its destination.
- * 
- * @param INDEX - The index of the agent to follow
- */
-void Demo::follow(const int INDEX) {
-    
-    Agent& agent = ORCA::agents()[INDEX];
-    
-    int i = 0;
-    const double HUE_OFFSET = 1.0 / ORCA::agentCount();
-    
-    vector<HalfPlane> halfPlanes = agent.orca_A(ORCA::agents(), ORCA::tau());
-    
-    // Draw half-planes
-    for (vector<HalfPlane>::iterator halfPlane = halfPlanes.begin() ;
-        halfPlane != halfPlanes.end() ; i++)
-    {
-        if (i != INDEX) {
-            Demo::drawHalfPlane(HalfPlane(halfPlane->normalPosition() + agent.position(),
-                halfPlane->normal()), Color(i * HUE_OFFSET, 1.0, 1.0, 1.0, false));
-            halfPlane++;
-        }
-    }
-    
-    // Draw agent's destination
-    Demo::drawPoint(agent.destination_, Color::WHITE);
-    
-    // Draw vMax circle
-    Demo::drawCircle(agent.position(), agent.maxSpeed_, Color(1.0, 1.0, 1.0, 0.5));
-    
-    // Draw prefVelocity and velocity
-    Demo::drawVector(agent.position(), agent.prefVelocity_, Color::WHITE);
-    Demo::drawVector(agent.position(), agent.velocity(), Color::BLACK);
-    
-}
-
-/**
- * Draws a point in a color given as a parameter.
- * 
- * @param P     - The point to draw
- * @param COLOR - The color to use to draw the point
- */
-void Demo::drawPoint(const Point& P, const Color& COLOR) {
-    
-    glPushMatrix();
-        
-        glPointSize(5.0);
-        glColor4d(COLOR.red(), COLOR.green(), COLOR.blue(), COLOR.alpha());
-        
-        glBegin(GL_POINTS);
-            glVertex2d(P.x(), P.y());
-        glEnd();
-        
-    glPopMatrix();
-    
-}
-
-/**
- * Draws a vector at a specific position in a color
- * given as a parameter.
- * 
- * @param POSITION - The position at which to draw
- *                   the vector
- * @param V        - The vector to draw
- * @param COLOR    - The color to use to draw the
- *                   vector
- */
-void Demo::drawVector(const Point& POSITION, const Vector& V, const Color& COLOR) {
-    
-    double arrowHeadSize = V.norm() / 5.0;
-    
-    glPushMatrix();
-        
-        glLoadIdentity();
-        
-        glTranslatef(POSITION.x(), POSITION.y(), 0.0);
-        glRotatef(V.xAngle() * 180 / M_PI, 0.0, 0.0, 1.0);
-        
-        glColor4d(COLOR.red(), COLOR.green(), COLOR.blue(), COLOR.alpha());
-        
-        glBegin(GL_LINES);
-            glVertex2d(0.0, 0.0);
-            glVertex2d(V.norm(), 0.0);
-            
-            glVertex2d(V.norm(), 0.0);
-            glVertex2d(V.norm() - arrowHeadSize, - 0.5 * arrowHeadSize);
-            
-            glVertex2d(V.norm(), 0.0);
-            glVertex2d(V.norm() - arrowHeadSize, 0.5 * arrowHeadSize);
-        glEnd();
-        
-    glPopMatrix();
-    
-}
-
-/**
- * Draws a circle in a color given as a parameter.
- * 
- * @param POSITION - The position of the center of the
- *                   circle to draw
- * @param RADIUS   - The radius of the circle to draw
- * @param COLOR    - The color to use to draw the
- *                   circle
- */
-void Demo::drawCircle(const Point& POSITION, const double RADIUS, const Color& COLOR) {
-    
-    double rad = 0;
-    
-    glPushMatrix();
-        
-        glLoadIdentity();
-        
-        glTranslated(POSITION.x(), POSITION.y(), 0.0);
-        
-        glColor4d(COLOR.red(), COLOR.green(), COLOR.blue(), COLOR.alpha());
-        
-        glBegin(GL_POLYGON);
-            for (int i = 0 ; i < 36 ; i++) {
-                glVertex2d(RADIUS * cos(rad), RADIUS * sin(rad));
-                rad += 10 * ONE_DEGREE_IN_RADIAN;
-            }
-        glEnd();
-        
-    glPopMatrix();
-    
-}
-
-/**
- * Draws a half-plane in a color given as a parameter.
- * 
- * @param HALF_PLANE - The half-plane to draw
- * @param COLOR      - The color to use to draw the
- *                     half-plane
- */
-void Demo::drawHalfPlane(const HalfPlane& HALF_PLANE, const Color& COLOR) {
-    
-    double x1, y1, x2, y2, x3, y3, x4, y4;
-    
-    double distanceToBoundingLine = 1.0 / Demo::ZOOM;
-    
-    if (HALF_PLANE.boundingLine().isVertical()) {
-        x1 = HALF_PLANE.normalPosition().x();
-        y1 = - distanceToBoundingLine;
-        x2 = x1;
-        y2 = distanceToBoundingLine;
-        x3 = (HALF_PLANE.normal().x() > 0) ? distanceToBoundingLine : - distanceToBoundingLine;
-        y3 = distanceToBoundingLine;
-        x4 = x3;
-        y4 = - distanceToBoundingLine;
-    } else if (HALF_PLANE.boundingLine().isHorizontal()) {
-        x1 = - distanceToBoundingLine;
-        y1 = HALF_PLANE.normalPosition().y();
-        x2 = distanceToBoundingLine;
-        y2 = y1;
-        x3 = distanceToBoundingLine;
-        y3 = (HALF_PLANE.normal().y() > 0) ? distanceToBoundingLine : - distanceToBoundingLine;
-        x4 = - distanceToBoundingLine;
-        y4 = y3;
-    } else {
-        x1 = - distanceToBoundingLine;
-        y1 = HALF_PLANE.boundingLine().getPointAtX(x1).y();
-        x2 = distanceToBoundingLine;
-        y2 = HALF_PLANE.boundingLine().getPointAtX(x2).y();
-        if (HALF_PLANE.normal().y() > 0) {
-            if (HALF_PLANE.normal().x() > 0) {
-                x3 = distanceToBoundingLine;
-                x4 = (y1 < distanceToBoundingLine) ? - distanceToBoundingLine : distanceToBoundingLine;
-            } else {
-                x3 = (y2 < distanceToBoundingLine) ? distanceToBoundingLine : - distanceToBoundingLine;
-                x4 = - distanceToBoundingLine;
-            }
-            y3 = distanceToBoundingLine;
-            y4 = distanceToBoundingLine;
-        } else {
-            if (HALF_PLANE.normal().x() > 0) {
-                x3 = distanceToBoundingLine;
-                x4 = (y1 > - distanceToBoundingLine) ? - distanceToBoundingLine : distanceToBoundingLine;
-            } else {
-                x3 = (y2 > - distanceToBoundingLine) ? distanceToBoundingLine : - distanceToBoundingLine;
-                x4 = - distanceToBoundingLine;
-            }
-            y3 = - distanceToBoundingLine;
-            y4 = - distanceToBoundingLine;
-        }
-    }
-    
-    glPushMatrix();
-        
-        glLoadIdentity();
-        
-        glColor3d(COLOR.red(), COLOR.green(), COLOR.blue());
-        
-        glBegin(GL_LINES);
-            glVertex2d(x1, y1);
-            glVertex2d(x2, y2);
-        glEnd();
-        
-        glColor4d(COLOR.red(), COLOR.green(), COLOR.blue(), 0.1);
-        
-        glBegin(GL_POLYGON);
-            glVertex2d(x1, y1);
-            glVertex2d(x2, y2);
-            glVertex2d(x3, y3);
-            glVertex2d(x4, y4);
-        glEnd();
-        
-        drawVector(HALF_PLANE.normalPosition(), Vector(HALF_PLANE.normal()).normalize(10.0), COLOR);
-        
-    glPopMatrix();
-    
-}
-
-/**
- * Readjusts the viewport and projection when the
- * screen is reshaped.
- * 
- * @param width  - The new width of the screen
- * @param height - The new height of the screen
- */
-void Demo::reshape(int width, int height) {
-    
-    // Set the viewport to be the same width and height as the window
-    glViewport(0, 0, width, height);
-    
-    // Set the matrix mode to modify the projection matrix
-    glMatrixMode(GL_PROJECTION);
-    
-    // Initialise the projection matrix to the identity matrix
-    glLoadIdentity();
-    
-    // Set up the projection
-    gluOrtho2D(-1.0 / Demo::ZOOM, 1.0 / Demo::ZOOM, -1.0 / Demo::ZOOM, 1.0 / Demo::ZOOM);
-    
-    // Redraw the screen
-    glutPostRedisplay();
-    
-}
-
-/**
- * Handles key presses.
- * 
- * @param k - The key that was pressed
- * @param x - The x-position of the mouse when the
- *            key was pressed
- * @param y - The y-position of the mouse when the
- *            key was pressed
- */
-void Demo::key(unsigned char k, int x, int y) {
-    
-    switch (k) {
-        
-        // Pause/Resume the demo
-        case 'p':
-            Demo::paused = !Demo::paused;
-            cout << (Demo::paused ? "Demo paused." : "Demo resumed.") << endl;
-            break;
-        
-        // Slow down the demo
-        case '-':
-            if (Demo::speed > 0.015625) {
-                Demo::speed /= 2.0;
-                cout << "Demo speed decreased to " << Demo::speed << "x." << endl;
-            }
-            break;
-        
-        // Speed up the demo
-        case '=':
-            if (Demo::speed < 16.0) {
-                Demo::speed *= 2.0;
-                cout << "Demo speed increased to " << Demo::speed << "x." << endl;
-            }
-            break;
-        
-        // Start/Stop following agents
-        case 'f':
-            Demo::following = !Demo::following;
-            if (Demo::following) {
-                cout << "Started following agent " << Demo::followed << " from the demo..." << endl;
-            } else {
-                cout << "Stopped following agents." << endl;
-            }
-            // Redraw the screen
-            glutPostRedisplay();
-            break;
-        
-        // Follow previous agent
-        case ',':
-            Demo::followed = (Demo::followed <= 0) ?
-                Demo::CONFIGURATION.size() - 1 : Demo::followed - 1;
-            if (Demo::following) {
-                cout << "Following agent " << Demo::followed << " from the demo..." << endl;
-            }
-            // Redraw the screen
-            glutPostRedisplay();
-            break;
-        
-        // Follow next agent
-        case '.':
-            Demo::followed = (Demo::followed >= Demo::CONFIGURATION.size() - 1) ?
-                0 : Demo::followed + 1;
-            if (Demo::following) {
-                cout << "Following agent " << Demo::followed << " from the demo..." << endl;
-            }
-            // Redraw the screen
-            glutPostRedisplay();
-            break;
-        
-    }
-    
-}
-
-/**
- * Runs when glut is idle.
- */
-void Demo::idle(void) {}
-
-/**/
-
-/**
- * Runs the main loop of the demo.
- */
-void Demo::loop(void) {
-    
-    cout << "Started the ORCA loop." << endl;
-    
-    // While the system hasn't converged yet...
-    while(!ORCA::converged()) {
-        
-        // If the demo is paused, wait
-        while(Demo::paused);
-        
-        // Run a single iteration
-        ORCA::iteration();
-        
-        // Sleep for deltaT time
-        struct timespec sleepTime;
-        sleepTime.tv_sec = 0;
-        sleepTime.tv_nsec = 1000000000L * ORCA::deltaT() / Demo::speed;
-        nanosleep(&sleepTime, NULL);
-        
-        // Move the agents for the waited
-        // deltaT time
-        ORCA::moveAgents(ORCA::deltaT());
-        
-        // Redraw the screen
-        glutPostRedisplay();
-        
-    }
-    
-    cout << "All agents have converged to their final destinations." << endl;
-    
-    ORCA::finalize();
-    
-}
+/**
+ * File  : demo.cpp
+ * Author: Raja Soufi
+ * 
+ * Implementation of the Demo class defined
+ * in demo.h.
+ */
+
+// Include header file
+#include "demo.h"
+
+/**
+ * The width of the screen used for the demo.
+ */
+const int Demo::SCREEN_WIDTH = 640;
+
+/**
+ * The height of the screen used for the demo.
+ */
+const int Demo::SCREEN_HEIGHT = Demo::SCREEN_WIDTH;
+
+/**
+ * The zoom factor of the screen used for the demo.
+ */
+double Demo::zoom = 0.01;
+
+/**
+ * The period at which the renderer looks for a new
+ * snapshot of the agents, in milliseconds.
+ */
+const unsigned int Demo::REFRESH_PERIOD = 16;
+
+/**
+ * The largest number of ORCA steps run between two
+ * snapshots of the agents.
+ */
+const size_t Demo::MAX_STEPS_PER_FRAME = 32;
+
+/**
+ * The maximum slope of the rotation of the preferred
+ * velocities, which keeps the symmetric
+ * configurations of the demo from deadlocking.
+ */
+const double Demo::SKEW = 1e-2;
+
+/**
+ * Determines whether the demo is playing or paused.
+ * Guarded by pauseMutex.
+ */
+bool Demo::paused = false;
+
+/**
+ * The mutex guarding the paused state of the demo.
+ */
+mutex Demo::pauseMutex;
+
+/**
+ * Notified when the demo is resumed.
+ */
+condition_variable Demo::resumed;
+
+/**
+ * The speed factor of the demo.
+ */
+atomic<double> Demo::speed(1.0);
+
+/**
+ * Determines whether the simulated time follows the
+ * real time, or runs as fast as it can.
+ */
+atomic<bool> Demo::throttled(true);
+
+/**
+ * Determines whether an agent is being followed.
+ */
+atomic<bool> Demo::following(false);
+
+/**
+ * The index of the agent being followed.
+ */
+atomic<int> Demo::followed(0);
+
+/**
+ * The snapshots of the agents published by the ORCA
+ * loop and drawn by the renderer.
+ */
+TripleBuffer<Demo::Snapshot> Demo::snapshots;
+
+/**
+ * The renderer drawing all agents at once, if the
+ * OpenGL context supports it.
+ */
+CrowdRenderer Demo::renderer;
+
+/**
+ * A configuration with 10 agents laid out in a
+ * circle around the origin.
+ * Each agent's destination is the antipode of its
+ * initial position on the circle.
+ */
+const vector<Agent> Demo::CIRCLE_CONFIGURATION = {
+    Agent(Point( 60.0,   0.0), Point(-60.0,   0.0), 8.0, 20.0),
+    Agent(Point( 48.5,  35.3), Point(-48.5, -35.3), 8.0, 20.0),
+    Agent(Point( 18.5,  57.1), Point(-18.5, -57.1), 8.0, 20.0),
+    Agent(Point(-18.5,  57.1), Point( 18.5, -57.1), 8.0, 20.0),
+    Agent(Point(-48.5,  35.3), Point( 48.5, -35.3), 8.0, 20.0),
+    Agent(Point(-60.0,   0.0), Point( 60.0,   0.0), 8.0, 20.0),
+    Agent(Point(-48.5, -35.3), Point( 48.5,  35.3), 8.0, 20.0),
+    Agent(Point(-18.5, -57.1), Point( 18.5,  57.1), 8.0, 20.0),
+    Agent(Point( 18.5, -57.1), Point(-18.5,  57.1), 8.0, 20.0),
+    Agent(Point( 48.5, -35.3), Point(-48.5,  35.3), 8.0, 20.0)
+};
+
+/**
+ * A configuration with 10 agents divided into two
+ * groups positioned at either sides of the screen.
+ * Each agent's destination is at the opposite side
+ * of the screen.
+ */
+const vector<Agent> Demo::TWO_LINE_CONFIGURATION = {
+    Agent(Point( 60.0,  80.0), Point(-60.0,  80.0), 8.0, 20.0),
+    Agent(Point( 60.0,  40.0), Point(-60.0,  40.0), 8.0, 20.0),
+    Agent(Point( 60.0,   0.0), Point(-60.0,   0.0), 8.0, 20.0),
+    Agent(Point( 60.0, -40.0), Point(-60.0, -40.0), 8.0, 20.0),
+    Agent(Point( 60.0, -80.0), Point(-60.0, -80.0), 8.0, 20.0),
+    Agent(Point(-60.0,  80.0), Point( 60.0,  80.0), 8.0, 20.0),
+    Agent(Point(-60.0,  40.0), Point( 60.0,  40.0), 8.0, 20.0),
+    Agent(Point(-60.0,   0.0), Point( 60.0,   0.0), 8.0, 20.0),
+    Agent(Point(-60.0, -40.0), Point( 60.0, -40.0), 8.0, 20.0),
+    Agent(Point(-60.0, -80.0), Point( 60.0, -80.0), 8.0, 20.0)
+};
+
+/**
+ * A configuration with 4 agents positioned at the
+ * corners of a square centered at the origin.
+ * Each agent's destination is at the opposite
+ * end of the square following the diagonals.
+ */
+const vector<Agent> Demo::SQUARE_CONFIGURATION = {
+    Agent(Point(-60.0,  60.0), Point( 60.0, -60.0), 8.0, 20.0),
+    Agent(Point( 60.0, -60.0), Point(-60.0,  60.0), 8.0, 20.0),
+    Agent(Point( 60.0,  60.0), Point(-60.0, -60.0), 8.0, 20.0),
+    Agent(Point(-60.0, -60.0), Point( 60.0,  60.0), 8.0, 20.0)
+};
+
+/**
+ * A configuration with 6 agents positioned randomly
+ * and with random destinations.
+ */
+const vector<Agent> Demo::RANDOM_CONFIGURATION = {
+    Agent(Point(  1.0,   1.0), Point(  0.0,   0.0), 8.0, 20.0),
+    Agent(Point( 60.0,  15.0), Point(-60.0,   0.0), 8.0, 20.0),
+    Agent(Point( 40.0,  -5.0), Point(-20.0,  30.0), 8.0, 20.0),
+    Agent(Point( -5.0, -30.0), Point(-40.0,  50.0), 8.0, 20.0),
+    Agent(Point(-50.0,  15.0), Point( 40.0, -10.0), 8.0, 20.0),
+    Agent(Point(-60.0,   0.0), Point( 60.0,   0.0), 8.0, 20.0)
+};
+
+/**
+ * The configuration to use for the demo.
+ */
+const vector<Agent>& Demo::CONFIGURATION = Demo::SQUARE_CONFIGURATION;
+
+/*
+    Function definitions
+*/
+
+/**
+ * Initialises the drawing configuration.
+ */
+void Demo::initDrawing(void) {
+    
+    // Enable blending
+    glEnable(GL_BLEND);
+    
+    // Set blending function.
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    
+    // Set background color
+    glClearColor(0.4f, 0.4f, 0.4f, 1.0f);
+    
+    // Draw the agents with instancing when possible
+    if (Demo::renderer.initialize()) {
+        cout << "Drawing agents with instancing." << endl;
+    } else {
+        cout << "Drawing agents in immediate mode, as instancing is not supported." << endl;
+    }
+    
+}
+
+/**
+ * Sets the zoom factor so that the screen shows the
+ * agents given as a parameter, from their initial
+ * positions to their destinations.
+ * 
+ * @param AGENTS - The agents to show
+ */
+void Demo::fit(const vector<Agent>& AGENTS) {
+    
+    double extent = 0.0;
+    
+    for (const Agent& AGENT : AGENTS) {
+        extent = max(extent, max(fabs(AGENT.position().x()), fabs(AGENT.position().y())) + AGENT.radius());
+        extent = max(extent, max(fabs(AGENT.destination().x()), fabs(AGENT.destination().y())) + AGENT.radius());
+    }
+    
+    if (extent > 0.0) {
+        Demo::zoom = 1.0 / (1.1 * extent);
+    }
+    
+}
+
+/*
+    Drawing functions
+*/
+
+/**
+ * Draws a frame to the screen, from the latest
+ * snapshot of the agents taken over by the renderer.
+ */
+void Demo::draw(void) {
+    
+    const AgentStore& AGENTS = Demo::snapshots.front().agents;
+    
+    // Clear the current window
+    glClear(GL_COLOR_BUFFER_BIT);
+    // Set the matrix mode to modify the modelview matrix
+    glMatrixMode(GL_MODELVIEW);
+    // Initialise the modelview matrix to the identity matrix
+    glLoadIdentity();
+    
+    // If following mode is enabled, then follow an agent
+    if (Demo::following && (static_cast<size_t>(Demo::followed) < AGENTS.size())) {
+        Demo::follow(Demo::followed);
+    }
+    
+    const int FIRST_ID = (AGENTS.size() > 0) ? AGENTS[0].id() : 0;
+    const double HUE_OFFSET = 1.0 / AGENTS.size();
+    
+    // Draw agents, all at once if possible
+    if (Demo::renderer.supported()) {
+        Demo::renderer.draw(AGENTS, FIRST_ID, 0.5 * glutGet(GLUT_WINDOW_WIDTH) * Demo::zoom);
+    } else {
+        for (size_t i = 0 ; i < AGENTS.size() ; i++) {
+            AgentView agent = AGENTS[i];
+            Demo::drawCircle(agent.position(), agent.radius(),
+                Color((agent.id() - FIRST_ID) * HUE_OFFSET, 1.0, 1.0, 0.7, false));
+        }
+    }
+    
+    // Draw x/y unit vectors
+    Demo::drawVector(Point(), Vector(1.0, 0.0), Color::RED);
+    Demo::drawVector(Point(), Vector(0.0, 1.0), Color::GREEN);
+    
+    // Swap the back buffer with the front buffer
+    glutSwapBuffers();
+    
+}
+
+/**
+ * Follows the agent with index equal to the integer
+ * given as a parameter by drawing useful information
+ * related to that agent to the screen, such as its
+ * maximum speed radius, half-planes in its ORCA
+ * domain, its preferred velocity and current
+ * velocity, and its destination.
+ * 
+ * The half-planes are those the solver recorded for
+ * the agent during its last iteration, if it was
+ * already followed then and was not asleep.
+ * 
+ * @param INDEX - The index of the agent to follow
+ */
+void Demo::follow(const int INDEX) {
+    
+    const Snapshot& SNAPSHOT = Demo::snapshots.front();
+    AgentView agent = SNAPSHOT.agents[INDEX];
+    bool infeasible = false;
+    
+    const int FIRST_ID = SNAPSHOT.agents[0].id();
+    const double HUE_OFFSET = 1.0 / SNAPSHOT.agents.size();
+    
+    // Draw half-planes, in white for obstacles and in the
+    // color of the neighbor they come from otherwise
+    for (const AgentDiagnostics& DIAGNOSTICS : SNAPSHOT.diagnostics) {
+        if ((DIAGNOSTICS.index == static_cast<size_t>(INDEX)) && !DIAGNOSTICS.stale) {
+            for (size_t k = 0 ; k < DIAGNOSTICS.halfPlanes.size() ; k++) {
+                const DirectedHalfPlane& HALF_PLANE = DIAGNOSTICS.halfPlanes[k];
+                Color color = (k < DIAGNOSTICS.obstacleCount) ? Color::WHITE :
+                    Color((SNAPSHOT.agents.id(DIAGNOSTICS.neighbors[k - DIAGNOSTICS.obstacleCount]) - FIRST_ID)
+                    * HUE_OFFSET, 1.0, 1.0, 1.0, false);
+                Demo::drawHalfPlane(HalfPlane(Point(HALF_PLANE.point()) + agent.position(),
+                    HALF_PLANE.normal()), color);
+            }
+            infeasible = DIAGNOSTICS.infeasible;
+        }
+    }
+    
+    // Draw agent's destination
+    Demo::drawPoint(agent.destination(), Color::WHITE);
+    
+    // Draw vMax circle, in red if no velocity satisfied
+    // all half-planes
+    Demo::drawCircle(agent.position(), agent.maxSpeed(),
+        infeasible ? Color(1.0, 0.0, 0.0, 0.5) : Color(1.0, 1.0, 1.0, 0.5));
+    
+    // Draw prefVelocity and velocity
+    Demo::drawVector(agent.position(), agent.prefVelocity(), Color::WHITE);
+    Demo::drawVector(agent.position(), agent.velocity(), Color::BLACK);
+    
+}
+
+/**
+ * Draws a point in a color given as a parameter.
+ * 
+ * @param P     - The point to draw
+ * @param COLOR - The color to use to draw the point
+ */
+void Demo::drawPoint(const Point& P, const Color& COLOR) {
+    
+    glPushMatrix();
+        
+        glPointSize(5.0);
+        glColor4d(COLOR.red(), COLOR.green(), COLOR.blue(), COLOR.alpha());
+        
+        glBegin(GL_POINTS);
+            glVertex2d(P.x(), P.y());
+        glEnd();
+        
+    glPopMatrix();
+    
+}
+
+/**
+ * Draws a vector at a specific position in a color
+ * given as a parameter.
+ * 
+ * @param POSITION - The position at which to draw
+ *                   the vector
+ * @param V        - The vector to draw
+ * @param COLOR    - The color to use to draw the
+ *                   vector
+ */
+void Demo::drawVector(const Point& POSITION, const Vector& V, const Color& COLOR) {
+    
+    double arrowHeadSize = V.norm() / 5.0;
+    
+    glPushMatrix();
+        
+        glLoadIdentity();
+        
+        glTranslatef(POSITION.x(), POSITION.y(), 0.0);
+        glRotatef(V.xAngle() * 180 / M_PI, 0.0, 0.0, 1.0);
+        
+        glColor4d(COLOR.red(), COLOR.green(), COLOR.blue(), COLOR.alpha());
+        
+        glBegin(GL_LINES);
+            glVertex2d(0.0, 0.0);
+            glVertex2d(V.norm(), 0.0);
+            
+            glVertex2d(V.norm(), 0.0);
+            glVertex2d(V.norm() - arrowHeadSize, - 0.5 * arrowHeadSize);
+            
+            glVertex2d(V.norm(), 0.0);
+            glVertex2d(V.norm() - arrowHeadSize, 0.5 * arrowHeadSize);
+        glEnd();
+        
+    glPopMatrix();
+    
+}
+
+/**
+ * Draws a circle in a color given as a parameter.
+ * The modelview matrix must be the identity.
+ * 
+ * @param POSITION - The position of the center of the
+ *                   circle to draw
+ * @param RADIUS   - The radius of the circle to draw
+ * @param COLOR    - The color to use to draw the
+ *                   circle
+ */
+void Demo::drawCircle(const Point& POSITION, const double RADIUS, const Color& COLOR) {
+    
+    // The points of the unit circle, every 10 degrees
+    static const vector<Vector> UNIT_CIRCLE = [] {
+        vector<Vector> points;
+        for (int i = 0 ; i < 36 ; i++) {
+            points.push_back(Vector(cos(i * 10 * ONE_DEGREE_IN_RADIAN), sin(i * 10 * ONE_DEGREE_IN_RADIAN)));
+        }
+        return points;
+    }();
+    
+    glColor4d(COLOR.red(), COLOR.green(), COLOR.blue(), COLOR.alpha());
+    
+    glBegin(GL_POLYGON);
+        for (const Vector& POINT : UNIT_CIRCLE) {
+            glVertex2d(POSITION.x() + RADIUS * POINT.x(), POSITION.y() + RADIUS * POINT.y());
+        }
+    glEnd();
+    
+}
+
+/**
+ * Draws a half-plane in a color given as a parameter.
+ * 
+ * @param HALF_PLANE - The half-plane to draw
+ * @param COLOR      - The color to use to draw the
+ *                     half-plane
+ */
+void Demo::drawHalfPlane(const HalfPlane& HALF_PLANE, const Color& COLOR) {
+    
+    double x1, y1, x2, y2, x3, y3, x4, y4;
+    
+    double distanceToBoundingLine = 1.0 / Demo::zoom;
+    
+    if (HALF_PLANE.boundingLine().isVertical()) {
+        x1 = HALF_PLANE.normalPosition().x();
+        y1 = - distanceToBoundingLine;
+        x2 = x1;
+        y2 = distanceToBoundingLine;
+        x3 = (HALF_PLANE.normal().x() > 0) ? distanceToBoundingLine : - distanceToBoundingLine;
+        y3 = distanceToBoundingLine;
+        x4 = x3;
+        y4 = - distanceToBoundingLine;
+    } else if (HALF_PLANE.boundingLine().isHorizontal()) {
+        x1 = - distanceToBoundingLine;
+        y1 = HALF_PLANE.normalPosition().y();
+        x2 = distanceToBoundingLine;
+        y2 = y1;
+        x3 = distanceToBoundingLine;
+        y3 = (HALF_PLANE.normal().y() > 0) ? distanceToBoundingLine : - distanceToBoundingLine;
+        x4 = - distanceToBoundingLine;
+        y4 = y3;
+    } else {
+        x1 = - distanceToBoundingLine;
+        y1 = HALF_PLANE.boundingLine().getPointAtX(x1).y();
+        x2 = distanceToBoundingLine;
+        y2 = HALF_PLANE.boundingLine().getPointAtX(x2).y();
+        if (HALF_PLANE.normal().y() > 0) {
+            if (HALF_PLANE.normal().x() > 0) {
+                x3 = distanceToBoundingLine;
+                x4 = (y1 < distanceToBoundingLine) ? - distanceToBoundingLine : distanceToBoundingLine;
+            } else {
+                x3 = (y2 < distanceToBoundingLine) ? distanceToBoundingLine : - distanceToBoundingLine;
+                x4 = - distanceToBoundingLine;
+            }
+            y3 = distanceToBoundingLine;
+            y4 = distanceToBoundingLine;
+        } else {
+            if (HALF_PLANE.normal().x() > 0) {
+                x3 = distanceToBoundingLine;
+                x4 = (y1 > - distanceToBoundingLine) ? - distanceToBoundingLine : distanceToBoundingLine;
+            } else {
+                x3 = (y2 > - distanceToBoundingLine) ? distanceToBoundingLine : - distanceToBoundingLine;
+                x4 = - distanceToBoundingLine;
+            }
+            y3 = - distanceToBoundingLine;
+            y4 = - distanceToBoundingLine;
+        }
+    }
+    
+    glPushMatrix();
+        
+        glLoadIdentity();
+        
+        glColor3d(COLOR.red(), COLOR.green(), COLOR.blue());
+        
+        glBegin(GL_LINES);
+            glVertex2d(x1, y1);
+            glVertex2d(x2, y2);
+        glEnd();
+        
+        glColor4d(COLOR.red(), COLOR.green(), COLOR.blue(), 0.1);
+        
+        glBegin(GL_POLYGON);
+            glVertex2d(x1, y1);
+            glVertex2d(x2, y2);
+            glVertex2d(x3, y3);
+            glVertex2d(x4, y4);
+        glEnd();
+        
+        drawVector(HALF_PLANE.normalPosition(), Vector(HALF_PLANE.normal()).normalize(10.0), COLOR);
+        
+    glPopMatrix();
+    
+}
+
+/**
+ * Readjusts the viewport and projection when the
+ * screen is reshaped.
+ * 
+ * @param width  - The new width of the screen
+ * @param height - The new height of the screen
+ */
+void Demo::reshape(int width, int height) {
+    
+    // Set the viewport to be the same width and height as the window
+    glViewport(0, 0, width, height);
+    
+    // Set the matrix mode to modify the projection matrix
+    glMatrixMode(GL_PROJECTION);
+    
+    // Initialise the projection matrix to the identity matrix
+    glLoadIdentity();
+    
+    // Set up the projection
+    gluOrtho2D(-1.0 / Demo::zoom, 1.0 / Demo::zoom, -1.0 / Demo::zoom, 1.0 / Demo::zoom);
+    
+    // Redraw the screen
+    glutPostRedisplay();
+    
+}
+
+/**
+ * Handles key presses.
+ * 
+ * @param k - The key that was pressed
+ * @param x - The x-position of the mouse when the
+ *            key was pressed
+ * @param y - The y-position of the mouse when the
+ *            key was pressed
+ */
+void Demo::key(unsigned char k, int x, int y) {
+    
+    switch (k) {
+        
+        // Pause/Resume the demo
+        case 'p': {
+            lock_guard<mutex> lock(Demo::pauseMutex);
+            Demo::paused = !Demo::paused;
+            Demo::resumed.notify_all();
+            cout << (Demo::paused ? "Demo paused." : "Demo resumed.") << endl;
+            break;
+        }
+        
+        // Slow down the demo
+        case '-':
+            if (Demo::speed > 0.015625) {
+                Demo::speed = Demo::speed / 2.0;
+                cout << "Demo speed decreased to " << Demo::speed << "x." << endl;
+            }
+            break;
+        
+        // Speed up the demo
+        case '=':
+            if (Demo::speed < 16.0) {
+                Demo::speed = Demo::speed * 2.0;
+                cout << "Demo speed increased to " << Demo::speed << "x." << endl;
+            }
+            break;
+        
+        // Throttle/Unthrottle the demo
+        case 'u':
+            Demo::throttled = !Demo::throttled;
+            cout << (Demo::throttled ? "Demo throttled to real time." :
+                "Demo unthrottled, running as fast as possible.") << endl;
+            break;
+            
+        // Start/Stop following agents
+        case 'f':
+            Demo::following = !Demo::following;
+            if (Demo::following) {
+                cout << "Started following agent " << Demo::followed << " from the demo..." << endl;
+            } else {
+                cout << "Stopped following agents." << endl;
+            }
+            // Redraw the screen
+            glutPostRedisplay();
+            break;
+        
+        // Follow previous agent
+        case ',':
+            Demo::followed = (Demo::followed <= 0) ?
+                Demo::snapshots.front().agents.size() - 1 : Demo::followed - 1;
+            if (Demo::following) {
+                cout << "Following agent " << Demo::followed << " from the demo..." << endl;
+            }
+            // Redraw the screen
+            glutPostRedisplay();
+            break;
+        
+        // Follow next agent
+        case '.':
+            Demo::followed = (Demo::followed + 1 >= static_cast<int>(Demo::snapshots.front().agents.size())) ?
+                0 : Demo::followed + 1;
+            if (Demo::following) {
+                cout << "Following agent " << Demo::followed << " from the demo..." << endl;
+            }
+            // Redraw the screen
+            glutPostRedisplay();
+            break;
+        
+    }
+    
+}
+
+/**
+ * Redraws the screen if the ORCA loop published a
+ * new snapshot of the agents since the last frame,
+ * then schedules itself again. Polling on a timer
+ * rather than from the idle function keeps the
+ * renderer from spinning while nothing changes.
+ * 
+ * @param value - Unused
+ */
+void Demo::refresh(int /* value */) {
+    
+    if (Demo::snapshots.update()) {
+        glutPostRedisplay();
+    }
+    
+    glutTimerFunc(Demo::REFRESH_PERIOD, Demo::refresh, 0);
+    
+}
+
+/**
+ * Publishes a copy of the current state of the
+ * agents, and of the diagnostics of the last
+ * iteration, for the renderer to draw. Must only be
+ * called by the thread running the ORCA loop, or
+ * before it starts.
+ */
+void Demo::publish(void) {
+    Demo::snapshots.back().agents = ORCA::agentsView();
+    Demo::snapshots.back().diagnostics = ORCA::diagnostics();
+    Demo::snapshots.publish();
+}
+
+/**
+ * Runs the main loop of the demo. A scheduler
+ * decides how many steps of deltaT to run per frame
+ * for the simulated time to keep pace with the real
+ * time, whatever the time the steps take.
+ */
+void Demo::loop(void) {
+    
+    Scheduler scheduler(ORCA::deltaT(), Demo::REFRESH_PERIOD / 1000.0, Demo::MAX_STEPS_PER_FRAME);
+    bool converged = ORCA::converged();
+    bool behind = false;
+    int diagnosed = -1;
+    
+    cout << "Started the ORCA loop." << endl;
+    
+    // While the system hasn't converged yet...
+    while(!converged) {
+        
+        // If the demo is paused, wait until it is resumed,
+        // without catching up with the time spent paused
+        {
+            unique_lock<mutex> lock(Demo::pauseMutex);
+            if (Demo::paused) {
+                Demo::resumed.wait(lock, [] { return !Demo::paused; });
+                scheduler.reset();
+            }
+        }
+        
+        scheduler.setSpeed(Demo::speed);
+        scheduler.setThrottled(Demo::throttled);
+        
+        // Have the solver record the half-planes of the
+        // followed agent, if any
+        const int FOLLOWED = Demo::following ? Demo::followed.load() : -1;
+        if (FOLLOWED != diagnosed) {
+            diagnosed = FOLLOWED;
+            ORCA::setDiagnosed((diagnosed >= 0) ? vector<size_t>(1, diagnosed) : vector<size_t>());
+        }
+        
+        // Wait for the next frame, then run the iterations
+        // it is due, moving the agents by deltaT each time
+        const size_t STEPS = scheduler.nextFrame();
+        
+        for (size_t i = 0 ; (i < STEPS) && !converged ; i++) {
+            ORCA::iteration();
+            ORCA::moveAgents(ORCA::deltaT());
+            converged = ORCA::converged();
+        }
+        
+        // Report when the demo starts falling behind real time
+        if (scheduler.behind() && !behind) {
+            cout << "Demo falling behind real time, " << scheduler.droppedSteps()
+                << " steps dropped so far." << endl;
+        }
+        behind = scheduler.behind();
+        
+        // Hand the new positions over to the renderer
+        Demo::publish();
+        
+    }
+    
+    cout << "All agents have converged to their final destinations." << endl;
+    
+    ORCA::finalize();
+    
+}
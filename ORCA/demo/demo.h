@@ -1,88 +1,119 @@
-/**
- * File  : demo.h
- * Author: Raja Soufi
- * 
- * Class definition of the Demo class.
- */
-
- // Include guard
-#ifndef _DEMO_H_
-#define _DEMO_H_
-
-// Inclusions
-#include <ctime>
-#include <GL/glut.h>
-#include <iostream>
-
-#include "../geom/halfPlane.h"
-#include "../geom/line.h"
-#include "../geom/point.h"
-#include "../geom/vector.h"
-
-#include "../orca/agent.h"
-#include "../orca/orca.h"
-
-#include "../utilities/utilities.h"
-
-#include "color.h"
-
-// Open std namespace
-using namespace std;
-
-// Class definition
-class Demo {
-    
-    private:
-    
-    // Constructor
-    Demo(void);
-    
-    public:
-    
-    // Attributes
-    static const int SCREEN_HEIGHT;
-    static const int SCREEN_WIDTH;
-    static const double ZOOM;
-    
-    static volatile bool paused;
-    static volatile double speed;
-    
-    static bool following;
-    static int followed;
-    
-    // Configurations
-    static const vector<Agent> CIRCLE_CONFIGURATION;
-    static const vector<Agent> TWO_LINE_CONFIGURATION;
-    static const vector<Agent> SQUARE_CONFIGURATION;
-    static const vector<Agent> RANDOM_CONFIGURATION;
-    
-    static const vector<Agent>& CONFIGURATION;
-    
-    // Methods
-    
-    // Drawing initialiser
-    static void initDrawing(void);
-    
-    // Drawing functions
-    static void draw(void);
-    static void follow(const int INDEX);
-    static void drawPoint(const Point& P, const Color& COLOR);
-    static void drawVector(const Point& POSITION, const Vector& V, const Color& COLOR);
-    static void drawCircle(const Point& POSITION, const double RADIUS, const Color& COLOR);
-    static void drawHalfPlane(const HalfPlane& HALF_PLANE, const Color& COLOR);
-    
-    // Window resize handler
-    static void reshape(int width, int height);
-    
-    // Keypress handler
-    static void key(unsigned char k, int x, int y);
-    
-    // Idle function
-    static void idle(void);
-    
-    // ORCA methods
-    static void loop(void);
-    
-};
-
-#endif // _DEMO_H_
+/**
+ * File  : demo.h
+ * Author: Raja Soufi
+ * 
+ * Class definition of the Demo class.
+ * 
+ * The ORCA loop runs on its own thread and, after
+ * each frame, publishes a copy of the agents through
+ * a triple buffer, along with the half-planes the
+ * solver built for the followed agent. The renderer
+ * only ever draws the latest copy it took over, so
+ * that neither thread waits for the other.
+ */
+
+ // Include guard
+#ifndef _DEMO_H_
+#define _DEMO_H_
+
+// Inclusions
+#include <atomic>
+#include <condition_variable>
+#include <GL/glut.h>
+#include <iostream>
+#include <mutex>
+
+#include "../geom/halfPlane.h"
+#include "../geom/line.h"
+#include "../geom/point.h"
+#include "../geom/vector.h"
+
+#include "../orca/agent.h"
+#include "../orca/agentStore.h"
+#include "../orca/orca.h"
+
+#include "../utilities/scheduler.h"
+#include "../utilities/tripleBuffer.h"
+#include "../utilities/utilities.h"
+
+#include "color.h"
+#include "crowdRenderer.h"
+
+// Open std namespace
+using namespace std;
+
+// Class definition
+class Demo {
+    
+    private:
+    
+    // Constructor
+    Demo(void);
+    
+    public:
+    
+    // A copy of the state of the simulation, handed
+    // over to the renderer
+    struct Snapshot {
+        AgentStore agents;
+        vector<AgentDiagnostics> diagnostics;
+    };
+    
+    // Attributes
+    static const int SCREEN_HEIGHT;
+    static const int SCREEN_WIDTH;
+    static double zoom;
+    static const unsigned int REFRESH_PERIOD;
+    static const size_t MAX_STEPS_PER_FRAME;
+    static const double SKEW;
+    
+    static bool paused;
+    static mutex pauseMutex;
+    static condition_variable resumed;
+    static atomic<double> speed;
+    static atomic<bool> throttled;
+    
+    static atomic<bool> following;
+    static atomic<int> followed;
+    
+    static TripleBuffer<Snapshot> snapshots;
+    static CrowdRenderer renderer;
+    
+    // Configurations
+    static const vector<Agent> CIRCLE_CONFIGURATION;
+    static const vector<Agent> TWO_LINE_CONFIGURATION;
+    static const vector<Agent> SQUARE_CONFIGURATION;
+    static const vector<Agent> RANDOM_CONFIGURATION;
+    
+    static const vector<Agent>& CONFIGURATION;
+    
+    // Methods
+    
+    // Drawing initialisers
+    static void initDrawing(void);
+    static void fit(const vector<Agent>& AGENTS);
+    
+    // Drawing functions
+    static void draw(void);
+    static void follow(const int INDEX);
+    static void drawPoint(const Point& P, const Color& COLOR);
+    static void drawVector(const Point& POSITION, const Vector& V, const Color& COLOR);
+    static void drawCircle(const Point& POSITION, const double RADIUS, const Color& COLOR);
+    static void drawHalfPlane(const HalfPlane& HALF_PLANE, const Color& COLOR);
+    
+    // Window resize handler
+    static void reshape(int width, int height);
+    
+    // Keypress handler
+    static void key(unsigned char k, int x, int y);
+    
+    // Refresh timer
+    static void refresh(int value);
+    
+    // ORCA methods
+    static void publish(void);
+    static void loop(void);
+    
+};
+
+#endif // _DEMO_H_
@@ -0,0 +1,175 @@
+/**
+ * File  : directedHalfPlane.h
+ * Author: Raja Soufi
+ * 
+ * Class definition of a half-plane in 2D space given
+ * by a directed bounding line, the half-plane itself
+ * being the half of the 2D plane on the left of that
+ * line. The line is stored as one of its points and
+ * a unit direction, which makes this representation
+ * more compact than HalfPlane and free of the special
+ * cases of vertical lines. Points on the bounding
+ * line are considered to be included in the area of
+ * the half-plane.
+ * 
+ * The coordinates are of the scalar type T, which
+ * is either float or double. DirectedHalfPlane is
+ * the double precision version. It is trivially
+ * copyable, laid out as its point and direction, and
+ * entirely defined in this header.
+ */
+
+// Include guard
+#ifndef _DIRECTED_HALF_PLANE_H_
+#define _DIRECTED_HALF_PLANE_H_
+
+// Inclusions
+#include <type_traits>
+
+#include "halfPlane.h"
+#include "point.h"
+#include "vector.h"
+
+// Class definition
+template <typename T>
+class BasicDirectedHalfPlane {
+    
+    private:
+    
+    // Attributes
+    BasicVector<T> point_;
+    BasicVector<T> direction_;
+    
+    public:
+    
+    // Constructors
+    constexpr BasicDirectedHalfPlane(void);
+    inline BasicDirectedHalfPlane(const BasicVector<T>& POINT, const BasicVector<T>& DIRECTION);
+    inline explicit BasicDirectedHalfPlane(const BasicHalfPlane<T>& THAT);
+    
+    // Getters
+    constexpr const BasicVector<T>& point(void) const;
+    constexpr const BasicVector<T>& direction(void) const;
+    constexpr BasicVector<T> normal(void) const;
+    
+    // Other methods
+    constexpr T violation(const BasicVector<T>& V) const;
+    constexpr bool contains(const BasicVector<T>& V) const;
+    
+};
+
+// Precisions
+typedef BasicDirectedHalfPlane<float> DirectedHalfPlaneF;
+typedef BasicDirectedHalfPlane<double> DirectedHalfPlane;
+
+// Layout
+static_assert(std::is_trivially_copyable<DirectedHalfPlaneF>::value &&
+    std::is_trivially_copyable<DirectedHalfPlane>::value, "A directed half-plane must be trivially copyable");
+static_assert((sizeof(DirectedHalfPlaneF) == 4 * sizeof(float)) && (sizeof(DirectedHalfPlane) == 4 * sizeof(double)),
+    "A directed half-plane must be laid out as its point and direction");
+    
+/*
+    Constructors
+*/
+
+/**
+ * Constructs a half-plane equivalent to the plane
+ * defined by the inequation y > 0.
+ */
+template <typename T>
+constexpr BasicDirectedHalfPlane<T>::BasicDirectedHalfPlane(void) : point_(), direction_(1, 0) {}
+
+/**
+ * Constructs a half-plane bounded by the line going
+ * through the point given as a parameter in the
+ * direction given as a parameter, which does not
+ * need to be normalized.
+ * 
+ * @param POINT     - A point of the bounding line of
+ *                    the new half-plane
+ * @param DIRECTION - The direction of the bounding line
+ *                    of the new half-plane
+ */
+template <typename T>
+inline BasicDirectedHalfPlane<T>::BasicDirectedHalfPlane(const BasicVector<T>& POINT, const BasicVector<T>& DIRECTION) :
+    point_(POINT), direction_(DIRECTION)
+{
+    if (this->direction_ == 0.0) {
+        this->direction_ = BasicVector<T>(1, 0);
+    }
+    this->direction_.normalize();
+}
+
+/**
+ * Constructs a half-plane representing the same area
+ * as the half-plane given as a parameter.
+ * 
+ * @param THAT - The half-plane to convert
+ */
+template <typename T>
+inline BasicDirectedHalfPlane<T>::BasicDirectedHalfPlane(const BasicHalfPlane<T>& THAT) :
+    BasicDirectedHalfPlane(BasicVector<T>(THAT.normalPosition()),
+        BasicVector<T>(THAT.normal().y(), - THAT.normal().x())) {}
+        
+/*
+    Getters
+*/
+
+/**
+ * Returns a point of the bounding line of this
+ * half-plane, as a vector from the origin.
+ */
+template <typename T>
+constexpr const BasicVector<T>& BasicDirectedHalfPlane<T>::point(void) const {
+    return this->point_;
+}
+
+/**
+ * Returns the unit direction of the bounding line
+ * of this half-plane.
+ */
+template <typename T>
+constexpr const BasicVector<T>& BasicDirectedHalfPlane<T>::direction(void) const {
+    return this->direction_;
+}
+
+/**
+ * Returns the unit normal of this half-plane,
+ * pointing inside of it.
+ */
+template <typename T>
+constexpr BasicVector<T> BasicDirectedHalfPlane<T>::normal(void) const {
+    return BasicVector<T>(- this->direction_.y(), this->direction_.x());
+}
+
+/*
+    Other methods
+*/
+
+/**
+ * Returns the signed distance by which the point
+ * given as a parameter lies outside of this
+ * half-plane, which is negative if the point lies
+ * inside of it.
+ * 
+ * @param V - The point to test, as a vector from
+ *            the origin
+ */
+template <typename T>
+constexpr T BasicDirectedHalfPlane<T>::violation(const BasicVector<T>& V) const {
+    return this->direction_.cross(this->point_ - V);
+}
+
+/**
+ * Tests whether this half-plane contains the point
+ * given as a parameter.
+ * 
+ * @param V - The point to test, as a vector from
+ *            the origin
+ */
+template <typename T>
+constexpr bool BasicDirectedHalfPlane<T>::contains(const BasicVector<T>& V) const {
+    return this->violation(V) <= 0;
+}
+
+#endif // _DIRECTED_HALF_PLANE_H_
@@ -1,128 +1,184 @@
-/**
- * File  : halfPlane.h
- * Author: Raja Soufi
- * 
- * Class definition of a half-plane in 2D space.
- * A half-plane is defined by a line, the half-plane
- * itself being one of the two halves of the 2D plane
- * split by that line. Which particular half is
- * represented by this half-plane is specified by the
- * normal vector. Points on the bounding line are
- * considered to be included in the area of the
- * half-plane.
- */
-
-// Include guard
-#ifndef _HALF_PLANE_H_
-#define _HALF_PLANE_H_
-
-// Inclusions
-#include "../utilities/utilities.h"
-
-#include "line.h"
-#include "point.h"
-#include "vector.h"
-
-// Class definition
-class HalfPlane {
-    
-    private:
-    
-    // Attributes
-    Point normalPosition_;
-    Vector normal_;
-    Line boundingLine_;
-    
-    public:
-    
-    // Constructors
-    HalfPlane(void);
-    HalfPlane(const Point& NORMAL_POSITION, const Vector& NORMAL);
-    HalfPlane(const HalfPlane& THAT);
-    
-    // Destructor
-    ~HalfPlane(void);
-    
-    // Getters
-    inline const Point& normalPosition(void) const;
-    inline const Vector& normal(void) const;
-    inline const Line& boundingLine(void) const;
-    
-    // Other methods
-    inline bool contains(const Point& P) const;
-    
-    // Operators
-    inline bool operator==(const HalfPlane& THAT) const;
-    inline bool operator!=(const HalfPlane& THAT) const;
-    
-};
-
-/*
-    Getters
-*/
-
-/**
- * Returns the starting point of the normal of this
- * half-plane.
- */
-inline const Point& HalfPlane::normalPosition(void) const {
-    return this->normalPosition_;
-}
-
-/**
- * Returns the normal of this half-plane.
- */
-inline const Vector& HalfPlane::normal(void) const {
-    return this->normal_;
-}
-
-/**
- * Returns the bounding line of this half-plane.
- */
-inline const Line& HalfPlane::boundingLine(void) const {
-    return this->boundingLine_;
-}
-
-/*
-    Other methods
-*/
-
-/**
- * Tests whether this half-plane contains the point
- * given as a parameter.
- * 
- * @param P - The point to test with this half-plane
- */
-inline bool HalfPlane::contains(const Point& P) const {
-    return P.from(this->normalPosition_) * this->normal_ >= 0;
-}
-
-/*
-    Operators
-*/
-
-/**
- * Tests whether this half-plane is equal to the
- * half-plane given as a parameter, in the sense that
- * they represent the exact same area.
- * 
- * @param THAT - The half-plane to compare to this
- *               half-plane
- */
-inline bool HalfPlane::operator==(const HalfPlane& THAT) const {
-    return this->boundingLine_ == THAT.boundingLine();
-}
-
-/**
- * Tests whether this half-plane is different from the
- * half-plane given as a parameter, in the sense that
- * the areas they represent are not exactly the same.
- * 
- * @param THAT - The half-plane to compare to this
- *               half-plane
- */
-inline bool HalfPlane::operator!=(const HalfPlane& THAT) const {
-    return !(*this == THAT);
-}
-
-#endif // _HALF_PLANE_H_
+/**
+ * File  : halfPlane.h
+ * Author: Raja Soufi
+ * 
+ * Class definition of a half-plane in 2D space.
+ * A half-plane is defined by a line, the half-plane
+ * itself being one of the two halves of the 2D plane
+ * split by that line. Which particular half is
+ * represented by this half-plane is specified by the
+ * normal vector. Points on the bounding line are
+ * considered to be included in the area of the
+ * half-plane.
+ * 
+ * The coordinates are of the scalar type T, which
+ * is either float or double. HalfPlane is the
+ * double precision version. It is trivially copyable
+ * and entirely defined in this header.
+ */
+
+// Include guard
+#ifndef _HALF_PLANE_H_
+#define _HALF_PLANE_H_
+
+// Inclusions
+#include <type_traits>
+
+#include "../utilities/utilities.h"
+
+#include "line.h"
+#include "point.h"
+#include "vector.h"
+
+// Class definition
+template <typename T>
+class BasicHalfPlane {
+    
+    private:
+    
+    // Attributes
+    BasicPoint<T> normalPosition_;
+    BasicVector<T> normal_;
+    BasicLine<T> boundingLine_;
+    
+    public:
+    
+    // Constructors
+    constexpr BasicHalfPlane(void);
+    inline BasicHalfPlane(const BasicPoint<T>& NORMAL_POSITION, const BasicVector<T>& NORMAL);
+    
+    // Getters
+    constexpr const BasicPoint<T>& normalPosition(void) const;
+    constexpr const BasicVector<T>& normal(void) const;
+    constexpr const BasicLine<T>& boundingLine(void) const;
+    
+    // Other methods
+    constexpr bool contains(const BasicPoint<T>& P) const;
+    
+    // Operators
+    constexpr bool operator==(const BasicHalfPlane& THAT) const;
+    constexpr bool operator!=(const BasicHalfPlane& THAT) const;
+    
+};
+
+// Precisions
+typedef BasicHalfPlane<float> HalfPlaneF;
+typedef BasicHalfPlane<double> HalfPlane;
+
+// Layout
+static_assert(std::is_trivially_copyable<HalfPlaneF>::value && std::is_trivially_copyable<HalfPlane>::value,
+    "A half-plane must be trivially copyable");
+    
+/*
+    Constructors
+*/
+
+/**
+ * Constructs a half-plane equivalent to the plane
+ * defined by the inequation x > 0.
+ */
+template <typename T>
+constexpr BasicHalfPlane<T>::BasicHalfPlane(void) : normalPosition_(), normal_(0, 1), boundingLine_() {}
+
+/**
+ * Constructs a half-plane with a normal position and
+ * normal equal to the ones given as parameters.
+ * 
+ * @param NORMAL_POSITION - The position of the normal of the
+ *                          new half-plane
+ * @param NORMAL          - The normal of the new half-plane
+ */
+template <typename T>
+inline BasicHalfPlane<T>::BasicHalfPlane(const BasicPoint<T>& NORMAL_POSITION, const BasicVector<T>& NORMAL) :
+    normalPosition_(NORMAL_POSITION)
+{
+    this->normal_ = (NORMAL.norm() == 0) ? BasicVector<T>(0, 1) : NORMAL;
+    T slope, intercept;
+    // Vertical line
+    if (this->normal_.y() == 0) {
+        slope = DOUBLE_INFINITY;
+        intercept = NORMAL_POSITION.x();
+    }
+    // Non-vertical line
+    else {
+        slope = -this->normal_.x() / this->normal_.y();
+        intercept = NORMAL_POSITION.y() - NORMAL_POSITION.x() * slope;
+    }
+    this->boundingLine_ = BasicLine<T>(slope, intercept);
+}
+
+/*
+    Getters
+*/
+
+/**
+ * Returns the starting point of the normal of this
+ * half-plane.
+ */
+template <typename T>
+constexpr const BasicPoint<T>& BasicHalfPlane<T>::normalPosition(void) const {
+    return this->normalPosition_;
+}
+
+/**
+ * Returns the normal of this half-plane.
+ */
+template <typename T>
+constexpr const BasicVector<T>& BasicHalfPlane<T>::normal(void) const {
+    return this->normal_;
+}
+
+/**
+ * Returns the bounding line of this half-plane.
+ */
+template <typename T>
+constexpr const BasicLine<T>& BasicHalfPlane<T>::boundingLine(void) const {
+    return this->boundingLine_;
+}
+
+/*
+    Other methods
+*/
+
+/**
+ * Tests whether this half-plane contains the point
+ * given as a parameter.
+ * 
+ * @param P - The point to test with this half-plane
+ */
+template <typename T>
+constexpr bool BasicHalfPlane<T>::contains(const BasicPoint<T>& P) const {
+    return P.from(this->normalPosition_) * this->normal_ >= 0;
+}
+
+/*
+    Operators
+*/
+
+/**
+ * Tests whether this half-plane is equal to the
+ * half-plane given as a parameter, in the sense that
+ * they represent the exact same area.
+ * 
+ * @param THAT - The half-plane to compare to this
+ *               half-plane
+ */
+template <typename T>
+constexpr bool BasicHalfPlane<T>::operator==(const BasicHalfPlane& THAT) const {
+    return this->boundingLine_ == THAT.boundingLine();
+}
+
+/**
+ * Tests whether this half-plane is different from the
+ * half-plane given as a parameter, in the sense that
+ * the areas they represent are not exactly the same.
+ * 
+ * @param THAT - The half-plane to compare to this
+ *               half-plane
+ */
+template <typename T>
+constexpr bool BasicHalfPlane<T>::operator!=(const BasicHalfPlane& THAT) const {
+    return !(*this == THAT);
+}
+
+#endif // _HALF_PLANE_H_
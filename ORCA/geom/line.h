@@ -1,189 +1,396 @@
-/**
- * File  : line.h
- * Author: Raja Soufi
- * 
- * Class definition of a line in 2D space:
- * 
- *     ################################
- *     #  y = slope * x + yIntercept  #
- *     ################################
- * 
- * In case of a vertical line, slope is set to
- * std::numeric_limits<double>::infinity().
- * 
- * A line also has a yIntercept and xIntercept that
- * are set to 0.0 in cases where they are not defined
- * (vertical line or horizontal line respectively).
- * Since a line's yIntercept and xIntercept can still
- * be valid and equal to 0.0, one should first test
- * whether a line is vertical/horizontal before in
- * order to determine whether these variables are
- * valid.
- */
-
-// Include guard
-#ifndef _LINE_H_
-#define _LINE_H_
-
-// Inclusions
-#include "../utilities/exceptions.h"
-#include "../utilities/utilities.h"
-
-#include "point.h"
-
-// Forward-declarations
-class Point;
-
-// Class definition
-class Line {
-    
-    private:
-    
-    // Attributes
-    double slope_, yIntercept_, xIntercept_;
-    
-    public:
-    
-    // Constructors
-    Line(void);
-    Line(const double SLOPE, const double INTERCEPT);
-    Line(const double X_ANGLE);
-    Line(const Point& P1, const Point& P2);
-    Line(const Point& P);
-    Line(const Line& THAT, const Point& P);
-    Line(const Line& THAT);
-    
-    // Destructor
-    ~Line(void);
-    
-    // Getters
-    inline double slope(void) const;
-    inline double yIntercept(void) const;
-    inline double xIntercept(void) const;
-    
-    // Other methods
-    inline double xAngle(void) const;
-    
-    inline bool isVertical(void) const;
-    inline bool isHorizontal(void) const;
-    bool contains(const Point& P) const;
-    
-    inline Line rotated(const double ANGLE) const;
-    
-    Point intersect(const Line& THAT) const;
-    Point getPointAtX(const double X) const;
-    Point getPointAtY(const double Y) const;
-    
-    // Operators
-    inline bool operator==(const Line& THAT) const;
-    inline bool operator!=(const Line& THAT) const;
-    inline bool operator||(const Line& THAT) const;
-    
-};
-
-/*
-    Getters
-*/
-
-/**
- * Returns the slope of this line.
- */
-inline double Line::slope(void) const {
-    return this->slope_;
-}
-
-/**
- * Returns the y-intercept of this line.
- * Returns 0.0 when this line is vertical.
- */
-inline double Line::yIntercept(void) const {
-    return this->yIntercept_;
-}
-
-/**
- * Returns the y-intercept of this line.
- * Returns 0.0 when this line is vertical.
- */
-inline double Line::xIntercept(void) const {
-    return this->xIntercept_;
-}
-
-/*
-    Other methods
-*/
-
-/**
- * Returns the angle that this line makes
- * with the x-axis.
- */
-inline double Line::xAngle(void) const {
-    return trueMod(atan(this->slope_), M_PI);
-}
-
-
-/**
- * Tests whether this line is vertical.
- */
-inline bool Line::isVertical(void) const {
-    return this->slope_ == DOUBLE_INFINITY;
-}
-
-/**
- * Tests whether this line is horizontal.
- */
-inline bool Line::isHorizontal(void) const {
-    return this->slope_ == 0;
-}
-
-
-/**
- * Returns a new line which is equivalent to this
- * line rotated by the angle given as a parameter.
- * 
- * @param ANGLE - The angle by which to rotate this
- *                line
- */
-inline Line Line::rotated(const double ANGLE) const {
-    return Line(this->xAngle() + ANGLE);
-}
-
-/*
-    Operators
-*/
-
-/**
- * Tests whether this line is equal to the line
- * given as a parameter, in the sense that their
- * respective slopes and intercepts are equal.
- * 
- * @param THAT - The line to compare to this line
- */
-inline bool Line::operator==(const Line& THAT) const {
-    return (this->slope_ == THAT.slope()) &&
-        (((this->slope_ == DOUBLE_INFINITY) && (this->xIntercept_ == THAT.xIntercept())) ||
-        (this->yIntercept_ == THAT.yIntercept()));
-}
-
-/**
- * Tests whether this line is different from the line
- * given as a parameter, in the sense that either
- * their slopes are different or one of their respective
- * intercepts are different.
- * 
- * @param THAT - The line to compare to this line
- */
-inline bool Line::operator!=(const Line& THAT) const {
-    return !(*this == THAT);
-}
-
-/**
- * Tests whether this line is parallel to the line
- * given as a parameter.
- * 
- * @param THAT - The line to test with this line
- */
-inline bool Line::operator||(const Line& THAT) const {
-    return this->slope_ == THAT.slope();
-}
-
-#endif // _LINE_H_
+/**
+ * File  : line.h
+ * Author: Raja Soufi
+ * 
+ * Class definition of a line in 2D space:
+ * 
+ *     ################################
+ *     #  y = slope * x + yIntercept  #
+ *     ################################
+ * 
+ * In case of a vertical line, slope is set to
+ * infinity.
+ * 
+ * A line also has a yIntercept and xIntercept that
+ * are set to 0.0 in cases where they are not defined
+ * (vertical line or horizontal line respectively).
+ * Since a line's yIntercept and xIntercept can still
+ * be valid and equal to 0.0, one should first test
+ * whether a line is vertical/horizontal before in
+ * order to determine whether these variables are
+ * valid.
+ * 
+ * The slope and intercepts are of the scalar type
+ * T, which is either float or double. Line is the
+ * double precision version. It is trivially copyable
+ * and entirely defined in this header.
+ */
+
+// Include guard
+#ifndef _LINE_H_
+#define _LINE_H_
+
+// Inclusions
+#include <cmath>
+#include <type_traits>
+
+#include "../utilities/exceptions.h"
+#include "../utilities/utilities.h"
+
+#include "point.h"
+
+// Forward-declarations
+template <typename T> class BasicPoint;
+
+// Class definition
+template <typename T>
+class BasicLine {
+    
+    private:
+    
+    // Attributes
+    T slope_, yIntercept_, xIntercept_;
+    
+    public:
+    
+    // Constructors
+    constexpr BasicLine(void);
+    inline BasicLine(const T SLOPE, const T INTERCEPT);
+    inline BasicLine(const T X_ANGLE);
+    inline BasicLine(const BasicPoint<T>& P1, const BasicPoint<T>& P2);
+    inline BasicLine(const BasicPoint<T>& P);
+    inline BasicLine(const BasicLine& THAT, const BasicPoint<T>& P);
+    
+    // Getters
+    constexpr T slope(void) const;
+    constexpr T yIntercept(void) const;
+    constexpr T xIntercept(void) const;
+    
+    // Other methods
+    inline T xAngle(void) const;
+    
+    constexpr bool isVertical(void) const;
+    constexpr bool isHorizontal(void) const;
+    constexpr bool contains(const BasicPoint<T>& P) const;
+    
+    inline BasicLine rotated(const T ANGLE) const;
+    
+    inline BasicPoint<T> intersect(const BasicLine& THAT) const;
+    inline BasicPoint<T> getPointAtX(const T X) const;
+    inline BasicPoint<T> getPointAtY(const T Y) const;
+    
+    // Operators
+    constexpr bool operator==(const BasicLine& THAT) const;
+    constexpr bool operator!=(const BasicLine& THAT) const;
+    constexpr bool operator||(const BasicLine& THAT) const;
+    
+};
+
+// Precisions
+typedef BasicLine<float> LineF;
+typedef BasicLine<double> Line;
+
+// Layout
+static_assert(std::is_trivially_copyable<LineF>::value && std::is_trivially_copyable<Line>::value,
+    "A line must be trivially copyable");
+    
+/*
+    Constructors
+*/
+
+/**
+ * Constructs a line with a zero slope and zero
+ * intercepts. The constructed line is equivalent
+ * to the x-axis.
+ */
+template <typename T>
+constexpr BasicLine<T>::BasicLine(void) : slope_(0), yIntercept_(0), xIntercept_(0) {}
+
+/**
+ * Constructs a line with a slope equal to the first
+ * given parameter. If this first parameter is equal
+ * to +/-DOUBLE_INFINITY, then the x-intercept of the
+ * new line is set to the second given parameter.
+ * Otherwise, the y-intercept is set to the second
+ * given parameter and the x-intercept is calculated
+ * accordingly.
+ * 
+ * @param SLOPE     - The slope of the new line
+ * @param INTERCEPT - The x-intercept or y-intercept
+ *                    of the new line, depending on
+ *                    the value of slope
+ */
+template <typename T>
+inline BasicLine<T>::BasicLine(const T SLOPE, const T INTERCEPT) {
+    this->slope_ = (SLOPE == -DOUBLE_INFINITY) ? DOUBLE_INFINITY : SLOPE;
+    if (this->isVertical()) {
+        this->yIntercept_ = 0;
+        this->xIntercept_ = INTERCEPT;
+    } else {
+        this->yIntercept_ = INTERCEPT;
+        this->xIntercept_ = this->isHorizontal() ? 0 : -INTERCEPT / SLOPE;
+    }
+}
+
+/**
+ * Constructs a line that makes an angle with the
+ * x-axis equal to the number given as a parameter.
+ * 
+ * @param X_ANGLE - The angle that the new line makes
+ *                  with the x-axis
+ */
+template <typename T>
+inline BasicLine<T>::BasicLine(const T X_ANGLE) : yIntercept_(0), xIntercept_(0) {
+    double xAngleBound = trueMod(X_ANGLE, M_PI);
+    this->slope_ = (xAngleBound == M_PI_2) ? DOUBLE_INFINITY : tan(xAngleBound);
+}
+
+/**
+ * Constructs a line that goes through the two points
+ * given as parameters. If the two points are the
+ * same, the new line will have a zero slope.
+ * 
+ * @param P1 - The first point for the new line
+ * @param P2 - The second point for the new line
+ */
+template <typename T>
+inline BasicLine<T>::BasicLine(const BasicPoint<T>& P1, const BasicPoint<T>& P2) {
+    if ((P1.x() == P2.x()) && (P1.y() != P2.y())) {
+        this->slope_ = DOUBLE_INFINITY;
+        this->yIntercept_ = 0;
+        this->xIntercept_ = P1.x();
+    } else {
+        this->slope_ = (P1 == P2) ? 0 : (P2.y() - P1.y()) / (P2.x() - P1.x());
+        this->yIntercept_ = P1.y() - P1.x() * this->slope_;
+        this->xIntercept_ = this->isHorizontal() ? 0 : -this->yIntercept_ / this->slope_;
+    }
+}
+
+/**
+ * Constructs a line that goes through the origin
+ * and the point given as a parameter.
+ * 
+ * @param P - The point for the new line
+ */
+template <typename T>
+inline BasicLine<T>::BasicLine(const BasicPoint<T>& P) : BasicLine(BasicPoint<T>(), P) {}
+
+/**
+ * Constructs a line perpendicular to the line given
+ * as a parameter and going through the point given
+ * as a parameter.
+ * 
+ * @param THAT - The line perpendicular to the new
+ *               line
+ * @param P    - The point for the new line
+ */
+template <typename T>
+inline BasicLine<T>::BasicLine(const BasicLine& THAT, const BasicPoint<T>& P) {
+    if (THAT.isHorizontal()) {
+        this->slope_ = DOUBLE_INFINITY;
+        this->yIntercept_ = 0;
+        this->xIntercept_ = P.x();
+    } else {
+        this->slope_ = - 1 / THAT.slope();
+        this->yIntercept_ = P.y() - P.x() * this->slope_;
+        this->xIntercept_ = this->isHorizontal() ? 0 : -this->yIntercept_ / this->slope_;
+    }
+}
+
+/*
+    Getters
+*/
+
+/**
+ * Returns the slope of this line.
+ */
+template <typename T>
+constexpr T BasicLine<T>::slope(void) const {
+    return this->slope_;
+}
+
+/**
+ * Returns the y-intercept of this line.
+ * Returns 0.0 when this line is vertical.
+ */
+template <typename T>
+constexpr T BasicLine<T>::yIntercept(void) const {
+    return this->yIntercept_;
+}
+
+/**
+ * Returns the y-intercept of this line.
+ * Returns 0.0 when this line is vertical.
+ */
+template <typename T>
+constexpr T BasicLine<T>::xIntercept(void) const {
+    return this->xIntercept_;
+}
+
+/*
+    Other methods
+*/
+
+/**
+ * Returns the angle that this line makes
+ * with the x-axis.
+ */
+template <typename T>
+inline T BasicLine<T>::xAngle(void) const {
+    return trueMod(atan(this->slope_), M_PI);
+}
+
+
+/**
+ * Tests whether this line is vertical.
+ */
+template <typename T>
+constexpr bool BasicLine<T>::isVertical(void) const {
+    return this->slope_ == DOUBLE_INFINITY;
+}
+
+/**
+ * Tests whether this line is horizontal.
+ */
+template <typename T>
+constexpr bool BasicLine<T>::isHorizontal(void) const {
+    return this->slope_ == 0;
+}
+
+
+/**
+ * Returns a new line which is equivalent to this
+ * line rotated by the angle given as a parameter.
+ * 
+ * @param ANGLE - The angle by which to rotate this
+ *                line
+ */
+template <typename T>
+inline BasicLine<T> BasicLine<T>::rotated(const T ANGLE) const {
+    return BasicLine(this->xAngle() + ANGLE);
+}
+
+
+/**
+ * Tests whether the point given as a parameter is
+ * on this line.
+ * 
+ * @param P - The point to test with this line
+ */
+template <typename T>
+constexpr bool BasicLine<T>::contains(const BasicPoint<T>& P) const {
+    return P.y() == this->slope_ * P.x() + this->yIntercept_;
+}
+
+
+/**
+ * Returns a new point that is the intersection of
+ * this line and the line given as a parameter.
+ * In case the two lines are parallel, an exception
+ * of type LinesParallelException is thrown.
+ * 
+ * @param THAT - The line to intersect with this line
+ */
+template <typename T>
+inline BasicPoint<T> BasicLine<T>::intersect(const BasicLine& THAT) const {
+    // If the two lines are parallel, throw an exception
+    if (*this || THAT) {
+        throw LinesParallelException();
+    }
+    // If this line is vertical, use its xIntercept to get
+    // the intersection point from the other line
+    else if (this->isVertical()) {
+        return THAT.getPointAtX(this->xIntercept_);
+    }
+    // If THAT line is vertical, do exactly as in the previous
+    // case but the other way around
+    else if (THAT.isVertical()) {
+        return this->getPointAtX(THAT.xIntercept());
+    }
+    // If the two lines are not parallel and neither of them is
+    // vertical, compute the x coordinate of their intersection
+    // and use it to get the y coordinate from this line
+    else {
+        return this->getPointAtX((THAT.yIntercept() - this->yIntercept_) / (this->slope_ - THAT.slope()));
+    }
+}
+
+/**
+ * Returns a new point which represents the point on
+ * this line with x-coordinate equal to the number
+ * given as a parameter.
+ * In case this line is vertical, an exception of
+ * type LineVerticalException is thrown.
+ * 
+ * @param X - The x-coordinate of the point to return
+ */
+template <typename T>
+inline BasicPoint<T> BasicLine<T>::getPointAtX(const T X) const {
+    if (this->isVertical()) {
+        throw LineVerticalException();
+    } else {
+        return BasicPoint<T>(X, this->slope_ * X + this->yIntercept_);
+    }
+}
+
+/**
+ * Returns a new point which represents the point on
+ * this line with y-coordinate equal to the number
+ * given as a parameter.
+ * In case this line is horizontal, an exception of
+ * type LineHorizontalException is thrown.
+ * 
+ * @param Y - The y-coordinate of the point to return
+ */
+template <typename T>
+inline BasicPoint<T> BasicLine<T>::getPointAtY(const T Y) const {
+    if (this->isHorizontal()) {
+        throw LineHorizontalException();
+    } else {
+        return BasicPoint<T>(this->isVertical() ? this->xIntercept_ : (Y - this->yIntercept_) / this->slope_, Y);
+    }
+}
+
+/*
+    Operators
+*/
+
+/**
+ * Tests whether this line is equal to the line
+ * given as a parameter, in the sense that their
+ * respective slopes and intercepts are equal.
+ * 
+ * @param THAT - The line to compare to this line
+ */
+template <typename T>
+constexpr bool BasicLine<T>::operator==(const BasicLine& THAT) const {
+    return (this->slope_ == THAT.slope()) &&
+        (((this->slope_ == DOUBLE_INFINITY) && (this->xIntercept_ == THAT.xIntercept())) ||
+        (this->yIntercept_ == THAT.yIntercept()));
+}
+
+/**
+ * Tests whether this line is different from the line
+ * given as a parameter, in the sense that either
+ * their slopes are different or one of their respective
+ * intercepts are different.
+ * 
+ * @param THAT - The line to compare to this line
+ */
+template <typename T>
+constexpr bool BasicLine<T>::operator!=(const BasicLine& THAT) const {
+    return !(*this == THAT);
+}
+
+/**
+ * Tests whether this line is parallel to the line
+ * given as a parameter.
+ * 
+ * @param THAT - The line to test with this line
+ */
+template <typename T>
+constexpr bool BasicLine<T>::operator||(const BasicLine& THAT) const {
+    return this->slope_ == THAT.slope();
+}
+
+#endif // _LINE_H_
@@ -1,178 +1,306 @@
-/**
- * File  : point.h
- * Author: Raja Soufi
- * 
- * Class definition of a Point in 2D space:
- * 
- *              #############
- *              #  P(x, y)  #
- *              #############
- */
-
-// Include guard
-#ifndef _POINT_H_
-#define _POINT_H_
-
-// Inclusions
-#include "line.h"
-#include "vector.h"
-
-// Forward-declarations
-class Line;
-class Vector;
-
-// Class definition
-class Point {
-    
-    private:
-    
-    // Attributes
-    double x_, y_;
-    
-    public:
-    
-    // Constructors
-    Point(void);
-    Point(const double X, const double Y);
-    Point(const Vector& V);
-    Point(const Point& THAT);
-    
-    // Destructor
-    ~Point(void);
-    
-    // Getters
-    inline double x(void) const;
-    inline double y(void) const;
-    
-    // Other methods
-    Vector from(const Point& THAT) const;
-    Point projectionOnto(const Line& L) const;
-    
-    // Operators
-    inline const Point operator+(const Point& THAT) const;
-    inline const Point operator-(const Point& THAT) const;
-    inline const Point operator-(void) const;
-    
-    inline const Point operator*(const double D) const;
-    inline const Point operator/(const double D) const;
-    
-    Point& operator=(const Point& THAT);
-    Point& operator+=(const Point& THAT);
-    Point& operator-=(const Point& THAT);
-    
-    inline bool operator==(const Point& THAT) const;
-    inline bool operator!=(const Point& THAT) const;
-    
-};
-
-/*
-    Getters
-*/
-
-/**
- * Returns the x-coordinate of this point.
- */
-inline double Point::x(void) const {
-    return this->x_;
-}
-
-/**
- * Returns the y-coordinate of this point.
- */
-inline double Point::y(void) const {
-    return this->y_;
-}
-
-/*
-    Operators
-*/
-
-/**
- * Returns a new point which is the sum of this point
- * and the point given as a parameter.
- * The sum of two points is considered to be defined
- * as follows:
- * 
- *       ######################################
- *       #  (x_1, y_1) + (x_2, y_2) =         #
- *       #            (x_1 + x_2, y_1 + y_2)  #
- *       ######################################
- * 
- * @param THAT - The point to add to this point
- */
-inline const Point Point::operator+(const Point& THAT) const {
-    return Point(*this) += THAT;
-}
-
-/**
- * Returns a new point which is the difference between
- * this point and the point given as a parameter.
- * The difference between two points is considered to
- * be defined as follows:
- * 
- *       ######################################
- *       #  (x_1, y_1) - (x_2, y_2) =         #
- *       #            (x_1 - x_2, y_1 - y_2)  #
- *       ######################################
- * 
- * @param THAT - The point to subtract from this point
- */
-inline const Point Point::operator-(const Point& THAT) const {
-    return Point(*this) -= THAT;
-}
-
-/**
- * Returns the opposite of this point as a new Point.
- */
-inline const Point Point::operator-(void) const {
-    return Point(-this->x_, -this->y_);
-}
-
-
-/**
- * Returns a new point which has this point's
- * coordinates scaled by the number given as a
- * parameter.
- * 
- * @param D - The number by which to scale this point
- */
-inline const Point Point::operator*(const double D) const {
-    return Point(this->x_ * D, this->y_ * D);
-}
-
-/**
- * Returns a new point which has this point's
- * coordinates divided by the number given as a
- * parameter.
- * 
- * @param D - The number by which to divide this
- *            point's coordinates
- */
-inline const Point Point::operator/(const double D) const {
-    return Point(this->x_ / D, this->y_ / D);
-}
-
-
-/**
- * Tests whether this point is equal to the point
- * given as a parameter, in the sense that their
- * respective coordinates are all equal.
- * 
- * @param THAT - The point to compare to this point
- */
-inline bool Point::operator==(const Point& THAT) const {
-    return (this->x_ == THAT.x()) && (this->y_ == THAT.y());
-}
-
-/**
- * Tests whether this point is different from the point
- * given as a parameter, in the sense that at least one
- * of their respective coordinates are different.
- * 
- * @param THAT - The point to compare to this point
- */
-inline bool Point::operator!=(const Point& THAT) const {
-    return !(*this == THAT);
-}
-
-#endif // _POINT_H_
+/**
+ * File  : point.h
+ * Author: Raja Soufi
+ * 
+ * Class definition of a Point in 2D space:
+ * 
+ *              #############
+ *              #  P(x, y)  #
+ *              #############
+ * 
+ * The coordinates are of the scalar type T, which
+ * is either float or double. Point is the double
+ * precision version, used throughout unless stated
+ * otherwise.
+ * 
+ * A point is a plain pair of coordinates: it is
+ * trivially copyable, laid out as its x and y
+ * coordinates, and entirely defined in this header
+ * so that the compiler can keep it in registers and
+ * vectorize loops over it. Everything but the
+ * projection is constexpr.
+ */
+
+// Include guard
+#ifndef _POINT_H_
+#define _POINT_H_
+
+// Inclusions
+#include <cmath>
+#include <type_traits>
+
+#include "line.h"
+#include "vector.h"
+
+// Forward-declarations
+template <typename T> class BasicLine;
+template <typename T> class BasicVector;
+
+// Class definition
+template <typename T>
+class BasicPoint {
+    
+    private:
+    
+    // Attributes
+    T x_, y_;
+    
+    public:
+    
+    // Constructors
+    constexpr BasicPoint(void);
+    constexpr BasicPoint(const T X, const T Y);
+    constexpr BasicPoint(const BasicVector<T>& V);
+    
+    // Getters
+    constexpr T x(void) const;
+    constexpr T y(void) const;
+    
+    // Other methods
+    constexpr BasicVector<T> from(const BasicPoint& THAT) const;
+    inline BasicPoint projectionOnto(const BasicLine<T>& L) const;
+    
+    // Operators
+    constexpr const BasicPoint operator+(const BasicPoint& THAT) const;
+    constexpr const BasicPoint operator-(const BasicPoint& THAT) const;
+    constexpr const BasicPoint operator-(void) const;
+    
+    constexpr const BasicPoint operator*(const T D) const;
+    constexpr const BasicPoint operator/(const T D) const;
+    
+    constexpr BasicPoint& operator+=(const BasicPoint& THAT);
+    constexpr BasicPoint& operator-=(const BasicPoint& THAT);
+    
+    constexpr bool operator==(const BasicPoint& THAT) const;
+    constexpr bool operator!=(const BasicPoint& THAT) const;
+    
+};
+
+// Precisions
+typedef BasicPoint<float> PointF;
+typedef BasicPoint<double> Point;
+
+// Layout
+static_assert(std::is_trivially_copyable<PointF>::value && std::is_trivially_copyable<Point>::value,
+    "A point must be trivially copyable");
+static_assert(std::is_standard_layout<PointF>::value && std::is_standard_layout<Point>::value,
+    "A point must have a standard layout");
+static_assert((sizeof(PointF) == 2 * sizeof(float)) && (sizeof(Point) == 2 * sizeof(double)),
+    "A point must be laid out as its two coordinates");
+    
+/*
+    Constructors
+*/
+
+/**
+ * Constructs a point with zero coordinates. The
+ * constructed point is equivalent to the origin.
+ */
+template <typename T>
+constexpr BasicPoint<T>::BasicPoint(void) : x_(0), y_(0) {}
+
+/**
+ * Constructs a point with coordinates equal to the
+ * ones given as parameters.
+ * 
+ * @param X - The x-coordinate of the new point
+ * @param Y - The y-coordinate of the new point
+ */
+template <typename T>
+constexpr BasicPoint<T>::BasicPoint(const T X, const T Y) : x_(X), y_(Y) {}
+
+/**
+ * Constructs a point with coordinates equal to those
+ * of the vector given as a parameter.
+ * 
+ * @param V - The vector to be used to construct the
+ *            new point
+ */
+template <typename T>
+constexpr BasicPoint<T>::BasicPoint(const BasicVector<T>& V) : x_(V.x()), y_(V.y()) {}
+
+/*
+    Getters
+*/
+
+/**
+ * Returns the x-coordinate of this point.
+ */
+template <typename T>
+constexpr T BasicPoint<T>::x(void) const {
+    return this->x_;
+}
+
+/**
+ * Returns the y-coordinate of this point.
+ */
+template <typename T>
+constexpr T BasicPoint<T>::y(void) const {
+    return this->y_;
+}
+
+/*
+    Other methods
+*/
+
+/**
+ * Returns a new vector with coordinates equal to those
+ * of the difference between this point and the point
+ * given as a parameter.
+ * 
+ * @param THAT - The point to subtract from this point
+ *               in order to obtain the new vector
+ */
+template <typename T>
+constexpr BasicVector<T> BasicPoint<T>::from(const BasicPoint& THAT) const {
+    return BasicVector<T>(this->x_ - THAT.x_, this->y_ - THAT.y_);
+}
+
+/**
+ * Returns the porjection of this point onto the line
+ * given as a parameter.
+ * 
+ * @param L - The line to project this point onto
+ */
+template <typename T>
+inline BasicPoint<T> BasicPoint<T>::projectionOnto(const BasicLine<T>& L) const {
+    if (L.isVertical()) {
+        return BasicPoint(L.xIntercept(), this->y_);
+    } else {
+        T denom = std::pow(L.slope(), 2) + 1;
+        return BasicPoint((this->x_ + L.slope() * (this->y_ - L.yIntercept())) / denom,
+            (L.slope() * (this->x_ + L.slope() * this->y_) + L.yIntercept()) / denom);
+    }
+}
+
+/*
+    Operators
+*/
+
+/**
+ * Returns a new point which is the sum of this point
+ * and the point given as a parameter.
+ * The sum of two points is considered to be defined
+ * as follows:
+ * 
+ *       ######################################
+ *       #  (x_1, y_1) + (x_2, y_2) =         #
+ *       #            (x_1 + x_2, y_1 + y_2)  #
+ *       ######################################
+ * 
+ * @param THAT - The point to add to this point
+ */
+template <typename T>
+constexpr const BasicPoint<T> BasicPoint<T>::operator+(const BasicPoint& THAT) const {
+    return BasicPoint(this->x_ + THAT.x_, this->y_ + THAT.y_);
+}
+
+/**
+ * Returns a new point which is the difference between
+ * this point and the point given as a parameter.
+ * The difference between two points is considered to
+ * be defined as follows:
+ * 
+ *       ######################################
+ *       #  (x_1, y_1) - (x_2, y_2) =         #
+ *       #            (x_1 - x_2, y_1 - y_2)  #
+ *       ######################################
+ * 
+ * @param THAT - The point to subtract from this point
+ */
+template <typename T>
+constexpr const BasicPoint<T> BasicPoint<T>::operator-(const BasicPoint& THAT) const {
+    return BasicPoint(this->x_ - THAT.x_, this->y_ - THAT.y_);
+}
+
+/**
+ * Returns the opposite of this point as a new Point.
+ */
+template <typename T>
+constexpr const BasicPoint<T> BasicPoint<T>::operator-(void) const {
+    return BasicPoint(-this->x_, -this->y_);
+}
+
+
+/**
+ * Returns a new point which has this point's
+ * coordinates scaled by the number given as a
+ * parameter.
+ * 
+ * @param D - The number by which to scale this point
+ */
+template <typename T>
+constexpr const BasicPoint<T> BasicPoint<T>::operator*(const T D) const {
+    return BasicPoint(this->x_ * D, this->y_ * D);
+}
+
+/**
+ * Returns a new point which has this point's
+ * coordinates divided by the number given as a
+ * parameter.
+ * 
+ * @param D - The number by which to divide this
+ *            point's coordinates
+ */
+template <typename T>
+constexpr const BasicPoint<T> BasicPoint<T>::operator/(const T D) const {
+    return BasicPoint(this->x_ / D, this->y_ / D);
+}
+
+
+/**
+ * Adds the coordinates of the point given as a
+ * parameter to this point's coordinates.
+ * Returns this point for chaining.
+ * 
+ * @param THAT - The point with the coordinates to
+ *               be added
+ */
+template <typename T>
+constexpr BasicPoint<T>& BasicPoint<T>::operator+=(const BasicPoint& THAT) {
+    this->x_ += THAT.x_;
+    this->y_ += THAT.y_;
+    return *this;
+}
+
+/**
+ * Subtracts the coordinates of the point given as a
+ * parameter from this point's coordinates.
+ * Returns this point for chaining.
+ * 
+ * @param THAT - The point with the coordinates to
+ *               be subtracted
+ */
+template <typename T>
+constexpr BasicPoint<T>& BasicPoint<T>::operator-=(const BasicPoint& THAT) {
+    this->x_ -= THAT.x_;
+    this->y_ -= THAT.y_;
+    return *this;
+}
+
+
+/**
+ * Tests whether this point is equal to the point
+ * given as a parameter, in the sense that their
+ * respective coordinates are all equal.
+ * 
+ * @param THAT - The point to compare to this point
+ */
+template <typename T>
+constexpr bool BasicPoint<T>::operator==(const BasicPoint& THAT) const {
+    return (this->x_ == THAT.x_) && (this->y_ == THAT.y_);
+}
+
+/**
+ * Tests whether this point is different from the point
+ * given as a parameter, in the sense that at least one
+ * of their respective coordinates are different.
+ * 
+ * @param THAT - The point to compare to this point
+ */
+template <typename T>
+constexpr bool BasicPoint<T>::operator!=(const BasicPoint& THAT) const {
+    return !(*this == THAT);
+}
+
+#endif // _POINT_H_
@@ -1,267 +1,440 @@
-/**
- * File  : vector.h
- * Author: Raja Soufi
- * 
- * Class definition of a vector in 2D space:
- * 
- *              #############
- *              #  V(x, y)  #
- *              #############
- */
-
-// Include guard
-#ifndef _VECTOR_H_
-#define _VECTOR_H_
-
-// Inclusions
-#include <cmath>
-
-#include "../utilities/utilities.h"
-
-#include "point.h"
-
-// Forward-declarations
-class Point;
-
-// Class definition
-class Vector {
-    
-    private:
-    
-    // Attributes
-    double x_, y_;
-    
-    public:
-    
-    // Constructors
-    Vector(void);
-    Vector(const double X, const double Y);
-    Vector(const double X_ANGLE);
-    Vector(const Point& P);
-    Vector(const Vector& THAT);
-    
-    // Destructor
-    ~Vector(void);
-    
-    // Getters
-    inline double x(void) const;
-    inline double y(void) const;
-    
-    // Other methods
-    inline double norm(void) const;
-    inline double xAngle(void) const;
-    
-    const Vector& normalize(const double NEW_NORM = 1.0);
-    const Vector& limitNorm(const double MAX_NORM = 1.0);
-    const Vector& limitNorm(const Vector& THAT);
-    inline Vector projectionOnto(const Vector& THAT) const;
-    inline Vector rotated(const double ANGLE) const;
-    inline double angleFrom(const Vector& THAT) const;
-    
-    // Operators
-    inline const Vector operator+(const Vector& THAT) const;
-    inline const Vector operator-(const Vector& THAT) const;
-    inline double operator*(const Vector& THAT) const;
-    inline const Vector operator-(void) const;
-    
-    inline const Vector operator*(const double D) const;
-    inline const Vector operator/(const double D) const;
-    
-    Vector& operator=(const Vector& THAT);
-    Vector& operator+=(const Vector& THAT);
-    Vector& operator-=(const Vector& THAT);
-    
-    inline bool operator==(const Vector& THAT) const;
-    inline bool operator!=(const Vector& THAT) const;
-    
-    inline bool operator==(const double D) const;
-    inline bool operator!=(const double D) const;
-    
-};
-
-/*
-    Getters
-*/
-
-/**
- * Returns the x-coordinate of this vector.
- */
-inline double Vector::x(void) const {
-    return this->x_;
-}
-
-/**
- * Returns the y-coordinate of this vector.
- */
-inline double Vector::y(void) const {
-    return this->y_;
-}
-
-/*
-    Other methods
-*/
-
-/**
- * Returns the norm of this vector.
- */
-inline double Vector::norm(void) const {
-    return sqrt(*this * *this);
-}
-
-/**
- * Returns the angle, in radians, that this vector
- * makes with the x-axis.
- */
-inline double Vector::xAngle(void) const {
-    return (this->norm() == 0) ? 0 :
-        (this->x_ == 0) ? M_PI_2 + ((this->y_ < 0) ? M_PI : 0) :
-        trueMod(atan(this->y_ / this->x_) + ((this->x_ < 0) ? M_PI : 0), 2 * M_PI);
-}
-
-
-/**
- * Returns the projection of this vector onto the
- * vector given as a parameter.
- * 
- * @param THAT - The vector to project this vector
- *               onto
- */
-inline Vector Vector::projectionOnto(const Vector& THAT) const {
-    return Vector(THAT).normalize(std::abs(*this * THAT) / THAT.norm());
-}
-
-/**
- * Returns a new vector which is equivalent to this
- * vector rotated by the angle given as a parameter.
- * 
- * @param ANGLE - The angle by which to rotate this
- *                vector
- */
-inline Vector Vector::rotated(const double ANGLE) const {
-    return Vector(this->xAngle() + ANGLE).normalize(this->norm());
-}
-
-/**
- * Returns the angle, in radians, that this vector
- * makes with the vector given as a parameter.
- * 
- * @param THAT - The vector to be considered when
- *               calculating the angle
- */
-inline double Vector::angleFrom(const Vector& THAT) const {
-    return this->xAngle() - THAT.xAngle();
-}
-
-/*
-    Operators
-*/
-
-/**
- * Returns a new vector which is the sum of this
- * vector and the vector given as a parameter.
- * 
- * @param THAT - The vector to add to this vector
- */
-inline const Vector Vector::operator+(const Vector& THAT) const {
-    return Vector(*this) += THAT;
-}
-
-/**
- * Returns a new vector which is the difference
- * between this vector and the vector given as a
- * parameter.
- * 
- * @param THAT - The vector to subtract from this
- *               vector
- */
-inline const Vector Vector::operator-(const Vector& THAT) const {
-    return Vector(*this) -= THAT;
-}
-
-/**
- * Returns the dot product of this vector and the
- * vector given as a parameter.
- * 
- * @param THAT - The second operand of the dot product
- */
-inline double Vector::operator*(const Vector& THAT) const {
-    return this->x_ * THAT.x() + this->y_ * THAT.y();
-}
-
-/**
- * Returns the opposite of this vector as a new vector.
- */
-inline const Vector Vector::operator-(void) const {
-    return Vector(-this->x_, -this->y_);
-}
-
-
-/**
- * Returns a new vector which has this vector's
- * coordinates scaled by the number given as a
- * parameter.
- * 
- * @param D - The number by which to scale this vector
- */
-inline const Vector Vector::operator*(const double D) const {
-    return Vector(this->x_ * D, this->y_ * D);
-}
-
-/**
- * Returns a new vector which has this vector's
- * coordinates divided by the number given as a
- * parameter.
- * 
- * @param D - The number by which to divide this
- *            vector's coordinates
- */
-inline const Vector Vector::operator/(const double D) const {
-    return Vector(this->x_ / D, this->y_ / D);
-}
-
-
-/**
- * Tests whether this vector is equal to the vector
- * given as a parameter, in the sense that their
- * respective coordinates are all equal.
- * 
- * @param THAT - The vector to compare to this vector
- */
-inline bool Vector::operator==(const Vector& THAT) const {
-    return (this->x_ == THAT.x()) && (this->y_ == THAT.y());
-}
-
-/**
- * Tests whether this vector is different from the vector
- * given as a parameter, in the sense that at least one
- * of their respective coordinates are different.
- * 
- * @param THAT - The vector to compare to this vector
- */
-inline bool Vector::operator!=(const Vector& THAT) const {
-    return !(*this == THAT);
-}
-
-/**
- * Tests whether this vector's norm is equal to the
- * number given as a parameter.
- * 
- * @param D - The number to compare to this vector's
- *            norm
- */
-inline bool Vector::operator==(const double D) const {
-    return this->norm() == D;
-}
-
-/**
- * Tests whether this vector's norm is different from
- * the number given as a parameter.
- * 
- * @param D - The number to compare to this vector's
- *            norm
- */
-inline bool Vector::operator!=(const double D) const {
-    return !(*this == D);
-}
-
-#endif // _VECTOR_H_
+/**
+ * File  : vector.h
+ * Author: Raja Soufi
+ * 
+ * Class definition of a vector in 2D space:
+ * 
+ *              #############
+ *              #  V(x, y)  #
+ *              #############
+ * 
+ * The coordinates are of the scalar type T, which
+ * is either float or double. Vector is the double
+ * precision version.
+ * 
+ * Like a point, a vector is trivially copyable, laid
+ * out as its two coordinates and entirely defined in
+ * this header. Everything that does not need a square
+ * root or a trigonometric function is constexpr.
+ */
+
+// Include guard
+#ifndef _VECTOR_H_
+#define _VECTOR_H_
+
+// Inclusions
+#include <cmath>
+#include <type_traits>
+
+#include "../utilities/utilities.h"
+
+#include "point.h"
+
+// Forward-declarations
+template <typename T> class BasicPoint;
+
+// Class definition
+template <typename T>
+class BasicVector {
+    
+    private:
+    
+    // Attributes
+    T x_, y_;
+    
+    public:
+    
+    // Constructors
+    constexpr BasicVector(void);
+    constexpr BasicVector(const T X, const T Y);
+    inline BasicVector(const T X_ANGLE);
+    constexpr BasicVector(const BasicPoint<T>& P);
+    
+    // Getters
+    constexpr T x(void) const;
+    constexpr T y(void) const;
+    
+    // Other methods
+    inline T norm(void) const;
+    inline T xAngle(void) const;
+    
+    inline const BasicVector& normalize(const T NEW_NORM = 1.0);
+    inline const BasicVector& limitNorm(const T MAX_NORM = 1.0);
+    inline const BasicVector& limitNorm(const BasicVector& THAT);
+    inline BasicVector projectionOnto(const BasicVector& THAT) const;
+    inline BasicVector rotated(const T ANGLE) const;
+    inline T angleFrom(const BasicVector& THAT) const;
+    constexpr T cross(const BasicVector& THAT) const;
+    
+    // Operators
+    constexpr const BasicVector operator+(const BasicVector& THAT) const;
+    constexpr const BasicVector operator-(const BasicVector& THAT) const;
+    constexpr T operator*(const BasicVector& THAT) const;
+    constexpr const BasicVector operator-(void) const;
+    
+    constexpr const BasicVector operator*(const T D) const;
+    constexpr const BasicVector operator/(const T D) const;
+    
+    constexpr BasicVector& operator+=(const BasicVector& THAT);
+    constexpr BasicVector& operator-=(const BasicVector& THAT);
+    
+    constexpr bool operator==(const BasicVector& THAT) const;
+    constexpr bool operator!=(const BasicVector& THAT) const;
+    
+    inline bool operator==(const T D) const;
+    inline bool operator!=(const T D) const;
+    
+};
+
+// Precisions
+typedef BasicVector<float> VectorF;
+typedef BasicVector<double> Vector;
+
+// Layout
+static_assert(std::is_trivially_copyable<VectorF>::value && std::is_trivially_copyable<Vector>::value,
+    "A vector must be trivially copyable");
+static_assert(std::is_standard_layout<VectorF>::value && std::is_standard_layout<Vector>::value,
+    "A vector must have a standard layout");
+static_assert((sizeof(VectorF) == 2 * sizeof(float)) && (sizeof(Vector) == 2 * sizeof(double)),
+    "A vector must be laid out as its two coordinates");
+    
+/*
+    Constructors
+*/
+
+/**
+ * Constructs a vector with zero coordinates.
+ */
+template <typename T>
+constexpr BasicVector<T>::BasicVector(void) : x_(0), y_(0) {}
+
+/**
+ * Constructs a vector with coordinates equal to the
+ * ones given as parameters.
+ * 
+ * @param X - The x-coordinate of the new vector
+ * @param Y - The y-coordinate of the new vector
+ */
+template <typename T>
+constexpr BasicVector<T>::BasicVector(const T X, const T Y) : x_(X), y_(Y) {}
+
+/**
+ * Constructs a unit-vector that makes an angle with
+ * the x-axis that is equal to the angle given as a
+ * parameter.
+ * 
+ * @param X_ANGLE - The angle that the new vector
+ *                  makes with the x-axis
+ */
+template <typename T>
+inline BasicVector<T>::BasicVector(const T X_ANGLE) {
+    double xAngleBound = trueMod(X_ANGLE, 2 * M_PI);
+    this->x_ = cos(xAngleBound);
+    this->y_ = sin(xAngleBound);
+}
+
+/** Constructs a vector with coordinates equal to those
+ * of the point given as a parameter.
+ * 
+ * @param P - The point to be used to construct the
+ *            new vector
+ */
+template <typename T>
+constexpr BasicVector<T>::BasicVector(const BasicPoint<T>& P) : x_(P.x()), y_(P.y()) {}
+
+/*
+    Getters
+*/
+
+/**
+ * Returns the x-coordinate of this vector.
+ */
+template <typename T>
+constexpr T BasicVector<T>::x(void) const {
+    return this->x_;
+}
+
+/**
+ * Returns the y-coordinate of this vector.
+ */
+template <typename T>
+constexpr T BasicVector<T>::y(void) const {
+    return this->y_;
+}
+
+/*
+    Other methods
+*/
+
+/**
+ * Returns the norm of this vector.
+ */
+template <typename T>
+inline T BasicVector<T>::norm(void) const {
+    return std::sqrt(*this * *this);
+}
+
+/**
+ * Returns the angle, in radians, that this vector
+ * makes with the x-axis.
+ */
+template <typename T>
+inline T BasicVector<T>::xAngle(void) const {
+    return (this->norm() == 0) ? 0 :
+        (this->x_ == 0) ? M_PI_2 + ((this->y_ < 0) ? M_PI : 0) :
+        trueMod(atan(this->y_ / this->x_) + ((this->x_ < 0) ? M_PI : 0), 2 * M_PI);
+}
+
+
+/**
+ * Normalizes this vector to the number given as a
+ * parameter. If no number is given, the vector is
+ * normalized to the unit-vector.
+ * Returns this vector for chaining.
+ * 
+ * @param NEW_NORM - The number to use when normalizing
+ *                   this vector
+ */
+template <typename T>
+inline const BasicVector<T>& BasicVector<T>::normalize(const T NEW_NORM/* = 1.0 */) {
+    T norm = this->norm();
+    if (norm != 0) {
+        this->x_ *= NEW_NORM / norm;
+        this->y_ *= NEW_NORM / norm;
+    }
+    return *this;
+}
+
+/**
+ * Limits this vector's norm to the number given as
+ * a parameter. If no number is given, the vector's
+ * norm is limited to the unit-vector.
+ * Returns this vector for chaining.
+ * 
+ * @param MAX_NORM - The number to which to limit this
+ *                   vector's norm
+ */
+template <typename T>
+inline const BasicVector<T>& BasicVector<T>::limitNorm(const T MAX_NORM/* = 1.0 */) {
+    if (this->norm() > MAX_NORM) {
+        this->normalize(MAX_NORM);
+    }
+    return *this;
+}
+
+/**
+ * Limits this vector's norm to that of the vector
+ * given as a parameter.
+ * Returns this vector for chaining.
+ * 
+ * @param THAT - The vector with the norm to which to
+ *               limit this vector's norm
+ */
+template <typename T>
+inline const BasicVector<T>& BasicVector<T>::limitNorm(const BasicVector& THAT) {
+    return this->limitNorm(THAT.norm());
+}
+
+/**
+ * Returns the projection of this vector onto the
+ * vector given as a parameter.
+ * 
+ * @param THAT - The vector to project this vector
+ *               onto
+ */
+template <typename T>
+inline BasicVector<T> BasicVector<T>::projectionOnto(const BasicVector& THAT) const {
+    return BasicVector(THAT).normalize(std::abs(*this * THAT) / THAT.norm());
+}
+
+/**
+ * Returns a new vector which is equivalent to this
+ * vector rotated by the angle given as a parameter.
+ * 
+ * @param ANGLE - The angle by which to rotate this
+ *                vector
+ */
+template <typename T>
+inline BasicVector<T> BasicVector<T>::rotated(const T ANGLE) const {
+    return BasicVector(this->xAngle() + ANGLE).normalize(this->norm());
+}
+
+/**
+ * Returns the angle, in radians, that this vector
+ * makes with the vector given as a parameter.
+ * 
+ * @param THAT - The vector to be considered when
+ *               calculating the angle
+ */
+template <typename T>
+inline T BasicVector<T>::angleFrom(const BasicVector& THAT) const {
+    return this->xAngle() - THAT.xAngle();
+}
+
+/**
+ * Returns the z-coordinate of the cross product of
+ * this vector and the vector given as a parameter,
+ * which is positive if THAT points to the left of
+ * this vector.
+ * 
+ * @param THAT - The second operand of the cross product
+ */
+template <typename T>
+constexpr T BasicVector<T>::cross(const BasicVector& THAT) const {
+    return this->x_ * THAT.y_ - this->y_ * THAT.x_;
+}
+
+/*
+    Operators
+*/
+
+/**
+ * Returns a new vector which is the sum of this
+ * vector and the vector given as a parameter.
+ * 
+ * @param THAT - The vector to add to this vector
+ */
+template <typename T>
+constexpr const BasicVector<T> BasicVector<T>::operator+(const BasicVector& THAT) const {
+    return BasicVector(this->x_ + THAT.x_, this->y_ + THAT.y_);
+}
+
+/**
+ * Returns a new vector which is the difference
+ * between this vector and the vector given as a
+ * parameter.
+ * 
+ * @param THAT - The vector to subtract from this
+ *               vector
+ */
+template <typename T>
+constexpr const BasicVector<T> BasicVector<T>::operator-(const BasicVector& THAT) const {
+    return BasicVector(this->x_ - THAT.x_, this->y_ - THAT.y_);
+}
+
+/**
+ * Returns the dot product of this vector and the
+ * vector given as a parameter.
+ * 
+ * @param THAT - The second operand of the dot product
+ */
+template <typename T>
+constexpr T BasicVector<T>::operator*(const BasicVector& THAT) const {
+    return this->x_ * THAT.x_ + this->y_ * THAT.y_;
+}
+
+/**
+ * Returns the opposite of this vector as a new vector.
+ */
+template <typename T>
+constexpr const BasicVector<T> BasicVector<T>::operator-(void) const {
+    return BasicVector(-this->x_, -this->y_);
+}
+
+
+/**
+ * Returns a new vector which has this vector's
+ * coordinates scaled by the number given as a
+ * parameter.
+ * 
+ * @param D - The number by which to scale this vector
+ */
+template <typename T>
+constexpr const BasicVector<T> BasicVector<T>::operator*(const T D) const {
+    return BasicVector(this->x_ * D, this->y_ * D);
+}
+
+/**
+ * Returns a new vector which has this vector's
+ * coordinates divided by the number given as a
+ * parameter.
+ * 
+ * @param D - The number by which to divide this
+ *            vector's coordinates
+ */
+template <typename T>
+constexpr const BasicVector<T> BasicVector<T>::operator/(const T D) const {
+    return BasicVector(this->x_ / D, this->y_ / D);
+}
+
+
+/**
+ * Adds the coordinates of the vector given as a
+ * parameter to this vector's coordinates.
+ * Returns this vector for chaining.
+ * 
+ * @param THAT - The vector with the coordinates to
+ *               be added
+ */
+template <typename T>
+constexpr BasicVector<T>& BasicVector<T>::operator+=(const BasicVector& THAT) {
+    this->x_ += THAT.x_;
+    this->y_ += THAT.y_;
+    return *this;
+}
+
+/**
+ * Subtracts the coordinates of the vector given as a
+ * parameter from this vector's coordinates.
+ * Returns this vector for chaining.
+ * 
+ * @param THAT - The vector with the coordinates to
+ *               be subtracted
+ */
+template <typename T>
+constexpr BasicVector<T>& BasicVector<T>::operator-=(const BasicVector& THAT) {
+    this->x_ -= THAT.x_;
+    this->y_ -= THAT.y_;
+    return *this;
+}
+
+
+/**
+ * Tests whether this vector is equal to the vector
+ * given as a parameter, in the sense that their
+ * respective coordinates are all equal.
+ * 
+ * @param THAT - The vector to compare to this vector
+ */
+template <typename T>
+constexpr bool BasicVector<T>::operator==(const BasicVector& THAT) const {
+    return (this->x_ == THAT.x_) && (this->y_ == THAT.y_);
+}
+
+/**
+ * Tests whether this vector is different from the vector
+ * given as a parameter, in the sense that at least one
+ * of their respective coordinates are different.
+ * 
+ * @param THAT - The vector to compare to this vector
+ */
+template <typename T>
+constexpr bool BasicVector<T>::operator!=(const BasicVector& THAT) const {
+    return !(*this == THAT);
+}
+
+/**
+ * Tests whether this vector's norm is equal to the
+ * number given as a parameter.
+ * 
+ * @param D - The number to compare to this vector's
+ *            norm
+ */
+template <typename T>
+inline bool BasicVector<T>::operator==(const T D) const {
+    return this->norm() == D;
+}
+
+/**
+ * Tests whether this vector's norm is different from
+ * the number given as a parameter.
+ * 
+ * @param D - The number to compare to this vector's
+ *            norm
+ */
+template <typename T>
+inline bool BasicVector<T>::operator!=(const T D) const {
+    return !(*this == D);
+}
+
+#endif // _VECTOR_H_
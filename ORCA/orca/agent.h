@@ -1,129 +1,213 @@
-/**
- * File  : agent.h
- * Author: Raja Soufi
- * 
- * Class definition of an agent with a position,
- * radius, destination.
- */
-
-// Include guard
-#ifndef _AGENT_H_
-#define _AGENT_H_
-
-// Inclusions
-#include <vector>
-
-#include "../geom/halfPlane.h"
-#include "../geom/point.h"
-
-#include "orca.h"
-
-// Class definition
-class Agent {
-    
-    #ifdef _DEMO_H_
-    friend class Demo;
-    #endif // _DEMO_H_
-    
-    private:
-    
-    // Attributes
-    static int id_counter;
-    
-    int id_;
-    Point position_, destination_;
-    Vector velocity_, prefVelocity_;
-    double radius_, maxSpeed_;
-    
-    public:
-    
-    // Constructors
-    Agent(const Point& POSITION, const double RADIUS, const double MAX_SPEED);
-    Agent(const Point& POSITION, const Point& DESTINATION, const double RADIUS, const double MAX_SPEED);
-    
-    // Destructor
-    ~Agent(void);
-    
-    // Getters
-    inline int id(void) const;
-    inline const Point& position(void) const;
-    inline const Vector& velocity(void) const;
-    inline double radius(void) const;
-    
-    // Other methods
-    bool arrived(const double ARRIVAL_THRESHOLD = 0.0) const;
-    
-    void move(const double DELTA_T);
-    void updateVelocity(const Vector& V);
-    
-    Point solveLinearProgram(std::vector<HalfPlane>& halfPlanes) const;
-    
-    std::vector<HalfPlane> orca_A(std::vector<Agent>& agents, const double TAU) const;
-    HalfPlane orca_A_B(const Agent& B, const double TAU) const;
-    
-    // Operators
-    inline bool operator==(const Agent& THAT) const;
-    inline bool operator!=(const Agent& THAT) const;
-    
-};
-
-/*
-    Getters
-*/
-
-/**
- * Returns the ID of this agent.
- */
-inline int Agent::id(void) const {
-    return this->id_;
-}
-
-/**
- * Returns the position of this agent.
- */
-inline const Point& Agent::position(void) const {
-    return this->position_;
-}
-
-/**
- * Returns the current velocity of this agent.
- */
-inline const Vector& Agent::velocity(void) const {
-    return this->velocity_;
-}
-
-/**
- * Returns the radius of this agent.
- */
-inline double Agent::radius(void) const {
-    return this->radius_;
-}
-
-/*
-    Operators
-*/
-
-/**
- * Tests whether this agent is equal to the agent
- * passed as a parameter, in the sense that it is
- * the exact same agent with the same agent ID.
- * 
- * @param THAT - The agent to compare to this agent
- */
-inline bool Agent::operator==(const Agent& THAT) const {
-    return this->id_ == THAT.id();
-}
-
-/**
- * Tests whether this agent is different from the
- * agent passed as a parameter, in the sense that
- * they are different agents with different agent
- * IDs.
- * 
- * @param THAT - The agent to compare to this agent
- */
-inline bool Agent::operator!=(const Agent& THAT) const {
-    return !(*this == THAT);
-}
-
-#endif // _AGENT_H_
+/**
+ * File  : agent.h
+ * Author: Raja Soufi
+ * 
+ * Class definition of an agent with a position,
+ * radius, destination.
+ */
+
+// Include guard
+#ifndef _AGENT_H_
+#define _AGENT_H_
+
+// Inclusions
+#include <atomic>
+#include <utility>
+#include <vector>
+
+#include "../geom/directedHalfPlane.h"
+#include "../geom/point.h"
+
+#include "orca.h"
+
+// Class definition
+class Agent {
+    
+    #ifdef _DEMO_H_
+    friend class Demo;
+    #endif // _DEMO_H_
+    
+    private:
+    
+    // Attributes
+    static std::atomic<int> id_counter;
+    
+    int id_;
+    Point position_, destination_;
+    Vector velocity_, prefVelocity_;
+    double radius_, maxSpeed_;
+    double neighborDist_;
+    int maxNeighbors_;
+    
+    // Helpers
+    void keepNearestNeighbors(std::vector<std::pair<double, int> >& neighbors) const;
+    
+    public:
+    
+    // Constructors
+    Agent(const Point& POSITION, const double RADIUS, const double MAX_SPEED);
+    Agent(const Point& POSITION, const Point& DESTINATION, const double RADIUS, const double MAX_SPEED);
+    Agent(const Point& POSITION, const Point& DESTINATION, const double RADIUS, const double MAX_SPEED,
+        const double NEIGHBOR_DIST, const int MAX_NEIGHBORS);
+    
+    // Destructor
+    ~Agent(void);
+    
+    // Getters
+    inline int id(void) const;
+    inline const Point& position(void) const;
+    inline const Vector& velocity(void) const;
+    inline const Vector& prefVelocity(void) const;
+    inline const Point& destination(void) const;
+    inline double radius(void) const;
+    inline double maxSpeed(void) const;
+    inline double neighborDist(void) const;
+    inline int maxNeighbors(void) const;
+    
+    // Setters
+    inline void setNeighborDist(const double NEIGHBOR_DIST);
+    inline void setMaxNeighbors(const int MAX_NEIGHBORS);
+    
+    // Other methods
+    bool arrived(const double ARRIVAL_THRESHOLD = 0.0) const;
+    
+    void move(const double DELTA_T);
+    void updateVelocity(const Vector& V);
+    
+    Point solveLinearProgram(std::vector<DirectedHalfPlane>& halfPlanes) const;
+    
+    std::vector<DirectedHalfPlane> orca_A(std::vector<Agent>& agents, const double TAU) const;
+    DirectedHalfPlane orca_A_B(const Agent& B, const double TAU) const;
+    
+    // Operators
+    inline bool operator==(const Agent& THAT) const;
+    inline bool operator!=(const Agent& THAT) const;
+    
+};
+
+/*
+    Getters
+*/
+
+/**
+ * Returns the ID of this agent.
+ */
+inline int Agent::id(void) const {
+    return this->id_;
+}
+
+/**
+ * Returns the position of this agent.
+ */
+inline const Point& Agent::position(void) const {
+    return this->position_;
+}
+
+/**
+ * Returns the current velocity of this agent.
+ */
+inline const Vector& Agent::velocity(void) const {
+    return this->velocity_;
+}
+
+/**
+ * Returns the preferred velocity of this agent.
+ */
+inline const Vector& Agent::prefVelocity(void) const {
+    return this->prefVelocity_;
+}
+
+/**
+ * Returns the destination of this agent.
+ */
+inline const Point& Agent::destination(void) const {
+    return this->destination_;
+}
+
+/**
+ * Returns the radius of this agent.
+ */
+inline double Agent::radius(void) const {
+    return this->radius_;
+}
+
+/**
+ * Returns the maximum speed of this agent.
+ */
+inline double Agent::maxSpeed(void) const {
+    return this->maxSpeed_;
+}
+
+/**
+ * Returns the distance within which other agents
+ * are taken into account when computing ORCA_A^TAU,
+ * where A is this agent.
+ */
+inline double Agent::neighborDist(void) const {
+    return this->neighborDist_;
+}
+
+/**
+ * Returns the maximum number of other agents taken
+ * into account when computing ORCA_A^TAU, where A
+ * is this agent.
+ */
+inline int Agent::maxNeighbors(void) const {
+    return this->maxNeighbors_;
+}
+
+/*
+    Setters
+*/
+
+/**
+ * Sets the distance within which other agents are
+ * taken into account when computing ORCA_A^TAU,
+ * where A is this agent.
+ * 
+ * @param NEIGHBOR_DIST - The new neighbor distance
+ */
+inline void Agent::setNeighborDist(const double NEIGHBOR_DIST) {
+    this->neighborDist_ = NEIGHBOR_DIST;
+}
+
+/**
+ * Sets the maximum number of other agents taken
+ * into account when computing ORCA_A^TAU, where A
+ * is this agent. Only the nearest ones are kept.
+ * 
+ * @param MAX_NEIGHBORS - The new maximum number of
+ *                        neighbors
+ */
+inline void Agent::setMaxNeighbors(const int MAX_NEIGHBORS) {
+    this->maxNeighbors_ = MAX_NEIGHBORS;
+}
+
+/*
+    Operators
+*/
+
+/**
+ * Tests whether this agent is equal to the agent
+ * passed as a parameter, in the sense that it is
+ * the exact same agent with the same agent ID.
+ * 
+ * @param THAT - The agent to compare to this agent
+ */
+inline bool Agent::operator==(const Agent& THAT) const {
+    return this->id_ == THAT.id();
+}
+
+/**
+ * Tests whether this agent is different from the
+ * agent passed as a parameter, in the sense that
+ * they are different agents with different agent
+ * IDs.
+ * 
+ * @param THAT - The agent to compare to this agent
+ */
+inline bool Agent::operator!=(const Agent& THAT) const {
+    return !(*this == THAT);
+}
+
+#endif // _AGENT_H_
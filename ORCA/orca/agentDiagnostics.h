@@ -0,0 +1,66 @@
+/**
+ * File  : agentDiagnostics.h
+ * Author: Raja Soufi
+ * 
+ * Definition of the diagnostics a simulation records
+ * for the agents selected for it at each iteration:
+ * the half-planes of ORCA_A^TAU the solver built for
+ * the agent, the neighbors behind them, and the
+ * solution of its linear program.
+ * 
+ * Viewers and debugging tools read these records
+ * rather than computing the half-planes again, so
+ * that they see exactly what the solver used.
+ */
+
+// Include guard
+#ifndef _AGENT_DIAGNOSTICS_H_
+#define _AGENT_DIAGNOSTICS_H_
+
+// Inclusions
+#include <cstddef>
+#include <vector>
+
+#include "../geom/directedHalfPlane.h"
+#include "../geom/point.h"
+#include "../geom/vector.h"
+
+// Structure definition
+template <typename T>
+struct BasicAgentDiagnostics {
+    
+    // The index and id of the agent
+    size_t index;
+    int id;
+    
+    // Its position and velocity during the iteration
+    BasicPoint<T> position;
+    BasicVector<T> velocity;
+    
+    // The half-planes of ORCA_A^TAU, in the velocity
+    // space of the agent, those of the obstacles first,
+    // then those of the neighbors, whose indices are
+    // listed in the same order
+    std::vector<BasicDirectedHalfPlane<T> > halfPlanes;
+    size_t obstacleCount;
+    std::vector<int> neighbors;
+    
+    // The solution of the linear program, and whether
+    // it was infeasible, in which case the solution
+    // violates the half-planes as little as possible
+    BasicPoint<T> solution;
+    bool infeasible;
+    
+    // Whether the agent was not solved for during the
+    // last iteration, being asleep or not iterated
+    // since it was selected, in which case the record
+    // is left from the last iteration it was solved in
+    bool stale;
+    
+};
+
+// Precisions
+typedef BasicAgentDiagnostics<float> AgentDiagnosticsF;
+typedef BasicAgentDiagnostics<double> AgentDiagnostics;
+
+#endif // _AGENT_DIAGNOSTICS_H_
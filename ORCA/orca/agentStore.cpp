@@ -0,0 +1,567 @@
+/**
+ * File  : agentStore.cpp
+ * Author: Raja Soufi
+ * 
+ * Implementation of the AgentStore class defined
+ * in agentStore.h.
+ */
+
+// Include header file
+#include "agentStore.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "../utilities/utilities.h"
+
+#include "agent.h"
+#include "kdTree.h"
+#include "obstacleTree.h"
+#include "orca.h"
+#include "spatialHash.h"
+
+/*
+    Constants
+*/
+
+/**
+ * The number of half-planes bounding the solution of
+ * the linear program of an agent that are remembered
+ * to be tried first at the next iteration. Two lines
+ * are enough to pin a point down.
+ */
+template <typename T>
+const size_t BasicAgentStore<T>::ACTIVE_COUNT = 2;
+
+/**
+ * The distance to its bounding line within which a
+ * solution is considered to lie on it.
+ */
+template <typename T>
+const double BasicAgentStore<T>::ACTIVE_TOLERANCE = 1e-6;
+
+/*
+    Constructors
+*/
+
+/**
+ * Constructs an empty store.
+ */
+template <typename T>
+BasicAgentStore<T>::BasicAgentStore(void) {}
+
+/**
+ * Constructs a store holding a copy of the agents
+ * given as a parameter, in the same order.
+ * 
+ * @param AGENTS - The agents to store
+ */
+template <typename T>
+BasicAgentStore<T>::BasicAgentStore(const std::vector<Agent>& AGENTS) {
+    for (const Agent& agent : AGENTS) {
+        this->add(agent);
+    }
+}
+
+/*
+    Other methods
+*/
+
+/**
+ * Appends a copy of the agent given as a parameter
+ * to this store, converted to the scalar type of
+ * the store.
+ * 
+ * @param AGENT - The agent to add
+ */
+template <typename T>
+void BasicAgentStore<T>::add(const Agent& AGENT) {
+    // Seed the engine of the agent with its index, so that
+    // simulations of the same agents are reproducible
+    this->random_.push_back(std::minstd_rand(static_cast<unsigned int>(this->size()) + 1));
+    this->active_.insert(this->active_.end(), BasicAgentStore::ACTIVE_COUNT, -1);
+    this->id_.push_back(AGENT.id());
+    this->positionX_.push_back(static_cast<T>(AGENT.position().x()));
+    this->positionY_.push_back(static_cast<T>(AGENT.position().y()));
+    this->velocityX_.push_back(static_cast<T>(AGENT.velocity().x()));
+    this->velocityY_.push_back(static_cast<T>(AGENT.velocity().y()));
+    this->prefVelocityX_.push_back(static_cast<T>(AGENT.prefVelocity().x()));
+    this->prefVelocityY_.push_back(static_cast<T>(AGENT.prefVelocity().y()));
+    this->destinationX_.push_back(static_cast<T>(AGENT.destination().x()));
+    this->destinationY_.push_back(static_cast<T>(AGENT.destination().y()));
+    this->radius_.push_back(static_cast<T>(AGENT.radius()));
+    this->maxSpeed_.push_back(static_cast<T>(AGENT.maxSpeed()));
+    this->neighborDist_.push_back(static_cast<T>(AGENT.neighborDist()));
+    this->maxNeighbors_.push_back(AGENT.maxNeighbors());
+}
+
+/**
+ * Removes all agents from this store.
+ */
+template <typename T>
+void BasicAgentStore<T>::clear(void) {
+    this->id_.clear();
+    this->positionX_.clear();
+    this->positionY_.clear();
+    this->velocityX_.clear();
+    this->velocityY_.clear();
+    this->prefVelocityX_.clear();
+    this->prefVelocityY_.clear();
+    this->destinationX_.clear();
+    this->destinationY_.clear();
+    this->radius_.clear();
+    this->maxSpeed_.clear();
+    this->neighborDist_.clear();
+    this->maxNeighbors_.clear();
+    this->random_.clear();
+    this->active_.clear();
+}
+
+
+/**
+ * Moves the agents with indices in [BEGIN, END) for
+ * DELTA_T time with their current velocity, and
+ * points their preferred velocity towards their
+ * destination, as in Agent::move. Given a skew, the
+ * preferred velocity is then rotated by a tiny angle
+ * depending on the index of the agent, which breaks
+ * the symmetry of configurations where the agents
+ * would otherwise block each other forever.
+ * 
+ * @param BEGIN   - The index of the first agent to move
+ * @param END     - One past the index of the last agent
+ *                  to move
+ * @param DELTA_T - The time during which to move the
+ *                  agents
+ * @param SKEW    - The maximum slope of the rotation of
+ *                  the preferred velocities, 0 leaving
+ *                  them pointed at the destinations
+ */
+template <typename T>
+void BasicAgentStore<T>::move(const size_t BEGIN, const size_t END, const T DELTA_T, const T SKEW) {
+    
+    for (size_t i = BEGIN ; i < END ; i++) {
+        this->positionX_[i] += this->velocityX_[i] * DELTA_T;
+        this->positionY_[i] += this->velocityY_[i] * DELTA_T;
+    }
+    
+    for (size_t i = BEGIN ; i < END ; i++) {
+        T dx = this->destinationX_[i] - this->positionX_[i];
+        T dy = this->destinationY_[i] - this->positionY_[i];
+        T norm = std::sqrt(dx * dx + dy * dy);
+        T scale = (norm > this->maxSpeed_[i]) ? this->maxSpeed_[i] / norm : 1;
+        // Rotate by a tiny angle, spread over the agents by
+        // their index and the golden ratio
+        T skew = static_cast<T>(SKEW * (trueMod(i * 0.6180339887498949, 1.0) - 0.5));
+        this->prefVelocityX_[i] = (dx - skew * dy) * scale;
+        this->prefVelocityY_[i] = (dy + skew * dx) * scale;
+    }
+    
+}
+
+
+/**
+ * Calls ORCA's function to solve a linear program
+ * given the set of half-planes of the workspace
+ * given as a parameter, with the preferred velocity
+ * and maximum speed of the I-th agent.
+ * Returns the solution to the linear program, or the
+ * velocity minimizing the maximum violation of the
+ * half-planes if it is infeasible.
+ * 
+ * The half-planes are shuffled with the agent's own
+ * random engine, so that the result does not depend
+ * on the thread solving it. With WARM_START, those of
+ * the neighbors whose half-planes bounded the previous
+ * solution of the agent are moved to the front, since
+ * they most likely bound the new one as well, in which
+ * case the others only need to be checked. The
+ * half-planes of static obstacles stay at the front,
+ * in their own order, and are never violated.
+ * 
+ * @param I          - The index of the agent
+ * @param WARM_START - Whether to try the half-planes of
+ *                     the previous solution first
+ * @param workspace  - The workspace holding the set of
+ *                     half-planes to use as input for
+ *                     the linear program, along with the
+ *                     neighbors they come from, told
+ *                     whether it was infeasible
+ */
+template <typename T>
+BasicPoint<T> BasicAgentStore<T>::solveLinearProgram(const size_t I, const bool WARM_START, Workspace& workspace) {
+    
+    std::vector<BasicDirectedHalfPlane<T> >& halfPlanes = workspace.halfPlanes;
+    std::vector<std::pair<T, int> >& neighbors = workspace.neighbors;
+    BasicDirectedHalfPlane<T>* neighborHalfPlanes = halfPlanes.data() + workspace.obstacleCount;
+    int* active = &this->active_[I * BasicAgentStore::ACTIVE_COUNT];
+    
+    // Move the half-planes of the previous solution to the front
+    size_t warm = 0;
+    
+    for (size_t a = 0 ; WARM_START && (a < BasicAgentStore::ACTIVE_COUNT) ; a++) {
+        for (size_t k = warm ; k < neighbors.size() ; k++) {
+            if (neighbors[k].second == active[a]) {
+                std::swap(neighbors[k], neighbors[warm]);
+                std::swap(neighborHalfPlanes[k], neighborHalfPlanes[warm]);
+                warm++;
+                break;
+            }
+        }
+    }
+    
+    // Shuffle the others
+    for (size_t k = neighbors.size() ; k > warm + 1 ; k--) {
+        size_t r = std::uniform_int_distribution<size_t>(warm, k - 1)(this->random_[I]);
+        std::swap(neighbors[k - 1], neighbors[r]);
+        std::swap(neighborHalfPlanes[k - 1], neighborHalfPlanes[r]);
+    }
+    
+    BasicPoint<T> solution;
+    StepStatistics& statistics = workspace.statistics;
+    ORCA::LinearProgramStatus status = ORCA::solveOrderedLinearProgram(halfPlanes, this->prefVelocity(I),
+        this->maxSpeed_[I], solution, workspace.bisectors, workspace.obstacleCount,
+        StepStatistics::enabled() ? &statistics.violations : NULL);
+        
+    workspace.infeasible = (status == ORCA::INFEASIBLE);
+    
+    if (StepStatistics::enabled()) {
+        statistics.linearPrograms++;
+        statistics.halfPlanes += halfPlanes.size();
+        statistics.maxHalfPlanes = std::max(statistics.maxHalfPlanes, halfPlanes.size());
+        statistics.infeasible += (status == ORCA::INFEASIBLE) ? 1 : 0;
+    }
+        
+    // Remember the neighbors whose half-planes are the most
+    // violated, among those the solution lies on or outside of,
+    // sorted by decreasing violation
+    T violations[BasicAgentStore::ACTIVE_COUNT];
+    
+    for (size_t a = 0 ; a < BasicAgentStore::ACTIVE_COUNT ; a++) {
+        violations[a] = - std::numeric_limits<T>::infinity();
+        active[a] = -1;
+    }
+    
+    for (size_t k = 0 ; k < neighbors.size() ; k++) {
+        T violation = neighborHalfPlanes[k].violation(BasicVector<T>(solution));
+        size_t a = BasicAgentStore::ACTIVE_COUNT;
+        while ((a > 0) && (violation > violations[a - 1])) {
+            if (a < BasicAgentStore::ACTIVE_COUNT) {
+                violations[a] = violations[a - 1];
+                active[a] = active[a - 1];
+            }
+            a--;
+        }
+        if (a < BasicAgentStore::ACTIVE_COUNT) {
+            violations[a] = violation;
+            active[a] = neighbors[k].second;
+        }
+    }
+    
+    T threshold = std::max(violations[0], T(0)) - BasicAgentStore::ACTIVE_TOLERANCE;
+    
+    for (size_t a = 0 ; a < BasicAgentStore::ACTIVE_COUNT ; a++) {
+        if (violations[a] < threshold) {
+            active[a] = -1;
+        }
+    }
+    
+    return solution;
+    
+}
+
+
+/**
+ * Computes ORCA_A^TAU, where A is the I-th agent, as
+ * the set of half-planes of the workspace given as a
+ * parameter, considering all agents of this store.
+ * 
+ * @param I         - The index of the agent A
+ * @param TAU       - The value of tau to be used when
+ *                    computing ORCA_A^TAU
+ * @param workspace - The workspace receiving ORCA_A^TAU
+ */
+template <typename T>
+void BasicAgentStore<T>::orca_A(const size_t I, const T TAU, Workspace& workspace) const {
+    this->findNeighbors(I, workspace);
+    this->computeHalfPlanes(I, TAU, workspace);
+}
+
+/**
+ * Computes ORCA_A^TAU, where A is the I-th agent, as
+ * the set of half-planes of the workspace given as a
+ * parameter, only considering the agents found
+ * around A in the spatial hash given as a parameter.
+ * 
+ * @param I         - The index of the agent A
+ * @param GRID      - A spatial hash built from this store
+ * @param TAU       - The value of tau to be used when
+ *                    computing ORCA_A^TAU
+ * @param workspace - The workspace receiving ORCA_A^TAU
+ */
+template <typename T>
+void BasicAgentStore<T>::orca_A(const size_t I, const BasicSpatialHash<T>& GRID, const T TAU,
+    Workspace& workspace) const
+{
+    this->findNeighbors(I, GRID, workspace);
+    this->computeHalfPlanes(I, TAU, workspace);
+}
+
+/**
+ * Computes ORCA_A^TAU, where A is the I-th agent, as
+ * the set of half-planes of the workspace given as a
+ * parameter, only considering the nearest agents
+ * found around A in the k-d tree given as a
+ * parameter.
+ * 
+ * @param I         - The index of the agent A
+ * @param TREE      - A k-d tree built from this store
+ * @param TAU       - The value of tau to be used when
+ *                    computing ORCA_A^TAU
+ * @param workspace - The workspace receiving ORCA_A^TAU
+ */
+template <typename T>
+void BasicAgentStore<T>::orca_A(const size_t I, const BasicKdTree<T>& TREE, const T TAU,
+    Workspace& workspace) const
+{
+    this->findNeighbors(I, TREE, workspace);
+    this->computeHalfPlanes(I, TAU, workspace);
+}
+
+/**
+ * Sets the neighbors of the workspace given as a
+ * parameter to the agents B within the neighbor
+ * distance of A, the I-th agent, at most its maximum
+ * number of neighbors, considering all agents of
+ * this store.
+ * 
+ * @param I         - The index of the agent A
+ * @param workspace - The workspace receiving the
+ *                    neighbors of A
+ */
+template <typename T>
+void BasicAgentStore<T>::findNeighbors(const size_t I, Workspace& workspace) const {
+    
+    // The agents B within the neighbor distance of A
+    std::vector<std::pair<T, int> >& neighbors = workspace.neighbors;
+    T rangeSq = this->neighborDist_[I] * this->neighborDist_[I];
+    
+    neighbors.clear();
+    
+    // For each agent B...
+    for (size_t j = 0 ; j < this->size() ; j++) {
+        T dx = this->positionX_[j] - this->positionX_[I];
+        T dy = this->positionY_[j] - this->positionY_[I];
+        T distSq = dx * dx + dy * dy;
+        if ((j != I) && (distSq <= rangeSq)) {
+            neighbors.push_back(std::make_pair(distSq, static_cast<int>(j)));
+        }
+    }
+    
+    this->keepNearestNeighbors(I, neighbors);
+    
+}
+
+/**
+ * Sets the neighbors of the workspace given as a
+ * parameter to the agents B within the neighbor
+ * distance of A, the I-th agent, at most its maximum
+ * number of neighbors, only considering the agents
+ * found around A in the spatial hash given as a
+ * parameter.
+ * 
+ * @param I         - The index of the agent A
+ * @param GRID      - A spatial hash built from this store
+ * @param workspace - The workspace receiving the
+ *                    neighbors of A
+ */
+template <typename T>
+void BasicAgentStore<T>::findNeighbors(const size_t I, const BasicSpatialHash<T>& GRID,
+    Workspace& workspace) const
+{
+    
+    // The agents lying in the cells around A
+    std::vector<int>& candidates = workspace.candidates;
+    candidates.clear();
+    GRID.query(this->position(I), this->neighborDist_[I], candidates);
+    
+    // The agents B within the neighbor distance of A
+    std::vector<std::pair<T, int> >& neighbors = workspace.neighbors;
+    T rangeSq = this->neighborDist_[I] * this->neighborDist_[I];
+    
+    neighbors.clear();
+    
+    // For each candidate agent B...
+    for (int j : candidates) {
+        T dx = this->positionX_[j] - this->positionX_[I];
+        T dy = this->positionY_[j] - this->positionY_[I];
+        T distSq = dx * dx + dy * dy;
+        if ((static_cast<size_t>(j) != I) && (distSq <= rangeSq)) {
+            neighbors.push_back(std::make_pair(distSq, j));
+        }
+    }
+    
+    this->keepNearestNeighbors(I, neighbors);
+    
+}
+
+/**
+ * Sets the neighbors of the workspace given as a
+ * parameter to the nearest agents B within the
+ * neighbor distance of A, the I-th agent, at most
+ * its maximum number of neighbors, found in the k-d
+ * tree given as a parameter.
+ * 
+ * @param I         - The index of the agent A
+ * @param TREE      - A k-d tree built from this store
+ * @param workspace - The workspace receiving the
+ *                    neighbors of A
+ */
+template <typename T>
+void BasicAgentStore<T>::findNeighbors(const size_t I, const BasicKdTree<T>& TREE,
+    Workspace& workspace) const
+{
+    
+    // The nearest agents B within the neighbor distance of A.
+    // One more agent is requested since A itself is found
+    std::vector<std::pair<T, int> >& neighbors = workspace.neighbors;
+    size_t maxNeighbors = static_cast<size_t>(std::max(this->maxNeighbors_[I], 0));
+    TREE.query(this->position(I), this->neighborDist_[I],
+        (maxNeighbors < this->size()) ? maxNeighbors + 1 : this->size(), neighbors);
+        
+    // Leave A itself out
+    neighbors.erase(std::remove_if(neighbors.begin(), neighbors.end(),
+        [I](const std::pair<T, int>& NEIGHBOR) { return static_cast<size_t>(NEIGHBOR.second) == I; }),
+        neighbors.end());
+        
+    if (neighbors.size() > maxNeighbors) {
+        neighbors.resize(maxNeighbors);
+    }
+    
+}
+
+/**
+ * Sets the half-planes of the workspace given as a
+ * parameter to ORCA_A|B^TAU for each agent B of its
+ * list of neighbors, made of (squared distance,
+ * index) pairs, where A is the I-th agent. The
+ * neighbors are gathered into contiguous arrays and
+ * handed to the batched kernel of ORCA.
+ * 
+ * @param I         - The index of the agent A
+ * @param TAU       - The value of tau to be used when
+ *                    computing ORCA_A|B^TAU
+ * @param workspace - The workspace holding the neighbors
+ *                    and receiving the half-planes
+ */
+template <typename T>
+void BasicAgentStore<T>::computeHalfPlanes(const size_t I, const T TAU, Workspace& workspace) const {
+    
+    const std::vector<std::pair<T, int> >& NEIGHBORS = workspace.neighbors;
+    size_t count = NEIGHBORS.size();
+    
+    std::vector<T>& gathered = workspace.gathered;
+    gathered.resize(5 * count);
+    OrcaKernel::Neighbors<T> neighbors = {
+        gathered.data(), gathered.data() + count, gathered.data() + 2 * count,
+        gathered.data() + 3 * count, gathered.data() + 4 * count
+    };
+    
+    for (size_t k = 0 ; k < count ; k++) {
+        int j = NEIGHBORS[k].second;
+        gathered[k] = this->positionX_[j];
+        gathered[count + k] = this->positionY_[j];
+        gathered[2 * count + k] = this->velocityX_[j];
+        gathered[3 * count + k] = this->velocityY_[j];
+        gathered[4 * count + k] = this->radius_[j];
+    }
+    
+    std::vector<T>& lines = workspace.lines;
+    lines.resize(4 * count);
+    OrcaKernel::HalfPlanes<T> out = {
+        lines.data(), lines.data() + count, lines.data() + 2 * count, lines.data() + 3 * count
+    };
+    
+    workspace.halfPlanes.resize(workspace.obstacleCount);
+    ORCA::orca_A_B(this->position(I), this->velocity(I), this->radius_[I],
+        neighbors, count, TAU, out, workspace.halfPlanes);
+        
+}
+
+/**
+ * Returns ORCA_A|B^TAU as a half-plane, where A is
+ * the I-th agent and B is the J-th agent.
+ * 
+ * @param I   - The index of the agent A
+ * @param J   - The index of the agent B
+ * @param TAU - The value of tau to be used when
+ *              computing ORCA_A|B^TAU
+ */
+template <typename T>
+BasicDirectedHalfPlane<T> BasicAgentStore<T>::orca_A_B(const size_t I, const size_t J, const T TAU) const {
+    
+    return ORCA::orca_A_B(this->position(I), this->velocity(I), this->radius_[I],
+        this->position(J), this->velocity(J), this->radius_[J], TAU);
+        
+}
+
+/**
+ * Computes ORCA_A|O^TAU, where A is the I-th agent,
+ * for the edges O of the obstacles given as a
+ * parameter that A could reach within TAU, as the
+ * first half-planes of the workspace given as a
+ * parameter. This must be done before computing the
+ * half-planes of the neighbors of A, which follow
+ * them.
+ * 
+ * @param I         - The index of the agent A
+ * @param OBSTACLES - The tree holding the obstacles
+ * @param TAU       - The value of tau to be used when
+ *                    computing ORCA_A|O^TAU
+ * @param workspace - The workspace receiving ORCA_A|O^TAU
+ */
+template <typename T>
+void BasicAgentStore<T>::orca_A_O(const size_t I, const BasicObstacleTree<T>& OBSTACLES, const T TAU,
+    Workspace& workspace) const
+{
+    
+    OBSTACLES.query(this->position(I), TAU * this->maxSpeed_[I] + this->radius_[I], workspace.edges);
+    
+    workspace.halfPlanes.clear();
+    ORCA::orca_A_O(this->position(I), this->velocity(I), this->radius_[I],
+        OBSTACLES, workspace.edges, TAU, workspace.halfPlanes);
+    workspace.obstacleCount = workspace.halfPlanes.size();
+    
+}
+
+/*
+    Helpers
+*/
+
+/**
+ * Reduces the list of neighbors given as a parameter,
+ * made of (squared distance, index) pairs, to the
+ * maximum number of neighbors of the I-th agent by
+ * only keeping the nearest ones.
+ * 
+ * @param I         - The index of the agent
+ * @param neighbors - The list of neighbors to reduce
+ */
+template <typename T>
+void BasicAgentStore<T>::keepNearestNeighbors(const size_t I, std::vector<std::pair<T, int> >& neighbors) const {
+    
+    size_t maxNeighbors = static_cast<size_t>(std::max(this->maxNeighbors_[I], 0));
+    
+    if (neighbors.size() > maxNeighbors) {
+        std::nth_element(neighbors.begin(), neighbors.begin() + maxNeighbors, neighbors.end());
+        neighbors.resize(maxNeighbors);
+    }
+    
+}
+
+/*
+    Explicit instantiations
+*/
+
+template class BasicAgentStore<float>;
+template class BasicAgentStore<double>;
@@ -0,0 +1,497 @@
+/**
+ * File  : agentStore.h
+ * Author: Raja Soufi
+ * 
+ * Class definition of the structure-of-arrays
+ * storage of the agents registered in the ORCA
+ * system, along with AgentView, a lightweight
+ * handle on one of the stored agents.
+ * 
+ * Each attribute of the agents is kept in its own
+ * contiguous array, indexed by the position of the
+ * agent in the store, so that the loops of an
+ * iteration only stream through the attributes
+ * they actually use.
+ * 
+ * The attributes are stored with the scalar type T,
+ * float or double, which halves the memory streamed
+ * by an iteration in single precision. The agents
+ * added to a store are converted to that type.
+ */
+
+// Include guard
+#ifndef _AGENT_STORE_H_
+#define _AGENT_STORE_H_
+
+// Inclusions
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../geom/directedHalfPlane.h"
+#include "../geom/point.h"
+#include "../geom/vector.h"
+
+#include "stepContext.h"
+
+// Forward-declarations
+class Agent;
+template <typename T> class BasicAgentView;
+template <typename T> class BasicKdTree;
+template <typename T> class BasicObstacleTree;
+template <typename T> class BasicSpatialHash;
+
+// Class definition
+template <typename T>
+class BasicAgentStore {
+    
+    public:
+    
+    // Temporary lists used by a thread for one agent
+    typedef typename BasicStepContext<T>::Workspace Workspace;
+    
+    private:
+    
+    // Constants
+    static const size_t ACTIVE_COUNT;
+    static const double ACTIVE_TOLERANCE;
+    
+    // Attributes
+    std::vector<int> id_;
+    std::vector<T> positionX_, positionY_;
+    std::vector<T> velocityX_, velocityY_;
+    std::vector<T> prefVelocityX_, prefVelocityY_;
+    std::vector<T> destinationX_, destinationY_;
+    std::vector<T> radius_, maxSpeed_;
+    std::vector<T> neighborDist_;
+    std::vector<int> maxNeighbors_;
+    
+    std::vector<std::minstd_rand> random_;
+    std::vector<int> active_;
+    
+    // Helpers
+    void keepNearestNeighbors(const size_t I, std::vector<std::pair<T, int> >& neighbors) const;
+    
+    public:
+    
+    // Constructors
+    BasicAgentStore(void);
+    BasicAgentStore(const std::vector<Agent>& AGENTS);
+    
+    // Getters
+    inline size_t size(void) const;
+    
+    inline int id(const size_t I) const;
+    inline BasicPoint<T> position(const size_t I) const;
+    inline BasicVector<T> velocity(const size_t I) const;
+    inline BasicVector<T> prefVelocity(const size_t I) const;
+    inline BasicPoint<T> destination(const size_t I) const;
+    inline T radius(const size_t I) const;
+    inline T maxSpeed(const size_t I) const;
+    inline T neighborDist(const size_t I) const;
+    inline int maxNeighbors(const size_t I) const;
+    
+    inline const T* positionX(void) const;
+    inline const T* positionY(void) const;
+    inline const T* velocityX(void) const;
+    inline const T* velocityY(void) const;
+    inline const T* radius(void) const;
+    
+    // Setters
+    inline void setNeighborDist(const size_t I, const T NEIGHBOR_DIST);
+    inline void setMaxNeighbors(const size_t I, const int MAX_NEIGHBORS);
+    
+    // Other methods
+    void add(const Agent& AGENT);
+    void clear(void);
+    
+    inline bool arrived(const size_t I, const T ARRIVAL_THRESHOLD = 0.0) const;
+    
+    void move(const size_t BEGIN, const size_t END, const T DELTA_T, const T SKEW = 0);
+    inline void updateVelocity(const size_t I, const BasicVector<T>& V);
+    
+    BasicPoint<T> solveLinearProgram(const size_t I, const bool WARM_START, Workspace& workspace);
+    
+    void orca_A(const size_t I, const T TAU, Workspace& workspace) const;
+    void orca_A(const size_t I, const BasicSpatialHash<T>& GRID, const T TAU,
+        Workspace& workspace) const;
+    void orca_A(const size_t I, const BasicKdTree<T>& TREE, const T TAU,
+        Workspace& workspace) const;
+    BasicDirectedHalfPlane<T> orca_A_B(const size_t I, const size_t J, const T TAU) const;
+    
+    void findNeighbors(const size_t I, Workspace& workspace) const;
+    void findNeighbors(const size_t I, const BasicSpatialHash<T>& GRID, Workspace& workspace) const;
+    void findNeighbors(const size_t I, const BasicKdTree<T>& TREE, Workspace& workspace) const;
+    void computeHalfPlanes(const size_t I, const T TAU, Workspace& workspace) const;
+    void orca_A_O(const size_t I, const BasicObstacleTree<T>& OBSTACLES, const T TAU,
+        Workspace& workspace) const;
+    
+    // Operators
+    inline BasicAgentView<T> operator[](const size_t I) const;
+    
+};
+
+// Class definition
+template <typename T>
+class BasicAgentView {
+    
+    private:
+    
+    // Attributes
+    const BasicAgentStore<T>* store_;
+    size_t index_;
+    
+    public:
+    
+    // Constructor
+    inline BasicAgentView(const BasicAgentStore<T>& STORE, const size_t INDEX);
+    
+    // Getters
+    inline size_t index(void) const;
+    inline int id(void) const;
+    inline BasicPoint<T> position(void) const;
+    inline BasicVector<T> velocity(void) const;
+    inline BasicVector<T> prefVelocity(void) const;
+    inline BasicPoint<T> destination(void) const;
+    inline T radius(void) const;
+    inline T maxSpeed(void) const;
+    
+    // Other methods
+    inline bool arrived(const T ARRIVAL_THRESHOLD = 0.0) const;
+    
+};
+
+// Precisions
+typedef BasicAgentStore<float> AgentStoreF;
+typedef BasicAgentStore<double> AgentStore;
+typedef BasicAgentView<float> AgentViewF;
+typedef BasicAgentView<double> AgentView;
+
+/*
+    AgentStore getters
+*/
+
+/**
+ * Returns the number of agents in this store.
+ */
+template <typename T>
+inline size_t BasicAgentStore<T>::size(void) const {
+    return this->id_.size();
+}
+
+/**
+ * Returns the ID of the I-th agent.
+ * 
+ * @param I - The index of the agent
+ */
+template <typename T>
+inline int BasicAgentStore<T>::id(const size_t I) const {
+    return this->id_[I];
+}
+
+/**
+ * Returns the position of the I-th agent.
+ * 
+ * @param I - The index of the agent
+ */
+template <typename T>
+inline BasicPoint<T> BasicAgentStore<T>::position(const size_t I) const {
+    return BasicPoint<T>(this->positionX_[I], this->positionY_[I]);
+}
+
+/**
+ * Returns the current velocity of the I-th agent.
+ * 
+ * @param I - The index of the agent
+ */
+template <typename T>
+inline BasicVector<T> BasicAgentStore<T>::velocity(const size_t I) const {
+    return BasicVector<T>(this->velocityX_[I], this->velocityY_[I]);
+}
+
+/**
+ * Returns the preferred velocity of the I-th agent.
+ * 
+ * @param I - The index of the agent
+ */
+template <typename T>
+inline BasicVector<T> BasicAgentStore<T>::prefVelocity(const size_t I) const {
+    return BasicVector<T>(this->prefVelocityX_[I], this->prefVelocityY_[I]);
+}
+
+/**
+ * Returns the destination of the I-th agent.
+ * 
+ * @param I - The index of the agent
+ */
+template <typename T>
+inline BasicPoint<T> BasicAgentStore<T>::destination(const size_t I) const {
+    return BasicPoint<T>(this->destinationX_[I], this->destinationY_[I]);
+}
+
+/**
+ * Returns the radius of the I-th agent.
+ * 
+ * @param I - The index of the agent
+ */
+template <typename T>
+inline T BasicAgentStore<T>::radius(const size_t I) const {
+    return this->radius_[I];
+}
+
+/**
+ * Returns the maximum speed of the I-th agent.
+ * 
+ * @param I - The index of the agent
+ */
+template <typename T>
+inline T BasicAgentStore<T>::maxSpeed(const size_t I) const {
+    return this->maxSpeed_[I];
+}
+
+/**
+ * Returns the neighbor distance of the I-th agent.
+ * 
+ * @param I - The index of the agent
+ */
+template <typename T>
+inline T BasicAgentStore<T>::neighborDist(const size_t I) const {
+    return this->neighborDist_[I];
+}
+
+/**
+ * Returns the maximum number of neighbors of the
+ * I-th agent.
+ * 
+ * @param I - The index of the agent
+ */
+template <typename T>
+inline int BasicAgentStore<T>::maxNeighbors(const size_t I) const {
+    return this->maxNeighbors_[I];
+}
+
+/**
+ * Returns the array of the x-coordinates of the
+ * positions of the agents.
+ */
+template <typename T>
+inline const T* BasicAgentStore<T>::positionX(void) const {
+    return this->positionX_.data();
+}
+
+/**
+ * Returns the array of the y-coordinates of the
+ * positions of the agents.
+ */
+template <typename T>
+inline const T* BasicAgentStore<T>::positionY(void) const {
+    return this->positionY_.data();
+}
+
+/**
+ * Returns the array of the x-coordinates of the
+ * velocities of the agents.
+ */
+template <typename T>
+inline const T* BasicAgentStore<T>::velocityX(void) const {
+    return this->velocityX_.data();
+}
+
+/**
+ * Returns the array of the y-coordinates of the
+ * velocities of the agents.
+ */
+template <typename T>
+inline const T* BasicAgentStore<T>::velocityY(void) const {
+    return this->velocityY_.data();
+}
+
+/**
+ * Returns the array of the radii of the agents.
+ */
+template <typename T>
+inline const T* BasicAgentStore<T>::radius(void) const {
+    return this->radius_.data();
+}
+
+/*
+    AgentStore setters
+*/
+
+/**
+ * Sets the neighbor distance of the I-th agent.
+ * 
+ * @param I             - The index of the agent
+ * @param NEIGHBOR_DIST - The new neighbor distance
+ */
+template <typename T>
+inline void BasicAgentStore<T>::setNeighborDist(const size_t I, const T NEIGHBOR_DIST) {
+    this->neighborDist_[I] = NEIGHBOR_DIST;
+}
+
+/**
+ * Sets the maximum number of neighbors of the I-th
+ * agent.
+ * 
+ * @param I             - The index of the agent
+ * @param MAX_NEIGHBORS - The new maximum number of
+ *                        neighbors
+ */
+template <typename T>
+inline void BasicAgentStore<T>::setMaxNeighbors(const size_t I, const int MAX_NEIGHBORS) {
+    this->maxNeighbors_[I] = MAX_NEIGHBORS;
+}
+
+/*
+    AgentStore other methods
+*/
+
+/**
+ * Tests whether the I-th agent has reached its
+ * destination within the given threshold distance.
+ * 
+ * @param I                 - The index of the agent
+ * @param ARRIVAL_THRESHOLD - The maximum distance at which
+ *                            the agent would be considered
+ *                            to have reached its destination
+ */
+template <typename T>
+inline bool BasicAgentStore<T>::arrived(const size_t I, const T ARRIVAL_THRESHOLD/* = 0.0 */) const {
+    T dx = this->destinationX_[I] - this->positionX_[I];
+    T dy = this->destinationY_[I] - this->positionY_[I];
+    return dx * dx + dy * dy <= ARRIVAL_THRESHOLD * ARRIVAL_THRESHOLD;
+}
+
+/**
+ * Updates the current velocity of the I-th agent to
+ * the one given as a parameter, after normalizing it
+ * to the norm of the agent's preferred velocity in
+ * case it exceeds it.
+ * 
+ * @param I - The index of the agent
+ * @param V - The new velocity for the agent
+ */
+template <typename T>
+inline void BasicAgentStore<T>::updateVelocity(const size_t I, const BasicVector<T>& V) {
+    BasicVector<T> velocity = BasicVector<T>(V).limitNorm(this->prefVelocity(I));
+    this->velocityX_[I] = velocity.x();
+    this->velocityY_[I] = velocity.y();
+}
+
+/*
+    AgentStore operators
+*/
+
+/**
+ * Returns a handle on the I-th agent.
+ * 
+ * @param I - The index of the agent
+ */
+template <typename T>
+inline BasicAgentView<T> BasicAgentStore<T>::operator[](const size_t I) const {
+    return BasicAgentView<T>(*this, I);
+}
+
+/*
+    AgentView constructor
+*/
+
+/**
+ * Constructs a handle on the agent of the store
+ * and index given as parameters. The handle stays
+ * valid as long as the store is not modified.
+ * 
+ * @param STORE - The store of the agent
+ * @param INDEX - The index of the agent
+ */
+template <typename T>
+inline BasicAgentView<T>::BasicAgentView(const BasicAgentStore<T>& STORE, const size_t INDEX) :
+    store_(&STORE), index_(INDEX) {}
+    
+/*
+    AgentView getters
+*/
+
+/**
+ * Returns the index of this agent in its store.
+ */
+template <typename T>
+inline size_t BasicAgentView<T>::index(void) const {
+    return this->index_;
+}
+
+/**
+ * Returns the ID of this agent.
+ */
+template <typename T>
+inline int BasicAgentView<T>::id(void) const {
+    return this->store_->id(this->index_);
+}
+
+/**
+ * Returns the position of this agent.
+ */
+template <typename T>
+inline BasicPoint<T> BasicAgentView<T>::position(void) const {
+    return this->store_->position(this->index_);
+}
+
+/**
+ * Returns the current velocity of this agent.
+ */
+template <typename T>
+inline BasicVector<T> BasicAgentView<T>::velocity(void) const {
+    return this->store_->velocity(this->index_);
+}
+
+/**
+ * Returns the preferred velocity of this agent.
+ */
+template <typename T>
+inline BasicVector<T> BasicAgentView<T>::prefVelocity(void) const {
+    return this->store_->prefVelocity(this->index_);
+}
+
+/**
+ * Returns the destination of this agent.
+ */
+template <typename T>
+inline BasicPoint<T> BasicAgentView<T>::destination(void) const {
+    return this->store_->destination(this->index_);
+}
+
+/**
+ * Returns the radius of this agent.
+ */
+template <typename T>
+inline T BasicAgentView<T>::radius(void) const {
+    return this->store_->radius(this->index_);
+}
+
+/**
+ * Returns the maximum speed of this agent.
+ */
+template <typename T>
+inline T BasicAgentView<T>::maxSpeed(void) const {
+    return this->store_->maxSpeed(this->index_);
+}
+
+/*
+    AgentView other methods
+*/
+
+/**
+ * Tests whether this agent has reached its destination
+ * within the given threshold distance.
+ * 
+ * @param ARRIVAL_THRESHOLD - The maximum distance at which
+ *                            this agent would be considered
+ *                            to have reached its destination
+ */
+template <typename T>
+inline bool BasicAgentView<T>::arrived(const T ARRIVAL_THRESHOLD/* = 0.0 */) const {
+    return this->store_->arrived(this->index_, ARRIVAL_THRESHOLD);
+}
+
+#endif // _AGENT_STORE_H_
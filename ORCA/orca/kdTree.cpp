@@ -0,0 +1,249 @@
+/**
+ * File  : kdTree.cpp
+ * Author: Raja Soufi
+ * 
+ * Implementation of the KdTree class defined
+ * in kdTree.h.
+ */
+
+// Include header file
+#include "kdTree.h"
+
+#include <algorithm>
+
+#include "agentStore.h"
+
+/*
+    Constants
+*/
+
+/**
+ * The maximum number of agents stored in a leaf.
+ */
+template <typename T>
+const size_t BasicKdTree<T>::MAX_LEAF_SIZE = 10;
+
+/*
+    Constructors
+*/
+
+/**
+ * Constructs an empty k-d tree.
+ */
+template <typename T>
+BasicKdTree<T>::BasicKdTree(void) : indices_(), x_(), y_(), nodes_() {}
+
+/*
+    Other methods
+*/
+
+/**
+ * Rebuilds this tree from the agents given as a
+ * parameter. The agents are referred to by their
+ * index in AGENTS. The memory of the previous build
+ * is reused.
+ * 
+ * @param AGENTS - The agents to store in the tree
+ */
+template <typename T>
+void BasicKdTree<T>::build(const BasicAgentStore<T>& AGENTS) {
+    
+    size_t n = AGENTS.size();
+    
+    this->indices_.resize(n);
+    this->x_.assign(AGENTS.positionX(), AGENTS.positionX() + n);
+    this->y_.assign(AGENTS.positionY(), AGENTS.positionY() + n);
+    this->nodes_.clear();
+    
+    for (size_t i = 0 ; i < n ; i++) {
+        this->indices_[i] = static_cast<int>(i);
+    }
+
+    if (n > 0) {
+        this->nodes_.reserve(2 * n / BasicKdTree::MAX_LEAF_SIZE + 1);
+        this->buildRecursive(0, n);
+    }
+    
+}
+
+/**
+ * Fills the list given as a parameter with the
+ * (squared distance, index) pairs of the at most
+ * MAX_NEIGHBORS agents nearest to P within a
+ * distance of RANGE, sorted by increasing distance.
+ * 
+ * @param P             - The point to search around
+ * @param RANGE         - The maximum distance to P
+ * @param MAX_NEIGHBORS - The maximum number of agents
+ *                        to report
+ * @param neighbors     - The list to fill
+ */
+template <typename T>
+void BasicKdTree<T>::query(const BasicPoint<T>& P, const T RANGE, const size_t MAX_NEIGHBORS,
+    std::vector<std::pair<T, int> >& neighbors) const
+{
+    neighbors.clear();
+    
+    if (this->nodes_.empty() || (MAX_NEIGHBORS == 0)) {
+        return;
+    }
+    
+    T rangeSq = RANGE * RANGE;
+    this->queryRecursive(0, P, rangeSq, MAX_NEIGHBORS, neighbors);
+}
+
+/*
+    Helpers
+*/
+
+/**
+ * Builds the subtree covering the agents in the
+ * range [BEGIN, END) of the permuted arrays, by
+ * splitting them at the middle of the longest side
+ * of their bounding box. Returns the index of the
+ * root of the subtree.
+ * 
+ * @param BEGIN - The first agent of the subtree
+ * @param END   - One past the last agent of the
+ *                subtree
+ */
+template <typename T>
+size_t BasicKdTree<T>::buildRecursive(const size_t BEGIN, const size_t END) {
+    
+    size_t index = this->nodes_.size();
+    this->nodes_.push_back(Node());
+    
+    Node node;
+    node.begin = BEGIN;
+    node.end = END;
+    node.left = node.right = 0;
+    node.minX = node.maxX = this->x_[BEGIN];
+    node.minY = node.maxY = this->y_[BEGIN];
+    
+    for (size_t i = BEGIN + 1 ; i < END ; i++) {
+        node.minX = std::min(node.minX, this->x_[i]);
+        node.maxX = std::max(node.maxX, this->x_[i]);
+        node.minY = std::min(node.minY, this->y_[i]);
+        node.maxY = std::max(node.maxY, this->y_[i]);
+    }
+    
+    if (END - BEGIN > BasicKdTree::MAX_LEAF_SIZE) {
+        
+        // Split along the longest side of the bounding box
+        bool vertical = (node.maxX - node.minX) > (node.maxY - node.minY);
+        std::vector<T>& keys = vertical ? this->x_ : this->y_;
+        std::vector<T>& others = vertical ? this->y_ : this->x_;
+        T split = 0.5 * (vertical ? node.maxX + node.minX : node.maxY + node.minY);
+        
+        // Partition the agents around the middle of the box
+        size_t left = BEGIN;
+        size_t right = END;
+        while (left < right) {
+            if (keys[left] < split) {
+                left++;
+            } else {
+                right--;
+                std::swap(keys[left], keys[right]);
+                std::swap(others[left], others[right]);
+                std::swap(this->indices_[left], this->indices_[right]);
+            }
+        }
+        
+        // Guarantee progress when all agents fall on one side
+        if ((left == BEGIN) || (left == END)) {
+            left = (BEGIN + END) / 2;
+        }
+        
+        node.left = this->buildRecursive(BEGIN, left);
+        node.right = this->buildRecursive(left, END);
+        
+    }
+    
+    this->nodes_[index] = node;
+    
+    return index;
+    
+}
+
+/**
+ * Searches the subtree rooted at the node given as
+ * a parameter for agents closer to P than the
+ * current range, inserting them into the sorted
+ * list of neighbors. Once the list is full, the
+ * range shrinks to the distance of the furthest
+ * neighbor kept, so that the search only visits the
+ * nodes that can still improve the result.
+ * 
+ * @param NODE          - The root of the subtree
+ * @param P             - The point to search around
+ * @param rangeSq       - The current squared range
+ * @param MAX_NEIGHBORS - The maximum number of agents
+ *                        to report
+ * @param neighbors     - The sorted list of neighbors
+ *                        found so far
+ */
+template <typename T>
+void BasicKdTree<T>::queryRecursive(const size_t NODE, const BasicPoint<T>& P, T& rangeSq,
+    const size_t MAX_NEIGHBORS, std::vector<std::pair<T, int> >& neighbors) const
+{
+    const Node& node = this->nodes_[NODE];
+    
+    // Leaf : test each agent
+    if (node.end - node.begin <= BasicKdTree::MAX_LEAF_SIZE) {
+        
+        for (size_t i = node.begin ; i < node.end ; i++) {
+            
+            T dx = this->x_[i] - P.x();
+            T dy = this->y_[i] - P.y();
+            T distSq = dx * dx + dy * dy;
+            
+            if (distSq > rangeSq) {
+                continue;
+            }
+            
+            if (neighbors.size() < MAX_NEIGHBORS) {
+                neighbors.push_back(std::make_pair(distSq, this->indices_[i]));
+            }
+            
+            // Insertion sort, dropping the furthest neighbor
+            // when the list is already full
+            size_t j = neighbors.size() - 1;
+            while ((j > 0) && (distSq < neighbors[j - 1].first)) {
+                neighbors[j] = neighbors[j - 1];
+                j--;
+            }
+            neighbors[j] = std::make_pair(distSq, this->indices_[i]);
+            
+            if (neighbors.size() == MAX_NEIGHBORS) {
+                rangeSq = neighbors.back().first;
+            }
+            
+        }
+        
+    }
+    // Inner node : visit the closest child first
+    else {
+        
+        T distSqLeft = this->distSqToNode(node.left, P);
+        T distSqRight = this->distSqToNode(node.right, P);
+        
+        size_t first = (distSqLeft < distSqRight) ? node.left : node.right;
+        size_t second = (distSqLeft < distSqRight) ? node.right : node.left;
+        T distSqSecond = std::max(distSqLeft, distSqRight);
+        
+        if (std::min(distSqLeft, distSqRight) <= rangeSq) {
+            this->queryRecursive(first, P, rangeSq, MAX_NEIGHBORS, neighbors);
+            if (distSqSecond <= rangeSq) {
+                this->queryRecursive(second, P, rangeSq, MAX_NEIGHBORS, neighbors);
+            }
+        }
+        
+    }
+}
+
+/*
+    Explicit instantiations
+*/
+
+template class BasicKdTree<float>;
+template class BasicKdTree<double>;
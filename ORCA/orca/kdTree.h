@@ -0,0 +1,96 @@
+/**
+ * File  : kdTree.h
+ * Author: Raja Soufi
+ * 
+ * Class definition of a 2D k-d tree over the
+ * positions of a set of agents, used to find the
+ * K nearest agents within a given distance of a
+ * point.
+ * 
+ * The tree is stored as an array of nodes over a
+ * permuted array of agent positions, each node
+ * covering a contiguous range of that array along
+ * with its bounding box. Leaves hold at most
+ * MAX_LEAF_SIZE agents. The coordinates are of the
+ * scalar type T of the agents, float or double.
+ */
+
+// Include guard
+#ifndef _KD_TREE_H_
+#define _KD_TREE_H_
+
+// Inclusions
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "../geom/point.h"
+
+// Forward-declarations
+template <typename T> class BasicAgentStore;
+
+// Class definition
+template <typename T>
+class BasicKdTree {
+    
+    private:
+    
+    // Node of the tree, covering the agents in [begin, end)
+    struct Node {
+        size_t begin, end;
+        size_t left, right;
+        T minX, maxX, minY, maxY;
+    };
+    
+    // Constants
+    static const size_t MAX_LEAF_SIZE;
+    
+    // Attributes
+    std::vector<int> indices_;
+    std::vector<T> x_, y_;
+    std::vector<Node> nodes_;
+    
+    // Helpers
+    size_t buildRecursive(const size_t BEGIN, const size_t END);
+    void queryRecursive(const size_t NODE, const BasicPoint<T>& P, T& rangeSq,
+        const size_t MAX_NEIGHBORS, std::vector<std::pair<T, int> >& neighbors) const;
+    inline T distSqToNode(const size_t NODE, const BasicPoint<T>& P) const;
+    
+    public:
+    
+    // Constructor
+    BasicKdTree(void);
+    
+    // Other methods
+    void build(const BasicAgentStore<T>& AGENTS);
+    void query(const BasicPoint<T>& P, const T RANGE, const size_t MAX_NEIGHBORS,
+        std::vector<std::pair<T, int> >& neighbors) const;
+        
+};
+
+// Precisions
+typedef BasicKdTree<float> KdTreeF;
+typedef BasicKdTree<double> KdTree;
+
+/*
+    Helpers
+*/
+
+/**
+ * Returns the squared distance between the point
+ * given as a parameter and the bounding box of the
+ * node with the index given as a parameter, which
+ * is zero if the point lies inside the box.
+ * 
+ * @param NODE - The index of the node
+ * @param P    - The point to measure from
+ */
+template <typename T>
+inline T BasicKdTree<T>::distSqToNode(const size_t NODE, const BasicPoint<T>& P) const {
+    const Node& node = this->nodes_[NODE];
+    T dx = (P.x() < node.minX) ? node.minX - P.x() : (P.x() > node.maxX) ? P.x() - node.maxX : 0;
+    T dy = (P.y() < node.minY) ? node.minY - P.y() : (P.y() > node.maxY) ? P.y() - node.maxY : 0;
+    return dx * dx + dy * dy;
+}
+
+#endif // _KD_TREE_H_
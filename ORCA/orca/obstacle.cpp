@@ -0,0 +1,28 @@
+/**
+ * File  : obstacle.cpp
+ * Author: Raja Soufi
+ * 
+ * Implementation of the Obstacle class defined
+ * in obstacle.h.
+ */
+
+// Include header file
+#include "obstacle.h"
+
+/*
+    Constructors
+*/
+
+/**
+ * Constructs an obstacle without any vertex, which
+ * does not obstruct anything.
+ */
+Obstacle::Obstacle(void) : vertices_() {}
+
+/**
+ * Constructs an obstacle with the vertices given as
+ * a parameter, which must be listed counterclockwise.
+ * 
+ * @param VERTICES - The vertices of the new obstacle
+ */
+Obstacle::Obstacle(const std::vector<Point>& VERTICES) : vertices_(VERTICES) {}
@@ -0,0 +1,65 @@
+/**
+ * File  : obstacle.h
+ * Author: Raja Soufi
+ * 
+ * Class definition of a static obstacle, given as a
+ * simple polygon whose vertices are listed
+ * counterclockwise. An obstacle with two vertices
+ * is a wall that agents avoid on both sides.
+ * 
+ * Obstacles do not move. They are handed to a
+ * simulation once, which stores their edges in an
+ * ObstacleTree and keeps the agents out of them
+ * with half-planes of their own.
+ */
+
+// Include guard
+#ifndef _OBSTACLE_H_
+#define _OBSTACLE_H_
+
+// Inclusions
+#include <cstddef>
+#include <vector>
+
+#include "../geom/point.h"
+
+// Class definition
+class Obstacle {
+    
+    private:
+    
+    // Attributes
+    std::vector<Point> vertices_;
+    
+    public:
+    
+    // Constructors
+    Obstacle(void);
+    Obstacle(const std::vector<Point>& VERTICES);
+    
+    // Getters
+    inline const std::vector<Point>& vertices(void) const;
+    inline size_t vertexCount(void) const;
+    
+};
+
+/*
+    Getters
+*/
+
+/**
+ * Returns the vertices of this obstacle, listed
+ * counterclockwise.
+ */
+inline const std::vector<Point>& Obstacle::vertices(void) const {
+    return this->vertices_;
+}
+
+/**
+ * Returns the number of vertices of this obstacle.
+ */
+inline size_t Obstacle::vertexCount(void) const {
+    return this->vertices_.size();
+}
+
+#endif // _OBSTACLE_H_
@@ -0,0 +1,273 @@
+/**
+ * File  : obstacleTree.cpp
+ * Author: Raja Soufi
+ * 
+ * Implementation of the ObstacleTree class defined
+ * in obstacleTree.h.
+ */
+
+// Include header file
+#include "obstacleTree.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "obstacle.h"
+
+/*
+    Constants
+*/
+
+/**
+ * The maximum number of edges stored in a leaf.
+ */
+template <typename T>
+const size_t BasicObstacleTree<T>::MAX_LEAF_SIZE = 4;
+
+/*
+    Constructors
+*/
+
+/**
+ * Constructs an empty obstacle tree.
+ */
+template <typename T>
+BasicObstacleTree<T>::BasicObstacleTree(void) :
+    pointX_(), pointY_(), directionX_(), directionY_(), previous_(), next_(), convex_(),
+    edges_(), nodes_() {}
+    
+/*
+    Other methods
+*/
+
+/**
+ * Rebuilds this tree from the obstacles given as a
+ * parameter. Obstacles with less than two vertices
+ * are left out, as are the edges between consecutive
+ * vertices that are equal.
+ * 
+ * @param OBSTACLES - The obstacles to store in the tree
+ */
+template <typename T>
+void BasicObstacleTree<T>::build(const std::vector<Obstacle>& OBSTACLES) {
+    
+    this->pointX_.clear();
+    this->pointY_.clear();
+    this->directionX_.clear();
+    this->directionY_.clear();
+    this->previous_.clear();
+    this->next_.clear();
+    this->convex_.clear();
+    this->edges_.clear();
+    this->nodes_.clear();
+    
+    std::vector<BasicPoint<T> > vertices;
+    
+    for (const Obstacle& obstacle : OBSTACLES) {
+        
+        // Convert the vertices, dropping repeated ones
+        vertices.clear();
+        for (const Point& vertex : obstacle.vertices()) {
+            BasicPoint<T> p(static_cast<T>(vertex.x()), static_cast<T>(vertex.y()));
+            if (vertices.empty() || (p != vertices.back())) {
+                vertices.push_back(p);
+            }
+        }
+        while ((vertices.size() > 1) && (vertices.back() == vertices.front())) {
+            vertices.pop_back();
+        }
+        
+        size_t n = vertices.size();
+        if (n < 2) {
+            continue;
+        }
+        
+        int first = static_cast<int>(this->pointX_.size());
+        
+        for (size_t i = 0 ; i < n ; i++) {
+            
+            const BasicPoint<T>& previous = vertices[(i == 0) ? n - 1 : i - 1];
+            const BasicPoint<T>& vertex = vertices[i];
+            const BasicPoint<T>& next = vertices[(i == n - 1) ? 0 : i + 1];
+            
+            BasicVector<T> direction = next.from(vertex);
+            direction.normalize();
+            
+            this->pointX_.push_back(vertex.x());
+            this->pointY_.push_back(vertex.y());
+            this->directionX_.push_back(direction.x());
+            this->directionY_.push_back(direction.y());
+            this->previous_.push_back(first + static_cast<int>((i == 0) ? n - 1 : i - 1));
+            this->next_.push_back(first + static_cast<int>((i == n - 1) ? 0 : i + 1));
+            
+            // The vertex is convex when the next one lies on the
+            // left of the edge coming from the previous one
+            this->convex_.push_back((n == 2) || (vertex.from(previous).cross(next.from(vertex)) >= 0));
+            
+            this->edges_.push_back(first + static_cast<int>(i));
+            
+        }
+        
+    }
+    
+    if (!this->edges_.empty()) {
+        this->nodes_.reserve(2 * this->edges_.size() / BasicObstacleTree::MAX_LEAF_SIZE + 1);
+        this->buildRecursive(0, this->edges_.size());
+    }
+    
+}
+
+/**
+ * Fills the list given as a parameter with the
+ * (squared distance, index) pairs of the edges
+ * within a distance of RANGE from P, sorted by
+ * increasing distance. Only the edges that P lies
+ * strictly on the right of are reported, since the
+ * others face away from it.
+ * 
+ * @param P     - The point to search around
+ * @param RANGE - The maximum distance to P
+ * @param edges - The list to fill
+ */
+template <typename T>
+void BasicObstacleTree<T>::query(const BasicPoint<T>& P, const T RANGE,
+    std::vector<std::pair<T, int> >& edges) const
+{
+    edges.clear();
+    
+    if (this->nodes_.empty()) {
+        return;
+    }
+    
+    this->queryRecursive(0, P, RANGE * RANGE, edges);
+}
+
+/*
+    Helpers
+*/
+
+/**
+ * Builds the subtree covering the edges in the
+ * range [BEGIN, END) of the permuted array, by
+ * splitting them at the median of the centers of
+ * the edges along the longest side of their
+ * bounding box. Returns the index of the root of
+ * the subtree.
+ * 
+ * @param BEGIN - The first edge of the subtree
+ * @param END   - One past the last edge of the
+ *                subtree
+ */
+template <typename T>
+size_t BasicObstacleTree<T>::buildRecursive(const size_t BEGIN, const size_t END) {
+    
+    size_t index = this->nodes_.size();
+    this->nodes_.push_back(Node());
+    
+    Node node;
+    node.begin = BEGIN;
+    node.end = END;
+    node.left = node.right = 0;
+    node.minX = node.minY = std::numeric_limits<T>::infinity();
+    node.maxX = node.maxY = - std::numeric_limits<T>::infinity();
+    
+    for (size_t i = BEGIN ; i < END ; i++) {
+        int a = this->edges_[i];
+        int b = this->next_[a];
+        node.minX = std::min(node.minX, std::min(this->pointX_[a], this->pointX_[b]));
+        node.maxX = std::max(node.maxX, std::max(this->pointX_[a], this->pointX_[b]));
+        node.minY = std::min(node.minY, std::min(this->pointY_[a], this->pointY_[b]));
+        node.maxY = std::max(node.maxY, std::max(this->pointY_[a], this->pointY_[b]));
+    }
+    
+    if (END - BEGIN > BasicObstacleTree::MAX_LEAF_SIZE) {
+        
+        // Split along the longest side of the bounding box, at
+        // the median of the centers of the edges
+        const std::vector<T>& keys = ((node.maxX - node.minX) > (node.maxY - node.minY)) ?
+            this->pointX_ : this->pointY_;
+        size_t middle = (BEGIN + END) / 2;
+        
+        std::nth_element(this->edges_.begin() + BEGIN, this->edges_.begin() + middle,
+            this->edges_.begin() + END, [this, &keys](const int A, const int B) {
+                return keys[A] + keys[this->next_[A]] < keys[B] + keys[this->next_[B]];
+            });
+            
+        node.left = this->buildRecursive(BEGIN, middle);
+        node.right = this->buildRecursive(middle, END);
+        
+    }
+    
+    this->nodes_[index] = node;
+    
+    return index;
+    
+}
+
+/**
+ * Searches the subtree rooted at the node given as
+ * a parameter for edges within the range of P that
+ * P lies on the right of, inserting them into the
+ * sorted list of edges.
+ * 
+ * @param NODE     - The root of the subtree
+ * @param P        - The point to search around
+ * @param RANGE_SQ - The squared range
+ * @param edges    - The sorted list of edges found
+ *                   so far
+ */
+template <typename T>
+void BasicObstacleTree<T>::queryRecursive(const size_t NODE, const BasicPoint<T>& P, const T RANGE_SQ,
+    std::vector<std::pair<T, int> >& edges) const
+{
+    const Node& node = this->nodes_[NODE];
+    
+    // Leaf : test each edge
+    if (node.end - node.begin <= BasicObstacleTree::MAX_LEAF_SIZE) {
+        
+        for (size_t i = node.begin ; i < node.end ; i++) {
+            
+            int edge = this->edges_[i];
+            
+            // Skip the edges facing away from P
+            if (this->direction(edge).cross(P.from(this->point(edge))) >= 0) {
+                continue;
+            }
+            
+            T distSq = this->distSqToEdge(edge, P);
+            
+            if (distSq >= RANGE_SQ) {
+                continue;
+            }
+            
+            // Insertion sort
+            edges.push_back(std::make_pair(distSq, edge));
+            size_t j = edges.size() - 1;
+            while ((j > 0) && (distSq < edges[j - 1].first)) {
+                edges[j] = edges[j - 1];
+                j--;
+            }
+            edges[j] = std::make_pair(distSq, edge);
+            
+        }
+        
+    }
+    // Inner node : visit the children within range
+    else {
+        
+        if (this->distSqToNode(node.left, P) < RANGE_SQ) {
+            this->queryRecursive(node.left, P, RANGE_SQ, edges);
+        }
+        if (this->distSqToNode(node.right, P) < RANGE_SQ) {
+            this->queryRecursive(node.right, P, RANGE_SQ, edges);
+        }
+        
+    }
+}
+
+/*
+    Explicit instantiations
+*/
+
+template class BasicObstacleTree<float>;
+template class BasicObstacleTree<double>;
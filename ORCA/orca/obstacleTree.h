@@ -0,0 +1,208 @@
+/**
+ * File  : obstacleTree.h
+ * Author: Raja Soufi
+ * 
+ * Class definition of a bounding volume hierarchy
+ * over the edges of a set of static obstacles, used
+ * to find the edges within a given distance of an
+ * agent.
+ * 
+ * Each edge goes from a vertex of an obstacle to the
+ * next one, counterclockwise, and is referred to by
+ * the index of its first vertex. The vertices are
+ * stored with the unit direction of their edge, the
+ * indices of the previous and next vertices, and
+ * whether the obstacle is convex at them. The
+ * hierarchy is stored as an array of nodes over a
+ * permuted array of edges, each node covering a
+ * contiguous range of that array along with the
+ * bounding box of its edges. Leaves hold at most
+ * MAX_LEAF_SIZE edges.
+ * 
+ * The tree is built once, when the obstacles are
+ * given to a simulation, after which a query costs
+ * O(log m) for m edges. The coordinates are of the
+ * scalar type T of the simulation, float or double.
+ */
+
+// Include guard
+#ifndef _OBSTACLE_TREE_H_
+#define _OBSTACLE_TREE_H_
+
+// Inclusions
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "../geom/point.h"
+#include "../geom/vector.h"
+
+// Forward-declarations
+class Obstacle;
+
+// Class definition
+template <typename T>
+class BasicObstacleTree {
+    
+    private:
+    
+    // Node of the tree, covering the edges in [begin, end)
+    struct Node {
+        size_t begin, end;
+        size_t left, right;
+        T minX, maxX, minY, maxY;
+    };
+    
+    // Constants
+    static const size_t MAX_LEAF_SIZE;
+    
+    // Attributes
+    std::vector<T> pointX_, pointY_;
+    std::vector<T> directionX_, directionY_;
+    std::vector<int> previous_, next_;
+    std::vector<char> convex_;
+    
+    std::vector<int> edges_;
+    std::vector<Node> nodes_;
+    
+    // Helpers
+    size_t buildRecursive(const size_t BEGIN, const size_t END);
+    void queryRecursive(const size_t NODE, const BasicPoint<T>& P, const T RANGE_SQ,
+        std::vector<std::pair<T, int> >& edges) const;
+    inline T distSqToNode(const size_t NODE, const BasicPoint<T>& P) const;
+    inline T distSqToEdge(const int EDGE, const BasicPoint<T>& P) const;
+    
+    public:
+    
+    // Constructor
+    BasicObstacleTree(void);
+    
+    // Getters
+    inline size_t size(void) const;
+    inline BasicPoint<T> point(const int VERTEX) const;
+    inline BasicVector<T> direction(const int VERTEX) const;
+    inline int previous(const int VERTEX) const;
+    inline int next(const int VERTEX) const;
+    inline bool convex(const int VERTEX) const;
+    
+    // Other methods
+    void build(const std::vector<Obstacle>& OBSTACLES);
+    void query(const BasicPoint<T>& P, const T RANGE, std::vector<std::pair<T, int> >& edges) const;
+    
+};
+
+// Precisions
+typedef BasicObstacleTree<float> ObstacleTreeF;
+typedef BasicObstacleTree<double> ObstacleTree;
+
+/*
+    Getters
+*/
+
+/**
+ * Returns the number of vertices, and therefore of
+ * edges, stored in this tree.
+ */
+template <typename T>
+inline size_t BasicObstacleTree<T>::size(void) const {
+    return this->pointX_.size();
+}
+
+/**
+ * Returns the position of the vertex with the index
+ * given as a parameter.
+ * 
+ * @param VERTEX - The index of the vertex
+ */
+template <typename T>
+inline BasicPoint<T> BasicObstacleTree<T>::point(const int VERTEX) const {
+    return BasicPoint<T>(this->pointX_[VERTEX], this->pointY_[VERTEX]);
+}
+
+/**
+ * Returns the unit direction of the edge going from
+ * the vertex with the index given as a parameter to
+ * the next one.
+ * 
+ * @param VERTEX - The index of the vertex
+ */
+template <typename T>
+inline BasicVector<T> BasicObstacleTree<T>::direction(const int VERTEX) const {
+    return BasicVector<T>(this->directionX_[VERTEX], this->directionY_[VERTEX]);
+}
+
+/**
+ * Returns the index of the vertex before the vertex
+ * with the index given as a parameter, in the
+ * counterclockwise order of its obstacle.
+ * 
+ * @param VERTEX - The index of the vertex
+ */
+template <typename T>
+inline int BasicObstacleTree<T>::previous(const int VERTEX) const {
+    return this->previous_[VERTEX];
+}
+
+/**
+ * Returns the index of the vertex after the vertex
+ * with the index given as a parameter, in the
+ * counterclockwise order of its obstacle.
+ * 
+ * @param VERTEX - The index of the vertex
+ */
+template <typename T>
+inline int BasicObstacleTree<T>::next(const int VERTEX) const {
+    return this->next_[VERTEX];
+}
+
+/**
+ * Tests whether the obstacle is convex at the vertex
+ * with the index given as a parameter. Both vertices
+ * of a wall are convex.
+ * 
+ * @param VERTEX - The index of the vertex
+ */
+template <typename T>
+inline bool BasicObstacleTree<T>::convex(const int VERTEX) const {
+    return this->convex_[VERTEX] != 0;
+}
+
+/*
+    Helpers
+*/
+
+/**
+ * Returns the squared distance between the point
+ * given as a parameter and the bounding box of the
+ * node with the index given as a parameter, which
+ * is zero if the point lies inside the box.
+ * 
+ * @param NODE - The index of the node
+ * @param P    - The point to measure from
+ */
+template <typename T>
+inline T BasicObstacleTree<T>::distSqToNode(const size_t NODE, const BasicPoint<T>& P) const {
+    const Node& node = this->nodes_[NODE];
+    T dx = (P.x() < node.minX) ? node.minX - P.x() : (P.x() > node.maxX) ? P.x() - node.maxX : 0;
+    T dy = (P.y() < node.minY) ? node.minY - P.y() : (P.y() > node.maxY) ? P.y() - node.maxY : 0;
+    return dx * dx + dy * dy;
+}
+
+/**
+ * Returns the squared distance between the point
+ * given as a parameter and the edge starting at the
+ * vertex with the index given as a parameter.
+ * 
+ * @param EDGE - The index of the first vertex of the edge
+ * @param P    - The point to measure from
+ */
+template <typename T>
+inline T BasicObstacleTree<T>::distSqToEdge(const int EDGE, const BasicPoint<T>& P) const {
+    BasicVector<T> edge = this->point(this->next_[EDGE]).from(this->point(EDGE));
+    BasicVector<T> offset = P.from(this->point(EDGE));
+    T r = (offset * edge) / (edge * edge);
+    BasicVector<T> closest = (r < 0) ? offset : (r > 1) ? offset - edge : offset - edge * r;
+    return closest * closest;
+}
+
+#endif // _OBSTACLE_TREE_H_
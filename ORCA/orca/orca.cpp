@@ -1,421 +1,804 @@
-/**
- * File  : orca.cpp
- * Author: Raja Soufi
- * 
- * Implementation of the ORCA class defined
- * in orca.h.
- */
-
-// Include header file
-#include "orca.h"
-
-/*
-    Static Attributes
-*/
-
-/**
- * The set of agents registered in the system.
- */
-std::vector<Agent> ORCA::agents_;
-
-/**
- * The value of tau to be used for the ORCA system.
- */
-double ORCA::tau_ = 0.0;
-
-/**
- * The value of deltaT to be used for the ORCA system.
- */
-double ORCA::deltaT_ = 0.0;
-
-/**
- * The maximum distance between an agent A and its
- * destination for which A would be considered as
- * arrived.
- */
-double ORCA::arrivalThreshold_ = 0.0;
-
-/*
-    Methods
-*/
-
-/**
- * Initializes the system with a set of agents, a value of
- * tau, and an arrival threshold given as parameters.
- * 
- * @param AGENTS            - The agents to register in the system
- * @param TAU               - The value of tau to use for the ORCA
- *                            system
- * @param ARRIVAL_THRESHOLD - The arrival threshold to be used
- */
-void ORCA::initialize(const std::vector<Agent>& AGENTS, const double TAU,
-    const double DELTA_T, const double ARRIVAL_THRESHOLD)
-{
-    ORCA::agents_ = std::vector<Agent>(AGENTS);
-    ORCA::tau_ = TAU;
-    ORCA::deltaT_ = DELTA_T;
-    ORCA::arrivalThreshold_ = ARRIVAL_THRESHOLD;
-}
-
-/**
- * Solves a linear program given a set of half-planes
- * as input, as well as a preferred velocity and a
- * maximum speed.
- * Returns a point representing the solution to the
- * linear program.
- * 
- * @param H         - The set of half-planes to use
- *                    as input for the linear program
- * @param V_PREF    - The preferred velocity to use as
- *                    as input for the linear program
- * @param MAX_SPEED - The maximum speed to use as
- *                    input for the linear program
- */
-Point ORCA::solveLinearProgram(std::vector<HalfPlane>& H,
-    const Vector& V_PREF, const double MAX_SPEED)
-{
-    // Number of input half-planes
-    size_t n = H.size();
-    
-    // Compute a random permutation of the half-planes
-    std::random_shuffle(H.begin(), H.end());
-    
-    Vector vMax = Vector(V_PREF);
-    
-    // Initialize the solution to be the furthest point on
-    // the circle of radius MAX_SPEED in the direction of V_PREF
-    Point solution = vMax;
-    
-    // Loop through the shuffled half-planes
-    for (std::vector<HalfPlane>::iterator h_i = H.begin() ; h_i != H.end() ; h_i++) {
-        
-        // If the next half-plane does not contain the
-        // current solution, compute the new solution
-        // or report that the program is infeasible
-        if (!h_i->contains(solution)) {
-            
-            // Find the number of intersections between h_i's bounding
-            // line and the circle of radius MAX_SPEED
-            // Line     : y = slope * x + yIntercept
-            // Circle   : x^2 + y^2 = MAX_SPEED^2
-            // Equation to solve :
-            //     (slope^2 + 1) * x^2 + 2 * slope * yIntercept * x + yIntercept^2 - MAX_SPEED^2 = 0
-            
-            double discriminant;
-            double a = pow(h_i->boundingLine().slope(), 2.0) + 1.0;
-            double b = 2.0 * h_i->boundingLine().slope() * h_i->boundingLine().yIntercept();
-            
-            // If the h_i's bounding line is vertical then we
-            // hard-code the values of the discriminant
-            if (h_i->boundingLine().isVertical()) {
-                discriminant = sign(MAX_SPEED - abs(h_i->boundingLine().xIntercept()));
-            } else {
-                // discriminant = 4 * (MAX_SPEED^2 * (slope^2 + 1) - yIntercept^2)
-                discriminant = 4.0 * (pow(MAX_SPEED, 2.0) * a - pow(h_i->boundingLine().yIntercept(), 2.0));
-            }
-            
-            // If the discriminant is strictly negative then...
-            if (discriminant < 0.0) {
-                // ...either h_i completely contains the circle in which
-                // case any point on the circle satisfies the constraint
-                // introduced by h_i and we can simply ignore it...
-                if (h_i->normal() * h_i->normalPosition().from(Point()) < 0.0) {
-                    continue;
-                }
-                // ...or the circle is completely outside h_i in which case
-                // no point on the circle satisfies the constraint introduced
-                // by h_i and we report that the program is infeasible
-                else {
-                    throw LinearProgramInfeasibleException();
-                }
-            }
-            // If the discriminant is equal to zero then...
-            else if (discriminant == 0.0) {
-                // ...either h_i completely contains the circle in which
-                // case any point on the circle satisfies the constraint
-                // introduced by h_i, including the intersection point,
-                // and we can simply ignore it...
-                if (h_i->normal() * h_i->normalPosition().from(Point()) < 0.0) {
-                    continue;
-                }
-                // ...or the only point on the circle that h_i contains
-                // is the intersection point, which means that h_i alone
-                // constrains the solution to a single point. Two cases
-                // are possible here:
-                //     - All other half-planes contain this point in
-                //       which case we return it as the solution to
-                //       the linear program
-                //     - There exists at least one half-plane that
-                //       does not contain this point in which case
-                //       we report that the program is infeasible
-                // Therefore, we do one final traversal of H in order to
-                // check whether all half-planes contain the intersection
-                // point and act accordingly
-                else {
-                    solution = h_i->boundingLine().isVertical() ? h_i->boundingLine().getPointAtY(0.0) :
-                        h_i->boundingLine().getPointAtX(- b / (2.0 * a));
-                    
-                    for (h_i = H.begin() ; h_i != H.end() ; h_i++) {
-                        if (!h_i->contains(solution)) {
-                            throw LinearProgramInfeasibleException();
-                        }
-                    }
-                    
-                    // At this point, we are certain that all half-planes
-                    // contain the solution, so we break out of the
-                    // for-loop and return it
-                    break;
-                }
-            }
-            // If the discriminant is strictly positive then...
-            else {
-                // left and right represent the parametrised constraints
-                // on the position of the solution on the bounding line of
-                // h_i. If the bounding line is not vertical, they are the
-                // same as xLeft and xRight from the formal definition of
-                // the algorithm. If however the bounding line is vertical,
-                // then left and right are computed in an analogous way in
-                // the y-dimension, and can be thought of as "yLeft" and
-                // "yRight" respectively. The property of being "left" or
-                // "right" on a half-plane's bounding line is determined
-                // with respect to its normal, and is therefore fully
-                // defined even for a vertical bounding line.
-                double left, right;
-                
-                // If h_i's bounding line is vertical, then we compute left
-                // and right (for which a better name in this case would be
-                // "up" and "down" for example) using Pythagoras' theorem.
-                if (h_i->boundingLine().isVertical()) {
-                    left = sqrt(pow(MAX_SPEED, 2.0) - pow(h_i->boundingLine().xIntercept(), 2.0));
-                    right = - left;
-                }
-                // If h_i's bounding line is not vertical, then the
-                // previously computed discriminant is valid and we use it
-                // to compute left and right.
-                else {
-                    left  = (- b - sqrt(discriminant)) / (2.0 * a);
-                    right = (- b + sqrt(discriminant)) / (2.0 * a);
-                }
-                
-                // If h_i's normal is facing downwards, or left in case
-                // h_i's bounding line is vertical, then left and right
-                // should be swapped.
-                if ((h_i->boundingLine().isVertical() && (h_i->normal().x() < 0.0)) ||
-                    (!h_i->boundingLine().isVertical() && (h_i->normal().y() < 0.0)))
-                {
-                    std::swap(left, right);
-                }
-                
-                // Loop through the half-planes in H_i-1
-                for (std::vector<HalfPlane>::iterator h = H.begin() ; h != h_i ; h++) {
-                    
-                    // If the bounding line of h is parallel to that
-                    // of h_i, then...
-                    if (h_i->boundingLine() || h->boundingLine()) {
-                        
-                        // ...either their intersection is not empty in
-                        // which case any point on the bounding line of h_i
-                        // satisfies h and we can simply ignore it...
-                        if ((h_i->normal() * h->normal() > 0.0) || (h_i->contains(h->normalPosition()))) {
-                            continue;
-                        }
-                        // ...or their intersection is empty in which case no
-                        // point on the bounding line of h_i satisfies h and
-                        // we report that the linear program is infeasible
-                        else {
-                            throw LinearProgramInfeasibleException();
-                        }
-                    }
-                    
-                    // If the bounding line of h is not parallel to
-                    // that of h_i, then we compute their intersection
-                    // and use it to update either left or right.
-                    else {
-                        
-                        double angleDiff = trueMod(h_i->normal().angleFrom(h->normal()), 2.0 * M_PI);
-                        Point intersection = h_i->boundingLine().intersect(h->boundingLine());
-                        
-                        // If the angle difference between the normals is
-                        // smaller than PI, then it is left that must be
-                        // updated, in case we need to update at all.
-                        if (angleDiff < M_PI) {
-                            if (h_i->boundingLine().isVertical() &&
-                                ((h_i->normal().x() < 0.0) == (intersection.y() > left)))
-                            {
-                                left = intersection.y();
-                            }
-                            
-                            else if (!h_i->boundingLine().isVertical() &&
-                                ((h_i->normal().y() < 0.0) == (intersection.x() < left)))
-                            {
-                                left = intersection.x();
-                            }
-                        }
-                        
-                        // If the angle difference between the normals is
-                        // larger than PI, then it is right that must be
-                        // updated, in case we need to update at all.
-                        else {
-                            if (h_i->boundingLine().isVertical() &&
-                                ((h_i->normal().x() < 0.0) == (intersection.y() < right)))
-                            {
-                                right = intersection.y();
-                            }
-                            
-                            else if (!h_i->boundingLine().isVertical() &&
-                                ((h_i->normal().y() < 0.0) == (intersection.x() > right)))
-                            {
-                                right = intersection.x();
-                            }
-                        }
-                        
-                    }
-                    
-                }
-                
-                // If h_i's normal is facing downwards or right and left
-                // is smaller than right, or if it's facing upwards or
-                // left and left is larger than right, then we report that
-                // the linear program is infeasible
-                if
-                (
-                    (
-                        (
-                            (h_i->boundingLine().isVertical() && (h_i->normal().x() > 0.0))
-                        ||
-                            (!h_i->boundingLine().isVertical() && (h_i->normal().y() < 0.0))
-                        )
-                    &&
-                        (left < right)
-                    )
-                ||
-                    (
-                        (
-                            (h_i->boundingLine().isVertical() && (h_i->normal().x() < 0.0))
-                        ||
-                            (!h_i->boundingLine().isVertical() && (h_i->normal().y() > 0.0))
-                        )
-                    &&
-                        (left > right)
-                    )
-                ) {
-                    throw LinearProgramInfeasibleException();
-                }
-                
-                // Project vMax onto h_i's bounding line
-                Point projection = Point(vMax).projectionOnto(h_i->boundingLine());
-                
-                // Set the solution to be either the previously computed
-                // projection, or left or right, depending on whether the
-                // projection lies in the interval bound by left and right.
-                if (h_i->boundingLine().isVertical() &&
-                    ((h_i->normal().x() < 0.0) == (projection.x() < left)))
-                {
-                    solution = h_i->boundingLine().getPointAtY(left);
-                }
-                else if (h_i->boundingLine().isVertical() &&
-                    ((h_i->normal().x() < 0.0) == (projection.x() > right)))
-                {
-                    solution = h_i->boundingLine().getPointAtY(right);
-                }
-                else if (!h_i->boundingLine().isVertical() &&
-                    ((h_i->normal().y() < 0.0) == (projection.x() > left)))
-                {
-                    solution = h_i->boundingLine().getPointAtX(left);
-                }
-                else if (!h_i->boundingLine().isVertical() &&
-                    ((h_i->normal().y() < 0.0) == (projection.x() < right)))
-                {
-                    solution = h_i->boundingLine().getPointAtX(right);
-                }
-                else {
-                    solution = projection;
-                }
-                
-                
-            }
-            
-        }
-        
-    }
-    
-    // Return the solution
-    return solution;
-}
-
-/**
- * Executes a single iteration of ORCA.
- */
-void ORCA::iteration(void) {
-    
-    std::vector<Vector> newVelocities;
-    newVelocities.reserve(ORCA::agentCount());
-    
-    // Compute ORCA's and new velocities
-    for (Agent& agent : ORCA::agents_) {
-        
-        std::vector<HalfPlane> halfPlanes = agent.orca_A(ORCA::agents_, ORCA::tau_);
-        
-        newVelocities.push_back(agent.solveLinearProgram(halfPlanes));
-        
-    }
-    
-    std::vector<Vector>::iterator newVelocity = newVelocities.begin();
-    
-    // Update velocities
-    for (Agent& agent : ORCA::agents_) {
-        
-        agent.updateVelocity(*newVelocity);
-        
-        newVelocity++;
-        
-    }
-}
-
-/**
- * Moves agents for DELTA_T time one by one.
- * 
- * @param DELTA_T - The time during which to move
- *                  the agents
- */
-void ORCA::moveAgents(const double DELTA_T) {
-    
-    // Move agents
-    for (Agent& agent : ORCA::agents_) {
-        
-        agent.move(DELTA_T);
-        
-    }
-    
-}
-
-/**
- * Tests whether the system has converged, in the
- * sense of that all agents are within the arrival
- * threshold from their respective destinations.
- */
-bool ORCA::converged(void) {
-    
-    // Loop through the agents
-    for (Agent& agent : ORCA::agents_) {
-        
-        // If one of the agents has not arrived
-        // yet, then return false
-        if (!agent.arrived(ORCA::arrivalThreshold_)) {
-            return false;
-        }
-        
-    }
-    
-    // If all agents have arrived,
-    // then return true
-    return true;
-}
-
-/**
- * Runs finalization code that is executed when
- * the system converges and is about to terminate.
- * Any cleaning up that should be done before
- * terminating goes here.
- */
-void ORCA::finalize(void) {}
+/**
+ * File  : orca.cpp
+ * Author: Raja Soufi
+ * 
+ * Implementation of the ORCA class defined
+ * in orca.h.
+ */
+
+// Include header file
+#include "orca.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+
+/*
+    Constants
+*/
+
+/**
+ * The tolerance below which two bounding lines are
+ * considered parallel by the linear programs.
+ */
+const double ORCA::EPSILON = 1e-9;
+
+/**
+ * The same tolerance for the linear programs in
+ * single precision, whose unit directions are only
+ * accurate to about 1e-7.
+ */
+const float ORCA::FLOAT_EPSILON = 1e-5f;
+
+/*
+    Static Attributes
+*/
+
+/**
+ * The default simulation, driven by the static
+ * functions of this class.
+ */
+Simulator ORCA::simulator_;
+
+/*
+    Methods
+*/
+
+/**
+ * Solves a linear program given a set of half-planes
+ * as input, as well as a preferred velocity and a
+ * maximum speed, and stores its solution in the point
+ * given as a parameter.
+ * If no velocity satisfies all half-planes, the one
+ * minimizing the maximum violation of the half-planes
+ * is stored instead, as in the original ORCA paper,
+ * and INFEASIBLE is returned.
+ * 
+ * @param H         - The set of half-planes to use
+ *                    as input for the linear program
+ * @param V_PREF    - The preferred velocity to use as
+ *                    as input for the linear program
+ * @param MAX_SPEED - The maximum speed to use as
+ *                    input for the linear program
+ * @param solution  - Set to the solution of the linear
+ *                    program
+ */
+template <typename T>
+ORCA::LinearProgramStatus ORCA::solveLinearProgram(std::vector<BasicDirectedHalfPlane<T> >& H,
+    const BasicVector<T>& V_PREF, const T MAX_SPEED, BasicPoint<T>& solution) noexcept
+{
+    // Compute a random permutation of the half-planes, with
+    // an engine of its own so that the result does not depend
+    // on any previous call
+    std::minstd_rand engine;
+    std::shuffle(H.begin(), H.end(), engine);
+    
+    std::vector<BasicDirectedHalfPlane<T> > bisectors;
+    return ORCA::solveOrderedLinearProgram(H, V_PREF, MAX_SPEED, solution, bisectors);
+}
+
+/**
+ * Solves a linear program as the other version of
+ * this function does, going through the half-planes
+ * in the order in which they are given instead of a
+ * random one. The expected running time is linear
+ * when that order is random, and shortest when the
+ * half-planes bounding the solution come first, as
+ * the following ones then only need to be checked.
+ * The list given as a parameter holds the bisectors
+ * of the bounding lines when the linear program is
+ * infeasible, so that its memory can be reused from
+ * call to call.
+ * The first OBSTACLE_COUNT half-planes come from
+ * static obstacles. When the linear program is
+ * infeasible, they are kept as they are while the
+ * violation of the others is minimized, since
+ * obstacles do not take their share of the
+ * avoidance.
+ * 
+ * @param H              - The set of half-planes to use
+ *                         as input for the linear program
+ * @param V_PREF         - The preferred velocity to use as
+ *                         as input for the linear program
+ * @param MAX_SPEED      - The maximum speed to use as
+ *                         input for the linear program
+ * @param solution       - Set to the solution of the linear
+ *                         program
+ * @param bisectors      - The list to hold the bisectors in
+ * @param OBSTACLE_COUNT - The number of half-planes at the
+ *                         front of H that come from obstacles
+ * @param violations     - If not null, incremented for each
+ *                         half-plane the solution had to be
+ *                         moved onto
+ */
+template <typename T>
+ORCA::LinearProgramStatus ORCA::solveOrderedLinearProgram(const std::vector<BasicDirectedHalfPlane<T> >& H,
+    const BasicVector<T>& V_PREF, const T MAX_SPEED, BasicPoint<T>& solution,
+    std::vector<BasicDirectedHalfPlane<T> >& bisectors, const size_t OBSTACLE_COUNT/* = 0 */,
+    size_t* violations/* = NULL */) noexcept
+{
+    BasicVector<T> result;
+    LinearProgramStatus status = ORCA::FEASIBLE;
+    
+    size_t failure = ORCA::solveInCircle(H, MAX_SPEED, V_PREF, false, result, violations);
+    
+    if (failure < H.size()) {
+        ORCA::minimizeViolation(H, failure, OBSTACLE_COUNT, MAX_SPEED, result, bisectors);
+        status = ORCA::INFEASIBLE;
+    }
+    
+    solution = BasicPoint<T>(result);
+    
+    return status;
+}
+
+/**
+ * Returns ORCA_A|B^TAU as a half-plane, where A and
+ * B are agents with the positions, velocities and
+ * radii given as parameters.
+ * 
+ * The velocity obstacle is built with square roots
+ * and divisions only, by the scalar version of the
+ * batched kernel. Building with TRIGONOMETRIC_ORCA
+ * defined uses the geometric construction of
+ * orca_A_B_trigonometric instead, everywhere.
+ * 
+ * @param P_A - The position of A
+ * @param V_A - The velocity of A
+ * @param R_A - The radius of A
+ * @param P_B - The position of B
+ * @param V_B - The velocity of B
+ * @param R_B - The radius of B
+ * @param TAU - The value of tau to be used when
+ *              computing ORCA_A|B^TAU
+ */
+template <typename T>
+BasicDirectedHalfPlane<T> ORCA::orca_A_B(const BasicPoint<T>& P_A, const BasicVector<T>& V_A,
+    const T R_A, const BasicPoint<T>& P_B, const BasicVector<T>& V_B, const T R_B, const T TAU)
+{
+    #ifdef TRIGONOMETRIC_ORCA
+    return ORCA::orca_A_B_trigonometric(P_A, V_A, R_A, P_B, V_B, R_B, TAU);
+    #else
+    T pBX = P_B.x(), pBY = P_B.y(), vBX = V_B.x(), vBY = V_B.y(), rB = R_B;
+    T pointX, pointY, directionX, directionY;
+    
+    OrcaKernel::Neighbors<T> b = {&pBX, &pBY, &vBX, &vBY, &rB};
+    OrcaKernel::HalfPlanes<T> out = {&pointX, &pointY, &directionX, &directionY};
+    
+    OrcaKernel::compute(OrcaKernel::SCALAR, P_A.x(), P_A.y(), V_A.x(), V_A.y(), R_A, b, 1, TAU, out);
+    
+    return BasicDirectedHalfPlane<T>(BasicVector<T>(pointX, pointY), BasicVector<T>(directionX, directionY));
+    #endif
+}
+
+/**
+ * Returns ORCA_A|B^TAU as a half-plane, where A and
+ * B are agents with the positions, velocities and
+ * radii given as parameters, by building the legs of
+ * the velocity obstacle out of its half aperture and
+ * intersecting lines. This is the reference the
+ * other ways of computing ORCA_A|B^TAU are checked
+ * against.
+ * 
+ * @param P_A - The position of A
+ * @param V_A - The velocity of A
+ * @param R_A - The radius of A
+ * @param P_B - The position of B
+ * @param V_B - The velocity of B
+ * @param R_B - The radius of B
+ * @param TAU - The value of tau to be used when
+ *              computing ORCA_A|B^TAU
+ */
+template <typename T>
+BasicDirectedHalfPlane<T> ORCA::orca_A_B_trigonometric(const BasicPoint<T>& P_A,
+    const BasicVector<T>& V_A, const T R_A, const BasicPoint<T>& P_B, const BasicVector<T>& V_B,
+    const T R_B, const T TAU)
+{
+    typedef BasicPoint<T> Point;
+    typedef BasicVector<T> Vector;
+    typedef BasicLine<T> Line;
+    
+    // v_A - v_B
+    Vector vDiff_A_B = V_A - V_B;
+    
+    Point voMainCircleCenter = P_B - P_A;
+    Point voTruncationCircleCenter = voMainCircleCenter / TAU;
+    
+    T voMainCircleRadius = R_A + R_B;
+    
+    Vector axis(voMainCircleCenter);
+    
+    Point closestCircleCenter = voTruncationCircleCenter;
+    
+    // If A and B overlap, the velocity obstacle has no legs
+    // and only its truncation circle is used, which pushes
+    // them apart
+    bool overlapping = axis.norm() <= voMainCircleRadius;
+    
+    T voHalfAperture = overlapping ? M_PI_2 : asin(voMainCircleRadius / axis.norm());
+    
+    Vector leftProjection = vDiff_A_B.projectionOnto(axis.rotated(voHalfAperture));
+    Vector rightProjection = vDiff_A_B.projectionOnto(axis.rotated(- voHalfAperture));
+    
+    // If the projection vector is orthogonal to or in the
+    // opposite direction of the vector to p_B - p_A, then
+    // vDiff_A_B can not possibly be in VO_A|B^TAU
+    
+    if ((vDiff_A_B * axis > 0.0) && !overlapping) {
+        
+        Vector& projection =
+            (leftProjection * axis <= 0.0) ? rightProjection :
+            (rightProjection * axis <= 0.0) ? leftProjection :
+            (leftProjection.norm() > rightProjection.norm()) ? leftProjection : rightProjection;
+            
+        Point projectionCircleCenter = Line(Line(projection), vDiff_A_B).intersect(voMainCircleCenter);
+        
+        if (Vector(projectionCircleCenter).norm() > Vector(voTruncationCircleCenter).norm()) {
+            closestCircleCenter = projectionCircleCenter;
+        }
+        
+    }
+    
+    T closestCircleRadius = voMainCircleRadius * Vector(closestCircleCenter).norm() / axis.norm();
+    
+    Vector centerToV = vDiff_A_B - closestCircleCenter;
+    
+    // In case v_A - v_B and the velocity obstacle's axis are
+    // collinear, the vector from the center to the closest
+    // border can be found using either of the left and right
+    // projections. In this case we use the right one.
+    // Otherwise ...
+    Vector centerToBorder = (centerToV == 0.0) ?
+        rightProjection - vDiff_A_B : Vector(centerToV).normalize(closestCircleRadius);
+        
+    Vector u = centerToBorder - centerToV;
+    
+    return BasicDirectedHalfPlane<T>(V_A + (u / 2.0), Vector(centerToBorder.y(), - centerToBorder.x()));
+    
+}
+
+/**
+ * Appends ORCA_A|B^TAU to the set of half-planes given
+ * as a parameter for each of the COUNT agents B given
+ * as a parameter, where A is an agent with the
+ * position, velocity and radius given as parameters.
+ * The half-planes are computed by the batched kernel,
+ * with the best instruction set of the CPU, unless
+ * TRIGONOMETRIC_ORCA is defined, and are equivalent
+ * to those returned by the other version of this
+ * function. Their bounding lines go through
+ * the arrays given as a parameter, which must hold
+ * COUNT values each.
+ * 
+ * @param P_A        - The position of A
+ * @param V_A        - The velocity of A
+ * @param R_A        - The radius of A
+ * @param B          - The positions, velocities and radii
+ *                     of the agents B
+ * @param COUNT      - The number of agents B
+ * @param TAU        - The value of tau to be used when
+ *                     computing ORCA_A|B^TAU
+ * @param out        - The arrays receiving the bounding
+ *                     lines of the half-planes
+ * @param halfPlanes - The set of half-planes to append
+ *                     ORCA_A|B^TAU to
+ */
+template <typename T>
+void ORCA::orca_A_B(const BasicPoint<T>& P_A, const BasicVector<T>& V_A, const T R_A,
+    const OrcaKernel::Neighbors<T>& B, const size_t COUNT, const T TAU,
+    const OrcaKernel::HalfPlanes<T>& out, std::vector<BasicDirectedHalfPlane<T> >& halfPlanes)
+{
+    
+    #ifdef TRIGONOMETRIC_ORCA
+    for (size_t i = 0 ; i < COUNT ; i++) {
+        halfPlanes.push_back(ORCA::orca_A_B_trigonometric(P_A, V_A, R_A,
+            BasicPoint<T>(B.positionX[i], B.positionY[i]), BasicVector<T>(B.velocityX[i], B.velocityY[i]),
+            B.radius[i], TAU));
+    }
+    #else
+    OrcaKernel::compute(OrcaKernel::instructionSet(), P_A.x(), P_A.y(),
+        V_A.x(), V_A.y(), R_A, B, COUNT, TAU, out);
+        
+    for (size_t i = 0 ; i < COUNT ; i++) {
+        halfPlanes.push_back(BasicDirectedHalfPlane<T>(BasicVector<T>(out.pointX[i], out.pointY[i]),
+            BasicVector<T>(out.directionX[i], out.directionY[i])));
+    }
+    #endif
+    
+}
+
+/**
+ * Appends ORCA_A|O^TAU to the set of half-planes given
+ * as a parameter for each edge O of a static obstacle
+ * given as a parameter, where A is an agent with the
+ * position, velocity and radius given as parameters.
+ * The edges must be sorted by increasing distance to
+ * A, as returned by ObstacleTree::query.
+ * 
+ * Since an obstacle does not move, A alone has to
+ * avoid it, and the half-plane is bounded by the
+ * tangent to the velocity obstacle of the edge at the
+ * point of its border closest to V_A, rather than
+ * halfway to it. The velocity obstacle of an edge is
+ * truncated at TAU, and its legs follow the adjacent
+ * edges where the obstacle is convex, so that the
+ * edges of a same obstacle do not constrain A more
+ * than the obstacle itself. An edge already covered
+ * by the previous half-planes is skipped.
+ * 
+ * @param P_A        - The position of A
+ * @param V_A        - The velocity of A
+ * @param R_A        - The radius of A
+ * @param O          - The tree holding the obstacles
+ * @param EDGES      - The (squared distance, index) pairs
+ *                     of the edges around A
+ * @param TAU        - The value of tau to be used when
+ *                     computing ORCA_A|O^TAU
+ * @param halfPlanes - The set of half-planes to append
+ *                     ORCA_A|O^TAU to
+ */
+template <typename T>
+void ORCA::orca_A_O(const BasicPoint<T>& P_A, const BasicVector<T>& V_A, const T R_A,
+    const BasicObstacleTree<T>& O, const std::vector<std::pair<T, int> >& EDGES, const T TAU,
+    std::vector<BasicDirectedHalfPlane<T> >& halfPlanes)
+{
+    typedef BasicVector<T> Vector;
+    
+    const size_t FIRST = halfPlanes.size();
+    const T INV_TAU = 1 / TAU;
+    const T R_A_SQ = R_A * R_A;
+    const T INFINITE = std::numeric_limits<T>::infinity();
+    
+    for (const std::pair<T, int>& EDGE : EDGES) {
+        
+        int vertex1 = EDGE.second;
+        int vertex2 = O.next(vertex1);
+        
+        Vector relativePosition1 = O.point(vertex1).from(P_A);
+        Vector relativePosition2 = O.point(vertex2).from(P_A);
+        
+        // Skip the edge if the previous half-planes of obstacles
+        // already keep A away from both of its ends
+        bool covered = false;
+        for (size_t k = FIRST ; (k < halfPlanes.size()) && !covered ; k++) {
+            const BasicDirectedHalfPlane<T>& H = halfPlanes[k];
+            covered = ((relativePosition1 * INV_TAU - H.point()).cross(H.direction()) - INV_TAU * R_A
+                >= - ORCA::epsilon<T>()) &&
+                ((relativePosition2 * INV_TAU - H.point()).cross(H.direction()) - INV_TAU * R_A
+                >= - ORCA::epsilon<T>());
+        }
+        if (covered) {
+            continue;
+        }
+        
+        T distSq1 = relativePosition1 * relativePosition1;
+        T distSq2 = relativePosition2 * relativePosition2;
+        
+        Vector edgeVector = relativePosition2 - relativePosition1;
+        T s = - (relativePosition1 * edgeVector) / (edgeVector * edgeVector);
+        Vector closest = - relativePosition1 - edgeVector * s;
+        T distSqLine = closest * closest;
+        
+        // If A already overlaps the edge, only its velocity
+        // away from the edge is constrained, to leave it
+        // right away
+        if ((s < 0) && (distSq1 <= R_A_SQ)) {
+            if (O.convex(vertex1)) {
+                halfPlanes.push_back(BasicDirectedHalfPlane<T>(Vector(),
+                    Vector(- relativePosition1.y(), relativePosition1.x())));
+            }
+            continue;
+        } else if ((s > 1) && (distSq2 <= R_A_SQ)) {
+            // The next edge takes care of its first vertex
+            if (O.convex(vertex2) && (relativePosition2.cross(O.direction(vertex2)) >= 0)) {
+                halfPlanes.push_back(BasicDirectedHalfPlane<T>(Vector(),
+                    Vector(- relativePosition2.y(), relativePosition2.x())));
+            }
+            continue;
+        } else if ((s >= 0) && (s <= 1) && (distSqLine <= R_A_SQ)) {
+            halfPlanes.push_back(BasicDirectedHalfPlane<T>(Vector(), - O.direction(vertex1)));
+            continue;
+        }
+        
+        // Otherwise, find the legs of the velocity obstacle.
+        // Seen obliquely, both legs come from the same vertex,
+        // while at a vertex where the obstacle is not convex,
+        // the leg follows the edge itself
+        Vector leftLegDirection, rightLegDirection;
+        
+        if ((s < 0) && (distSqLine <= R_A_SQ)) {
+            if (!O.convex(vertex1)) {
+                continue;
+            }
+            vertex2 = vertex1;
+            T leg1 = std::sqrt(distSq1 - R_A_SQ);
+            leftLegDirection = Vector(relativePosition1.x() * leg1 - relativePosition1.y() * R_A,
+                relativePosition1.x() * R_A + relativePosition1.y() * leg1) / distSq1;
+            rightLegDirection = Vector(relativePosition1.x() * leg1 + relativePosition1.y() * R_A,
+                - relativePosition1.x() * R_A + relativePosition1.y() * leg1) / distSq1;
+        } else if ((s > 1) && (distSqLine <= R_A_SQ)) {
+            if (!O.convex(vertex2)) {
+                continue;
+            }
+            vertex1 = vertex2;
+            T leg2 = std::sqrt(distSq2 - R_A_SQ);
+            leftLegDirection = Vector(relativePosition2.x() * leg2 - relativePosition2.y() * R_A,
+                relativePosition2.x() * R_A + relativePosition2.y() * leg2) / distSq2;
+            rightLegDirection = Vector(relativePosition2.x() * leg2 + relativePosition2.y() * R_A,
+                - relativePosition2.x() * R_A + relativePosition2.y() * leg2) / distSq2;
+        } else {
+            if (O.convex(vertex1)) {
+                T leg1 = std::sqrt(distSq1 - R_A_SQ);
+                leftLegDirection = Vector(relativePosition1.x() * leg1 - relativePosition1.y() * R_A,
+                    relativePosition1.x() * R_A + relativePosition1.y() * leg1) / distSq1;
+            } else {
+                leftLegDirection = - O.direction(vertex1);
+            }
+            if (O.convex(vertex2)) {
+                T leg2 = std::sqrt(distSq2 - R_A_SQ);
+                rightLegDirection = Vector(relativePosition2.x() * leg2 + relativePosition2.y() * R_A,
+                    - relativePosition2.x() * R_A + relativePosition2.y() * leg2) / distSq2;
+            } else {
+                rightLegDirection = O.direction(vertex1);
+            }
+        }
+        
+        // A leg pointing into the neighboring edge is replaced by
+        // that edge, whose own velocity obstacle takes care of the
+        // velocities projecting onto it
+        bool leftLegForeign = false;
+        bool rightLegForeign = false;
+        
+        if (O.convex(vertex1) && (leftLegDirection.cross(- O.direction(O.previous(vertex1))) >= 0)) {
+            leftLegDirection = - O.direction(O.previous(vertex1));
+            leftLegForeign = true;
+        }
+        if (O.convex(vertex2) && (rightLegDirection.cross(O.direction(vertex2)) <= 0)) {
+            rightLegDirection = O.direction(vertex2);
+            rightLegForeign = true;
+        }
+        
+        // Project V_A onto the truncated velocity obstacle
+        Vector leftCutoff = O.point(vertex1).from(P_A) * INV_TAU;
+        Vector rightCutoff = O.point(vertex2).from(P_A) * INV_TAU;
+        Vector cutoffVector = rightCutoff - leftCutoff;
+        bool sameVertex = (vertex1 == vertex2);
+        
+        T t = sameVertex ? T(0.5) : ((V_A - leftCutoff) * cutoffVector) / (cutoffVector * cutoffVector);
+        T tLeft = (V_A - leftCutoff) * leftLegDirection;
+        T tRight = (V_A - rightCutoff) * rightLegDirection;
+        
+        // Onto the left or right truncation circle
+        if (((t < 0) && (tLeft < 0)) || (sameVertex && (tLeft < 0) && (tRight < 0))) {
+            Vector unitW = V_A - leftCutoff;
+            unitW.normalize();
+            halfPlanes.push_back(BasicDirectedHalfPlane<T>(leftCutoff + unitW * (R_A * INV_TAU),
+                Vector(unitW.y(), - unitW.x())));
+            continue;
+        } else if ((t > 1) && (tRight < 0)) {
+            Vector unitW = V_A - rightCutoff;
+            unitW.normalize();
+            halfPlanes.push_back(BasicDirectedHalfPlane<T>(rightCutoff + unitW * (R_A * INV_TAU),
+                Vector(unitW.y(), - unitW.x())));
+            continue;
+        }
+        
+        // Onto the truncation line or either leg, whichever is
+        // closest to V_A
+        Vector toCutoff = V_A - (leftCutoff + cutoffVector * t);
+        Vector toLeft = V_A - (leftCutoff + leftLegDirection * tLeft);
+        Vector toRight = V_A - (rightCutoff + rightLegDirection * tRight);
+        
+        T distSqCutoff = ((t < 0) || (t > 1) || sameVertex) ? INFINITE : toCutoff * toCutoff;
+        T distSqLeft = (tLeft < 0) ? INFINITE : toLeft * toLeft;
+        T distSqRight = (tRight < 0) ? INFINITE : toRight * toRight;
+        
+        Vector direction;
+        Vector origin;
+        
+        if ((distSqCutoff <= distSqLeft) && (distSqCutoff <= distSqRight)) {
+            direction = - O.direction(vertex1);
+            origin = leftCutoff;
+        } else if (distSqLeft <= distSqRight) {
+            if (leftLegForeign) {
+                continue;
+            }
+            direction = leftLegDirection;
+            origin = leftCutoff;
+        } else {
+            if (rightLegForeign) {
+                continue;
+            }
+            direction = - rightLegDirection;
+            origin = rightCutoff;
+        }
+        
+        halfPlanes.push_back(BasicDirectedHalfPlane<T>(
+            origin + Vector(- direction.y(), direction.x()) * (R_A * INV_TAU), direction));
+            
+    }
+}
+
+/*
+    Helpers
+*/
+
+/**
+ * Returns the tolerance below which two bounding
+ * lines are considered parallel by the linear
+ * programs in double precision.
+ */
+template <>
+double ORCA::epsilon<double>(void) {
+    return ORCA::EPSILON;
+}
+
+/**
+ * Returns the tolerance below which two bounding
+ * lines are considered parallel by the linear
+ * programs in single precision.
+ */
+template <>
+float ORCA::epsilon<float>(void) {
+    return ORCA::FLOAT_EPSILON;
+}
+
+/**
+ * Finds the velocity minimizing the maximum distance
+ * by which it violates the half-planes H, within the
+ * circle of radius MAX_SPEED, as in the original ORCA
+ * paper. This is a 3-dimensional linear program whose
+ * third dimension is the violation, solved by running
+ * a 2-dimensional one on the bisectors of the bounding
+ * lines each time the violation has to grow. The
+ * half-planes of obstacles are never violated, and
+ * join the bisectors as they are.
+ * 
+ * @param H              - The set of half-planes to satisfy
+ *                         as much as possible
+ * @param BEGIN          - The index of the first half-plane
+ *                         not satisfied by the solution
+ * @param OBSTACLE_COUNT - The number of half-planes at the
+ *                         front of H that come from obstacles
+ * @param MAX_SPEED      - The maximum speed of the solution
+ * @param solution       - The solution for the half-planes
+ *                         before BEGIN, set to the velocity
+ *                         minimizing the maximum violation
+ * @param bisectors      - The list to hold the bisectors of
+ *                         the bounding line of the most
+ *                         violated half-plane and those of
+ *                         the previous ones
+ */
+template <typename T>
+void ORCA::minimizeViolation(const std::vector<BasicDirectedHalfPlane<T> >& H,
+    const size_t BEGIN, const size_t OBSTACLE_COUNT, const T MAX_SPEED, BasicVector<T>& solution,
+    std::vector<BasicDirectedHalfPlane<T> >& bisectors) noexcept
+{
+    T distance = 0.0;
+    
+    for (size_t i = std::max(BEGIN, OBSTACLE_COUNT) ; i < H.size() ; i++) {
+        
+        // If the solution violates this half-plane more than the
+        // maximum violation so far, then the maximum violation
+        // has to grow and the solution is moved along the
+        // bisectors until this half-plane is violated as much
+        // as the most violated previous one
+        if (H[i].violation(solution) > distance) {
+            
+            bisectors.assign(H.begin(), H.begin() + OBSTACLE_COUNT);
+            
+            for (size_t j = OBSTACLE_COUNT ; j < i ; j++) {
+                
+                T determinant = H[i].direction().cross(H[j].direction());
+                
+                // Parallel bounding lines facing the same way do not
+                // constrain the violation, while opposite ones are
+                // bisected by the line halfway between them
+                if (std::abs(determinant) <= ORCA::epsilon<T>()) {
+                    if (H[i].direction() * H[j].direction() > 0.0) {
+                        continue;
+                    }
+                    bisectors.push_back(BasicDirectedHalfPlane<T>((H[i].point() + H[j].point()) / 2.0,
+                        H[j].direction() - H[i].direction()));
+                } else {
+                    bisectors.push_back(BasicDirectedHalfPlane<T>(H[i].point() + H[i].direction() *
+                        (H[j].direction().cross(H[i].point() - H[j].point()) / determinant),
+                        H[j].direction() - H[i].direction()));
+                }
+                
+            }
+            
+            // Move as far as possible into the half-plane, which can
+            // only fail because of rounding errors, in which case the
+            // solution is already optimal
+            BasicVector<T> previous = solution;
+            if (ORCA::solveInCircle(bisectors, MAX_SPEED, H[i].normal(), true, solution) < bisectors.size()) {
+                solution = previous;
+            }
+            
+            distance = H[i].violation(solution);
+            
+        }
+        
+    }
+}
+
+/**
+ * Solves the linear program given by the half-planes
+ * H, in their current order, within the circle of
+ * radius MAX_SPEED, optimizing either the distance to
+ * V_OPT or, if DIRECTION_OPT is set, the extent in the
+ * direction of the unit vector V_OPT.
+ * Returns the number of half-planes if the program is
+ * feasible, or the index of the half-plane that could
+ * not be satisfied otherwise, the solution then being
+ * left as the solution for the half-planes before it.
+ * 
+ * @param H             - The set of half-planes
+ * @param MAX_SPEED     - The radius of the circle
+ * @param V_OPT         - The optimization velocity
+ * @param DIRECTION_OPT - Whether to optimize the extent
+ *                        in the direction of V_OPT
+ * @param solution      - Set to the solution
+ * @param violations    - If not null, incremented for each
+ *                        half-plane the solution had to be
+ *                        moved onto
+ */
+template <typename T>
+size_t ORCA::solveInCircle(const std::vector<BasicDirectedHalfPlane<T> >& H, const T MAX_SPEED,
+    const BasicVector<T>& V_OPT, const bool DIRECTION_OPT, BasicVector<T>& solution,
+    size_t* violations/* = NULL */) noexcept
+{
+    // Start from the optimum within the circle alone
+    if (DIRECTION_OPT) {
+        solution = V_OPT * MAX_SPEED;
+    } else {
+        solution = BasicVector<T>(V_OPT).limitNorm(MAX_SPEED);
+    }
+    
+    for (size_t i = 0 ; i < H.size() ; i++) {
+        
+        // If the solution is outside of the half-plane, the
+        // new solution lies on its bounding line
+        if (H[i].violation(solution) > 0.0) {
+            if (violations != NULL) {
+                (*violations)++;
+            }
+            BasicVector<T> previous = solution;
+            if (!ORCA::solveOnLine(H, i, MAX_SPEED, V_OPT, DIRECTION_OPT, solution)) {
+                solution = previous;
+                return i;
+            }
+        }
+        
+    }
+    
+    return H.size();
+}
+
+/**
+ * Solves the linear program restricted to the bounding
+ * line of the I-th half-plane of H, within the circle
+ * of radius MAX_SPEED and inside the half-planes before
+ * it. Returns false if no such point exists.
+ * 
+ * @param H             - The set of half-planes
+ * @param I             - The index of the half-plane
+ *                        to solve on
+ * @param MAX_SPEED     - The radius of the circle
+ * @param V_OPT         - The optimization velocity
+ * @param DIRECTION_OPT - Whether to optimize the extent
+ *                        in the direction of V_OPT
+ * @param solution      - Set to the solution
+ */
+template <typename T>
+bool ORCA::solveOnLine(const std::vector<BasicDirectedHalfPlane<T> >& H, const size_t I,
+    const T MAX_SPEED, const BasicVector<T>& V_OPT, const bool DIRECTION_OPT,
+    BasicVector<T>& solution) noexcept
+{
+    const BasicVector<T>& point = H[I].point();
+    const BasicVector<T>& direction = H[I].direction();
+    
+    // Intersect the bounding line, parametrized as
+    // point + t * direction, with the circle
+    T dotProduct = point * direction;
+    T discriminant = dotProduct * dotProduct + MAX_SPEED * MAX_SPEED - point * point;
+    
+    if (discriminant < 0.0) {
+        return false;
+    }
+    
+    T tLeft = - dotProduct - std::sqrt(discriminant);
+    T tRight = - dotProduct + std::sqrt(discriminant);
+    
+    // Clip the segment with the previous half-planes
+    for (size_t j = 0 ; j < I ; j++) {
+        
+        T denominator = direction.cross(H[j].direction());
+        T numerator = H[j].direction().cross(point - H[j].point());
+        
+        // Parallel lines either contain the whole segment or none of it
+        if (std::abs(denominator) <= ORCA::epsilon<T>()) {
+            if (numerator < 0.0) {
+                return false;
+            }
+            continue;
+        }
+        
+        T t = numerator / denominator;
+        if (denominator >= 0.0) {
+            tRight = std::min(tRight, t);
+        } else {
+            tLeft = std::max(tLeft, t);
+        }
+        
+        if (tLeft > tRight) {
+            return false;
+        }
+        
+    }
+    
+    // Pick the optimal point of the segment
+    T t;
+    if (DIRECTION_OPT) {
+        t = (V_OPT * direction > 0.0) ? tRight : tLeft;
+    } else {
+        t = CONSTRAIN_VALUE(direction * (V_OPT - point), tLeft, tRight);
+    }
+    
+    solution = point + direction * t;
+    
+    return true;
+}
+
+/*
+    Explicit instantiations
+*/
+
+template ORCA::LinearProgramStatus ORCA::solveLinearProgram<float>(
+    std::vector<DirectedHalfPlaneF>& H, const VectorF& V_PREF, const float MAX_SPEED,
+    PointF& solution) noexcept;
+    
+template ORCA::LinearProgramStatus ORCA::solveLinearProgram<double>(
+    std::vector<DirectedHalfPlane>& H, const Vector& V_PREF, const double MAX_SPEED,
+    Point& solution) noexcept;
+    
+template ORCA::LinearProgramStatus ORCA::solveOrderedLinearProgram<float>(
+    const std::vector<DirectedHalfPlaneF>& H, const VectorF& V_PREF, const float MAX_SPEED,
+    PointF& solution, std::vector<DirectedHalfPlaneF>& bisectors, const size_t OBSTACLE_COUNT,
+    size_t* violations) noexcept;
+    
+template ORCA::LinearProgramStatus ORCA::solveOrderedLinearProgram<double>(
+    const std::vector<DirectedHalfPlane>& H, const Vector& V_PREF, const double MAX_SPEED,
+    Point& solution, std::vector<DirectedHalfPlane>& bisectors, const size_t OBSTACLE_COUNT,
+    size_t* violations) noexcept;
+    
+template DirectedHalfPlaneF ORCA::orca_A_B<float>(const PointF& P_A, const VectorF& V_A,
+    const float R_A, const PointF& P_B, const VectorF& V_B, const float R_B, const float TAU);
+    
+template DirectedHalfPlane ORCA::orca_A_B<double>(const Point& P_A, const Vector& V_A,
+    const double R_A, const Point& P_B, const Vector& V_B, const double R_B, const double TAU);
+    
+template DirectedHalfPlaneF ORCA::orca_A_B_trigonometric<float>(const PointF& P_A,
+    const VectorF& V_A, const float R_A, const PointF& P_B, const VectorF& V_B,
+    const float R_B, const float TAU);
+    
+template DirectedHalfPlane ORCA::orca_A_B_trigonometric<double>(const Point& P_A,
+    const Vector& V_A, const double R_A, const Point& P_B, const Vector& V_B,
+    const double R_B, const double TAU);
+    
+template void ORCA::orca_A_B<float>(const PointF& P_A, const VectorF& V_A, const float R_A,
+    const OrcaKernel::Neighbors<float>& B, const size_t COUNT, const float TAU,
+    const OrcaKernel::HalfPlanes<float>& out, std::vector<DirectedHalfPlaneF>& halfPlanes);
+    
+template void ORCA::orca_A_B<double>(const Point& P_A, const Vector& V_A, const double R_A,
+    const OrcaKernel::Neighbors<double>& B, const size_t COUNT, const double TAU,
+    const OrcaKernel::HalfPlanes<double>& out, std::vector<DirectedHalfPlane>& halfPlanes);
+    
+template void ORCA::orca_A_O<float>(const PointF& P_A, const VectorF& V_A, const float R_A,
+    const ObstacleTreeF& O, const std::vector<std::pair<float, int> >& EDGES, const float TAU,
+    std::vector<DirectedHalfPlaneF>& halfPlanes);
+    
+template void ORCA::orca_A_O<double>(const Point& P_A, const Vector& V_A, const double R_A,
+    const ObstacleTree& O, const std::vector<std::pair<double, int> >& EDGES, const double TAU,
+    std::vector<DirectedHalfPlane>& halfPlanes);
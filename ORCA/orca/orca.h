@@ -1,111 +1,437 @@
-/**
- * File  : orca.h
- * Author: Raja Soufi
- * 
- * Class definition of the ORCA system.
- */
-
-// Include guard
-#ifndef _ORCA_H_
-#define _ORCA_H_
-
-// Inclusions
-#include <algorithm>
-#include <cmath>
-#include <vector>
-
-#include "../geom/point.h"
-
-#include "../utilities/exceptions.h"
-#include "../utilities/utilities.h"
-
-#include "agent.h"
-
-// Forward-declarations
-class Agent;
-
-// Class definition
-class ORCA {
-    
-    private:
-    
-    // Attributes
-    static std::vector<Agent> agents_;
-    static double tau_;
-    static double deltaT_;
-    static double arrivalThreshold_;
-    
-    // Constructor
-    ORCA(void);
-    
-    public:
-    
-    // Getters
-    static inline std::vector<Agent>& agents(void);
-    static inline double tau(void);
-    static inline double deltaT(void);
-    static inline double arrivalThreshold(void);
-    
-    // Other methods
-    static inline int agentCount(void);
-    
-    static void initialize(const std::vector<Agent>& AGENTS, const double TAU,
-        const double DELTA_T, const double ARRIVAL_THRESHOLD);
-    
-    static Point solveLinearProgram(std::vector<HalfPlane>& H, const Vector& V_PREF,
-        const double MAX_SPEED);
-    
-    static void iteration(void);
-    static void moveAgents(const double DELTA_T);
-    static bool converged(void);
-    static void finalize(void);
-    
-};
-
-/*
-    Getters
-*/
-
-/**
- * Returns the set of agents registered in the system.
- */
-inline std::vector<Agent>& ORCA::agents(void) {
-    return ORCA::agents_;
-}
-
-/**
- * Returns the value of tau used for ORCA.
- */
-inline double ORCA::tau(void) {
-    return ORCA::tau_;
-}
-
-/**
- * Returns the value of deltaT used for ORCA.
- */
-inline double ORCA::deltaT(void) {
-    return ORCA::deltaT_;
-}
-
-/**
- * Returns the maximum distance between an agent A
- * and its destination for which A would be
- * considered as arrived.
- */
-inline double ORCA::arrivalThreshold(void) {
-    return ORCA::arrivalThreshold_;
-}
-
-/*
-    Other methods
-*/
-
-/**
- * Returns the number of agents registered in the
- * system.
- */
-inline int ORCA::agentCount(void) {
-    return ORCA::agents_.size();
-}
-
-#endif // _ORCA_H_
+/**
+ * File  : orca.h
+ * Author: Raja Soufi
+ * 
+ * Class definition of the ORCA system.
+ * 
+ * The algorithms are templates over the scalar
+ * type T of the geometry, float or double, with
+ * both versions compiled in orca.cpp. The default
+ * simulation driven by this class runs in double
+ * precision.
+ */
+
+// Include guard
+#ifndef _ORCA_H_
+#define _ORCA_H_
+
+// Inclusions
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "../geom/directedHalfPlane.h"
+#include "../geom/point.h"
+
+#include "../utilities/exceptions.h"
+#include "../utilities/utilities.h"
+
+#include "agent.h"
+#include "agentStore.h"
+#include "obstacle.h"
+#include "obstacleTree.h"
+#include "orcaKernel.h"
+#include "simulator.h"
+
+// Forward-declarations
+class Agent;
+
+// Class definition
+class ORCA {
+    
+    public:
+    
+    // Strategies used to find the neighbors of each agent
+    typedef Simulator::NeighborSearch NeighborSearch;
+    
+    // Outcomes of a linear program
+    enum LinearProgramStatus {
+        FEASIBLE,
+        INFEASIBLE
+    };
+    
+    private:
+    
+    // Constants
+    static const double EPSILON;
+    static const float FLOAT_EPSILON;
+    
+    // Attributes
+    static Simulator simulator_;
+    
+    // Constructor
+    ORCA(void);
+    
+    // Helpers
+    template <typename T>
+    static T epsilon(void);
+    
+    template <typename T>
+    static void minimizeViolation(const std::vector<BasicDirectedHalfPlane<T> >& H,
+        const size_t BEGIN, const size_t OBSTACLE_COUNT, const T MAX_SPEED, BasicVector<T>& solution,
+        std::vector<BasicDirectedHalfPlane<T> >& bisectors) noexcept;
+        
+    template <typename T>
+    static size_t solveInCircle(const std::vector<BasicDirectedHalfPlane<T> >& H, const T MAX_SPEED,
+        const BasicVector<T>& V_OPT, const bool DIRECTION_OPT, BasicVector<T>& solution,
+        size_t* violations = NULL) noexcept;
+        
+    template <typename T>
+    static bool solveOnLine(const std::vector<BasicDirectedHalfPlane<T> >& H, const size_t I,
+        const T MAX_SPEED, const BasicVector<T>& V_OPT, const bool DIRECTION_OPT,
+        BasicVector<T>& solution) noexcept;
+        
+    public:
+    
+    // Getters
+    static inline Simulator& simulator(void);
+    static inline AgentStore& agents(void);
+    static inline const AgentStore& agentsView(void);
+    static inline double tau(void);
+    static inline double deltaT(void);
+    static inline double arrivalThreshold(void);
+    static inline double skew(void);
+    static inline NeighborSearch neighborSearch(void);
+    static inline bool warmStart(void);
+    static inline size_t threadCount(void);
+    static inline const ObstacleTree& obstacles(void);
+    static inline const StepStatistics& statistics(void);
+    static inline const std::vector<AgentDiagnostics>& diagnostics(void);
+    static inline bool sleeping(void);
+    static inline size_t activeCount(void);
+    
+    // Setters
+    static inline void setNeighborSearch(const NeighborSearch NEIGHBOR_SEARCH);
+    static inline void setWarmStart(const bool WARM_START);
+    static inline void setSkew(const double SKEW);
+    static inline void setThreadCount(const size_t THREAD_COUNT);
+    static inline void setObstacles(const std::vector<Obstacle>& OBSTACLES, const double TAU);
+    static inline void setDiagnosed(const std::vector<size_t>& INDICES);
+    static inline void setSleeping(const bool SLEEPING);
+    
+    // Other methods
+    static inline int agentCount(void);
+    
+    static inline void initialize(const std::vector<Agent>& AGENTS, const double TAU,
+        const double DELTA_T, const double ARRIVAL_THRESHOLD);
+        
+    template <typename T>
+    static LinearProgramStatus solveLinearProgram(std::vector<BasicDirectedHalfPlane<T> >& H,
+        const BasicVector<T>& V_PREF, const T MAX_SPEED, BasicPoint<T>& solution) noexcept;
+        
+    template <typename T>
+    static LinearProgramStatus solveOrderedLinearProgram(const std::vector<BasicDirectedHalfPlane<T> >& H,
+        const BasicVector<T>& V_PREF, const T MAX_SPEED, BasicPoint<T>& solution,
+        std::vector<BasicDirectedHalfPlane<T> >& bisectors, const size_t OBSTACLE_COUNT = 0,
+        size_t* violations = NULL) noexcept;
+        
+    template <typename T>
+    static BasicDirectedHalfPlane<T> orca_A_B(const BasicPoint<T>& P_A, const BasicVector<T>& V_A,
+        const T R_A, const BasicPoint<T>& P_B, const BasicVector<T>& V_B, const T R_B, const T TAU);
+        
+    template <typename T>
+    static BasicDirectedHalfPlane<T> orca_A_B_trigonometric(const BasicPoint<T>& P_A,
+        const BasicVector<T>& V_A, const T R_A, const BasicPoint<T>& P_B, const BasicVector<T>& V_B,
+        const T R_B, const T TAU);
+        
+    template <typename T>
+    static void orca_A_B(const BasicPoint<T>& P_A, const BasicVector<T>& V_A, const T R_A,
+        const OrcaKernel::Neighbors<T>& B, const size_t COUNT, const T TAU,
+        const OrcaKernel::HalfPlanes<T>& out, std::vector<BasicDirectedHalfPlane<T> >& halfPlanes);
+        
+    template <typename T>
+    static void orca_A_O(const BasicPoint<T>& P_A, const BasicVector<T>& V_A, const T R_A,
+        const BasicObstacleTree<T>& O, const std::vector<std::pair<T, int> >& EDGES, const T TAU,
+        std::vector<BasicDirectedHalfPlane<T> >& halfPlanes);
+        
+    static inline void iteration(void);
+    static inline void moveAgents(const double DELTA_T);
+    static inline bool converged(void);
+    static inline void finalize(void);
+    static inline void resetStatistics(void);
+    
+};
+
+/*
+    Getters
+*/
+
+/**
+ * Returns the default simulation, the one driven
+ * by the other static functions of this class.
+ */
+inline Simulator& ORCA::simulator(void) {
+    return ORCA::simulator_;
+}
+
+/**
+ * Returns the set of agents registered in the system,
+ * for editing, which wakes every agent up at the next
+ * step.
+ */
+inline AgentStore& ORCA::agents(void) {
+    return ORCA::simulator_.agents();
+}
+
+/**
+ * Returns the set of agents registered in the system,
+ * for reading, which leaves the sleeping agents
+ * asleep.
+ */
+inline const AgentStore& ORCA::agentsView(void) {
+    const Simulator& SIMULATOR = ORCA::simulator_;
+    return SIMULATOR.agents();
+}
+
+/**
+ * Returns the value of tau used for ORCA.
+ */
+inline double ORCA::tau(void) {
+    return ORCA::simulator_.tau();
+}
+
+/**
+ * Returns the value of deltaT used for ORCA.
+ */
+inline double ORCA::deltaT(void) {
+    return ORCA::simulator_.deltaT();
+}
+
+/**
+ * Returns the maximum distance between an agent A
+ * and its destination for which A would be
+ * considered as arrived.
+ */
+inline double ORCA::arrivalThreshold(void) {
+    return ORCA::simulator_.arrivalThreshold();
+}
+
+/**
+ * Returns the maximum slope of the rotation applied
+ * to the preferred velocities of the agents.
+ */
+inline double ORCA::skew(void) {
+    return ORCA::simulator_.skew();
+}
+
+/**
+ * Returns the strategy used to find the neighbors
+ * of each agent during an iteration.
+ */
+inline ORCA::NeighborSearch ORCA::neighborSearch(void) {
+    return ORCA::simulator_.neighborSearch();
+}
+
+/**
+ * Tests whether the linear program of each agent
+ * first tries the half-planes that bounded its
+ * previous solution.
+ */
+inline bool ORCA::warmStart(void) {
+    return ORCA::simulator_.warmStart();
+}
+
+/**
+ * Returns the number of threads used to run the
+ * loops of an iteration.
+ */
+inline size_t ORCA::threadCount(void) {
+    return ORCA::simulator_.threadCount();
+}
+
+/**
+ * Returns the tree holding the edges of the static
+ * obstacles registered in the system.
+ */
+inline const ObstacleTree& ORCA::obstacles(void) {
+    return ORCA::simulator_.obstacles();
+}
+
+/**
+ * Returns the statistics gathered about the steps
+ * of the system since they were last reset.
+ */
+inline const StepStatistics& ORCA::statistics(void) {
+    return ORCA::simulator_.statistics();
+}
+
+/**
+ * Returns the half-planes and linear program
+ * solutions recorded by the last iteration for the
+ * agents selected with setDiagnosed, marked as stale
+ * for the agents asleep during it.
+ */
+inline const std::vector<AgentDiagnostics>& ORCA::diagnostics(void) {
+    return ORCA::simulator_.diagnostics();
+}
+
+/**
+ * Tests whether agents which have arrived and stand
+ * still among still neighbors fall asleep.
+ */
+inline bool ORCA::sleeping(void) {
+    return ORCA::simulator_.sleeping();
+}
+
+/**
+ * Returns the number of agents which are awake, for
+ * which the next iteration solves linear programs.
+ */
+inline size_t ORCA::activeCount(void) {
+    return ORCA::simulator_.activeCount();
+}
+
+/*
+    Setters
+*/
+
+/**
+ * Sets the strategy used to find the neighbors of
+ * each agent during an iteration.
+ * 
+ * @param NEIGHBOR_SEARCH - The strategy to use
+ */
+inline void ORCA::setNeighborSearch(const NeighborSearch NEIGHBOR_SEARCH) {
+    ORCA::simulator_.setNeighborSearch(NEIGHBOR_SEARCH);
+}
+
+/**
+ * Sets whether the linear program of each agent
+ * first tries the half-planes that bounded its
+ * previous solution.
+ * 
+ * @param WARM_START - Whether to warm start the linear
+ *                     programs
+ */
+inline void ORCA::setWarmStart(const bool WARM_START) {
+    ORCA::simulator_.setWarmStart(WARM_START);
+}
+
+/**
+ * Sets the maximum slope of the rotation applied to
+ * the preferred velocities of the agents, keyed on
+ * their index to break symmetric deadlocks, 0
+ * leaving them pointed at their destinations.
+ * 
+ * @param SKEW - The maximum slope of the rotation
+ */
+inline void ORCA::setSkew(const double SKEW) {
+    ORCA::simulator_.setSkew(SKEW);
+}
+
+/**
+ * Sets the number of threads used to run the loops
+ * of an iteration, the calling thread included.
+ * 
+ * @param THREAD_COUNT - The number of threads to use,
+ *                       0 meaning all available cores
+ */
+inline void ORCA::setThreadCount(const size_t THREAD_COUNT) {
+    ORCA::simulator_.setThreadCount(THREAD_COUNT);
+}
+
+/**
+ * Sets the static obstacles registered in the system,
+ * replacing the previous ones.
+ * 
+ * @param OBSTACLES - The obstacles to register
+ * @param TAU       - The value of tau to use for the
+ *                    obstacles
+ */
+inline void ORCA::setObstacles(const std::vector<Obstacle>& OBSTACLES, const double TAU) {
+    ORCA::simulator_.setObstacles(OBSTACLES, TAU);
+}
+
+/**
+ * Selects the agents whose half-planes and linear
+ * program solution each iteration records, by index.
+ * 
+ * @param INDICES - The indices of the agents to diagnose
+ */
+inline void ORCA::setDiagnosed(const std::vector<size_t>& INDICES) {
+    ORCA::simulator_.setDiagnosed(INDICES);
+}
+
+/**
+ * Sets whether agents which have arrived and stand
+ * still among still neighbors fall asleep, until a
+ * moving agent comes close to them.
+ * 
+ * @param SLEEPING - Whether agents may fall asleep
+ */
+inline void ORCA::setSleeping(const bool SLEEPING) {
+    ORCA::simulator_.setSleeping(SLEEPING);
+}
+
+/*
+    Other methods
+*/
+
+/**
+ * Returns the number of agents registered in the
+ * system.
+ */
+inline int ORCA::agentCount(void) {
+    return ORCA::simulator_.agentCount();
+}
+
+/**
+ * Initializes the system with a set of agents, a value of
+ * tau, and an arrival threshold given as parameters.
+ * 
+ * @param AGENTS            - The agents to register in the system
+ * @param TAU               - The value of tau to use for the ORCA
+ *                            system
+ * @param DELTA_T           - The duration of an iteration
+ * @param ARRIVAL_THRESHOLD - The arrival threshold to be used
+ */
+inline void ORCA::initialize(const std::vector<Agent>& AGENTS, const double TAU,
+    const double DELTA_T, const double ARRIVAL_THRESHOLD)
+{
+    ORCA::simulator_.initialize(AGENTS, TAU, DELTA_T, ARRIVAL_THRESHOLD);
+}
+
+/**
+ * Executes a single iteration of ORCA.
+ */
+inline void ORCA::iteration(void) {
+    ORCA::simulator_.iteration();
+}
+
+/**
+ * Moves agents for DELTA_T time one by one.
+ * 
+ * @param DELTA_T - The time during which to move
+ *                  the agents
+ */
+inline void ORCA::moveAgents(const double DELTA_T) {
+    ORCA::simulator_.moveAgents(DELTA_T);
+}
+
+/**
+ * Tests whether the system has converged, in the
+ * sense of that all agents are within the arrival
+ * threshold from their respective destinations.
+ */
+inline bool ORCA::converged(void) {
+    return ORCA::simulator_.converged();
+}
+
+/**
+ * Runs finalization code that is executed when
+ * the system converges and is about to terminate.
+ */
+inline void ORCA::finalize(void) {
+    ORCA::simulator_.finalize();
+}
+
+/**
+ * Resets the statistics gathered about the steps
+ * of the system to 0.
+ */
+inline void ORCA::resetStatistics(void) {
+    ORCA::simulator_.resetStatistics();
+}
+
+#endif // _ORCA_H_
@@ -0,0 +1,205 @@
+/**
+ * File  : orcaKernel.cpp
+ * Author: Raja Soufi
+ * 
+ * Implementation of the OrcaKernel class defined
+ * in orcaKernel.h, along with its scalar version.
+ * The vectorized versions live in their own files,
+ * compiled for their own instruction sets.
+ */
+
+// Include header file
+#include "orcaKernel.h"
+
+#include <cmath>
+
+#if defined(ORCA_KERNEL_AVX2) && defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+/*
+    Packs
+*/
+
+namespace {
+
+/**
+ * A pack of a single float or double, with which
+ * the kernel runs one neighbor at a time on any CPU.
+ */
+template <typename T>
+struct ScalarPack {
+    
+    typedef T Value;
+    typedef bool Mask;
+    
+    static const size_t WIDTH = 1;
+    
+    static inline Value set(const T X) { return X; }
+    static inline Value load(const T* P) { return *P; }
+    static inline void store(T* p, const Value A) { *p = A; }
+    
+    static inline Value add(const Value A, const Value B) { return A + B; }
+    static inline Value sub(const Value A, const Value B) { return A - B; }
+    static inline Value mul(const Value A, const Value B) { return A * B; }
+    static inline Value div(const Value A, const Value B) { return A / B; }
+    static inline Value sqrt(const Value A) { return std::sqrt(A); }
+    static inline Value abs(const Value A) { return std::abs(A); }
+    static inline Value max(const Value A, const Value B) { return (A > B) ? A : B; }
+    
+    static inline Mask lessEqual(const Value A, const Value B) { return A <= B; }
+    static inline Mask greater(const Value A, const Value B) { return A > B; }
+    static inline Mask equal(const Value A, const Value B) { return A == B; }
+    static inline Mask bitAnd(const Mask A, const Mask B) { return A && B; }
+    static inline Mask andNot(const Mask A, const Mask B) { return A && !B; }
+    
+    static inline Value select(const Mask M, const Value A, const Value B) { return M ? A : B; }
+    
+};
+
+}
+
+/*
+    Getters
+*/
+
+/**
+ * Returns the best instruction set supported by the
+ * CPU running the program, detected once.
+ */
+OrcaKernel::InstructionSet OrcaKernel::instructionSet(void) {
+    static const InstructionSet INSTRUCTION_SET = OrcaKernel::detect();
+    return INSTRUCTION_SET;
+}
+
+/**
+ * Returns the name of the instruction set given as
+ * a parameter.
+ * 
+ * @param INSTRUCTION_SET - The instruction set to name
+ */
+const char* OrcaKernel::instructionSetName(const InstructionSet INSTRUCTION_SET) {
+    switch (INSTRUCTION_SET) {
+        case OrcaKernel::AVX2: return "AVX2";
+        case OrcaKernel::NEON: return "NEON";
+        default: return "scalar";
+    }
+}
+
+/*
+    Other methods
+*/
+
+/**
+ * Computes ORCA_A|B^TAU for the COUNT neighbors B
+ * given as a parameter, where A is the agent with
+ * the position, velocity and radius given as
+ * parameters. The neighbors are processed with the
+ * instruction set given as a parameter as far as
+ * they fill its registers, and the remaining ones
+ * one at a time. An instruction set the CPU does
+ * not support falls back to the scalar version.
+ * 
+ * @param INSTRUCTION_SET - The instruction set to use
+ * @param P_AX            - The x-coordinate of the position of A
+ * @param P_AY            - The y-coordinate of the position of A
+ * @param V_AX            - The x-coordinate of the velocity of A
+ * @param V_AY            - The y-coordinate of the velocity of A
+ * @param R_A             - The radius of A
+ * @param B               - The neighbors of A
+ * @param COUNT           - The number of neighbors
+ * @param TAU             - The value of tau to be used when
+ *                          computing ORCA_A|B^TAU
+ * @param out             - The arrays receiving the half-planes
+ */
+template <typename T>
+void OrcaKernel::compute(const InstructionSet INSTRUCTION_SET, const T P_AX, const T P_AY,
+    const T V_AX, const T V_AY, const T R_A, const Neighbors<T>& B, const size_t COUNT,
+    const T TAU, const HalfPlanes<T>& out)
+{
+    size_t done = 0;
+    
+    #ifdef ORCA_KERNEL_AVX2
+    if ((INSTRUCTION_SET == OrcaKernel::AVX2) && (OrcaKernel::instructionSet() == OrcaKernel::AVX2)) {
+        done = OrcaKernel::computeAvx2(P_AX, P_AY, V_AX, V_AY, R_A, B, COUNT, TAU, out);
+    }
+    #endif
+    
+    #ifdef ORCA_KERNEL_NEON
+    if (INSTRUCTION_SET == OrcaKernel::NEON) {
+        done = OrcaKernel::computeNeon(P_AX, P_AY, V_AX, V_AY, R_A, B, COUNT, TAU, out);
+    }
+    #endif
+    
+    OrcaKernel::computeScalar(P_AX, P_AY, V_AX, V_AY, R_A, B, done, COUNT, TAU, out);
+}
+
+/*
+    Helpers
+*/
+
+/**
+ * Detects the best instruction set supported by the
+ * CPU running the program. AVX2 also requires the
+ * operating system to save the YMM registers.
+ */
+OrcaKernel::InstructionSet OrcaKernel::detect(void) {
+    
+    #if defined(ORCA_KERNEL_AVX2) && defined(__GNUC__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return OrcaKernel::AVX2;
+    }
+    #elif defined(ORCA_KERNEL_AVX2) && defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] >= 7) {
+        __cpuid(info, 1);
+        bool osSavesYmm = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && ((_xgetbv(0) & 6) == 6);
+        __cpuidex(info, 7, 0);
+        if (osSavesYmm && (info[1] & (1 << 5))) {
+            return OrcaKernel::AVX2;
+        }
+    }
+    #elif defined(ORCA_KERNEL_NEON)
+    return OrcaKernel::NEON;
+    #endif
+    
+    return OrcaKernel::SCALAR;
+}
+
+/**
+ * Computes ORCA_A|B^TAU for the neighbors B with
+ * indices in [BEGIN, END), one at a time.
+ * 
+ * @param P_AX  - The x-coordinate of the position of A
+ * @param P_AY  - The y-coordinate of the position of A
+ * @param V_AX  - The x-coordinate of the velocity of A
+ * @param V_AY  - The y-coordinate of the velocity of A
+ * @param R_A   - The radius of A
+ * @param B     - The neighbors of A
+ * @param BEGIN - The index of the first neighbor
+ * @param END   - One past the index of the last neighbor
+ * @param TAU   - The value of tau to be used when
+ *                computing ORCA_A|B^TAU
+ * @param out   - The arrays receiving the half-planes
+ */
+template <typename T>
+void OrcaKernel::computeScalar(const T P_AX, const T P_AY, const T V_AX, const T V_AY,
+    const T R_A, const Neighbors<T>& B, const size_t BEGIN, const size_t END,
+    const T TAU, const HalfPlanes<T>& out)
+{
+    OrcaKernel::computeRange<ScalarPack<T> >(P_AX, P_AY, V_AX, V_AY, R_A, B, BEGIN, END, TAU, out);
+}
+
+/*
+    Explicit instantiations
+*/
+
+template void OrcaKernel::compute<float>(const InstructionSet INSTRUCTION_SET,
+    const float P_AX, const float P_AY, const float V_AX, const float V_AY, const float R_A,
+    const Neighbors<float>& B, const size_t COUNT, const float TAU, const HalfPlanes<float>& out);
+    
+template void OrcaKernel::compute<double>(const InstructionSet INSTRUCTION_SET,
+    const double P_AX, const double P_AY, const double V_AX, const double V_AY, const double R_A,
+    const Neighbors<double>& B, const size_t COUNT, const double TAU, const HalfPlanes<double>& out);
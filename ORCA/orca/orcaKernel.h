@@ -0,0 +1,247 @@
+/**
+ * File  : orcaKernel.h
+ * Author: Raja Soufi
+ * 
+ * Class definition of the batched kernel computing
+ * ORCA_A|B^TAU for an agent A and a whole batch of
+ * neighbors B at once.
+ * 
+ * The neighbors are given as contiguous arrays of
+ * coordinates, so that several of them fit in the
+ * lanes of a SIMD register. The kernel is written
+ * once, as a template over a pack of lanes, and
+ * instantiated for plain doubles, for AVX2 on x86
+ * and for NEON on 64-bit ARM. The best instruction
+ * set supported by the CPU is picked at run time.
+ * Both float and double neighbors are supported,
+ * floats filling twice as many lanes.
+ * 
+ * The computation is the one of
+ * ORCA::orca_A_B_trigonometric, with the sine and
+ * cosine of the aperture of the velocity obstacle
+ * derived from the distance and radii instead of
+ * going through asin and rotated vectors, and the
+ * circle tangent to the leg of the velocity obstacle
+ * found by a division instead of the intersection of
+ * two lines.
+ */
+
+// Include guard
+#ifndef _ORCA_KERNEL_H_
+#define _ORCA_KERNEL_H_
+
+// Inclusions
+#include <cstddef>
+
+// Instruction sets compiled in
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #define ORCA_KERNEL_AVX2
+#endif
+#if defined(__aarch64__) || defined(_M_ARM64)
+    #define ORCA_KERNEL_NEON
+#endif
+
+// Class definition
+class OrcaKernel {
+    
+    public:
+    
+    // Instruction sets the kernel can run on
+    enum InstructionSet {
+        SCALAR,
+        AVX2,
+        NEON
+    };
+    
+    // Arrays describing the neighbors B
+    template <typename T>
+    struct Neighbors {
+        const T* positionX;
+        const T* positionY;
+        const T* velocityX;
+        const T* velocityY;
+        const T* radius;
+    };
+    
+    // Arrays receiving the half-planes ORCA_A|B^TAU
+    template <typename T>
+    struct HalfPlanes {
+        T* pointX;
+        T* pointY;
+        T* directionX;
+        T* directionY;
+    };
+    
+    private:
+    
+    // Constructor
+    OrcaKernel(void);
+    
+    // Helpers
+    static InstructionSet detect(void);
+    
+    template <typename Pack, typename T>
+    static void computeRange(const T P_AX, const T P_AY, const T V_AX, const T V_AY,
+        const T R_A, const Neighbors<T>& B, const size_t BEGIN, const size_t END,
+        const T TAU, const HalfPlanes<T>& out);
+        
+    template <typename T>
+    static void computeScalar(const T P_AX, const T P_AY, const T V_AX, const T V_AY,
+        const T R_A, const Neighbors<T>& B, const size_t BEGIN, const size_t END,
+        const T TAU, const HalfPlanes<T>& out);
+        
+    #ifdef ORCA_KERNEL_AVX2
+    static size_t computeAvx2(const float P_AX, const float P_AY, const float V_AX,
+        const float V_AY, const float R_A, const Neighbors<float>& B, const size_t COUNT,
+        const float TAU, const HalfPlanes<float>& out);
+        
+    static size_t computeAvx2(const double P_AX, const double P_AY, const double V_AX,
+        const double V_AY, const double R_A, const Neighbors<double>& B, const size_t COUNT,
+        const double TAU, const HalfPlanes<double>& out);
+    #endif
+    
+    #ifdef ORCA_KERNEL_NEON
+    static size_t computeNeon(const float P_AX, const float P_AY, const float V_AX,
+        const float V_AY, const float R_A, const Neighbors<float>& B, const size_t COUNT,
+        const float TAU, const HalfPlanes<float>& out);
+        
+    static size_t computeNeon(const double P_AX, const double P_AY, const double V_AX,
+        const double V_AY, const double R_A, const Neighbors<double>& B, const size_t COUNT,
+        const double TAU, const HalfPlanes<double>& out);
+    #endif
+    
+    public:
+    
+    // Getters
+    static InstructionSet instructionSet(void);
+    static const char* instructionSetName(const InstructionSet INSTRUCTION_SET);
+    
+    // Other methods
+    template <typename T>
+    static void compute(const InstructionSet INSTRUCTION_SET, const T P_AX, const T P_AY,
+        const T V_AX, const T V_AY, const T R_A, const Neighbors<T>& B, const size_t COUNT,
+        const T TAU, const HalfPlanes<T>& out);
+        
+};
+
+/*
+    Helpers
+*/
+
+/**
+ * Computes ORCA_A|B^TAU for the neighbors B with
+ * indices in [BEGIN, END), Pack::WIDTH at a time,
+ * where A is the agent with the position, velocity
+ * and radius given as parameters. The size of the
+ * range must be a multiple of Pack::WIDTH, and T
+ * must be the type of the lanes of the pack.
+ * 
+ * The bounding line of each half-plane is written as
+ * one of its points and a direction which is not
+ * normalized, as they are given to the constructor of
+ * DirectedHalfPlane by ORCA::orca_A_B_trigonometric.
+ * 
+ * @param P_AX  - The x-coordinate of the position of A
+ * @param P_AY  - The y-coordinate of the position of A
+ * @param V_AX  - The x-coordinate of the velocity of A
+ * @param V_AY  - The y-coordinate of the velocity of A
+ * @param R_A   - The radius of A
+ * @param B     - The neighbors of A
+ * @param BEGIN - The index of the first neighbor
+ * @param END   - One past the index of the last neighbor
+ * @param TAU   - The value of tau to be used when
+ *                computing ORCA_A|B^TAU
+ * @param out   - The arrays receiving the half-planes
+ */
+template <typename Pack, typename T>
+void OrcaKernel::computeRange(const T P_AX, const T P_AY, const T V_AX, const T V_AY,
+    const T R_A, const Neighbors<T>& B, const size_t BEGIN, const size_t END,
+    const T TAU, const HalfPlanes<T>& out)
+{
+    typedef typename Pack::Value Value;
+    typedef typename Pack::Mask Mask;
+    
+    const Value zero = Pack::set(0.0);
+    const Value half = Pack::set(0.5);
+    const Value one = Pack::set(1.0);
+    const Value tau = Pack::set(TAU);
+    
+    const Value pAX = Pack::set(P_AX), pAY = Pack::set(P_AY);
+    const Value vAX = Pack::set(V_AX), vAY = Pack::set(V_AY);
+    const Value rA = Pack::set(R_A);
+    
+    for (size_t i = BEGIN ; i < END ; i += Pack::WIDTH) {
+        
+        // p_B - p_A, the axis of the velocity obstacle
+        Value axisX = Pack::sub(Pack::load(B.positionX + i), pAX);
+        Value axisY = Pack::sub(Pack::load(B.positionY + i), pAY);
+        
+        // v_A - v_B
+        Value vDiffX = Pack::sub(vAX, Pack::load(B.velocityX + i));
+        Value vDiffY = Pack::sub(vAY, Pack::load(B.velocityY + i));
+        
+        Value radius = Pack::add(rA, Pack::load(B.radius + i));
+        
+        Value distSq = Pack::add(Pack::mul(axisX, axisX), Pack::mul(axisY, axisY));
+        Value dist = Pack::sqrt(distSq);
+        Value unitX = Pack::div(axisX, dist);
+        Value unitY = Pack::div(axisY, dist);
+        
+        // If A and B overlap, the velocity obstacle has no
+        // legs, which is the same as a half aperture of 90 degrees
+        Mask overlapping = Pack::lessEqual(dist, radius);
+        
+        Value sine = Pack::select(overlapping, one, Pack::div(radius, dist));
+        Value cosine = Pack::select(overlapping, zero,
+            Pack::div(Pack::sqrt(Pack::max(Pack::sub(distSq, Pack::mul(radius, radius)), zero)), dist));
+            
+        // The unit vectors along the left and right legs
+        Value leftX = Pack::sub(Pack::mul(unitX, cosine), Pack::mul(unitY, sine));
+        Value leftY = Pack::add(Pack::mul(unitX, sine), Pack::mul(unitY, cosine));
+        Value rightX = Pack::add(Pack::mul(unitX, cosine), Pack::mul(unitY, sine));
+        Value rightY = Pack::sub(Pack::mul(unitY, cosine), Pack::mul(unitX, sine));
+        
+        Value leftDot = Pack::add(Pack::mul(vDiffX, leftX), Pack::mul(vDiffY, leftY));
+        Value rightDot = Pack::add(Pack::mul(vDiffX, rightX), Pack::mul(vDiffY, rightY));
+        
+        // Distance from the origin to the center of the closest
+        // circle, the truncation circle or the one tangent to the
+        // leg at the projection of v_A - v_B, along the axis.
+        // When v_A - v_B points towards B, the longest projection
+        // is that onto the leg making the smallest angle with it
+        Value centerDist = Pack::div(dist, tau);
+        Value projectionDist = Pack::div(Pack::max(leftDot, rightDot), cosine);
+        
+        Mask towards = Pack::greater(Pack::add(Pack::mul(vDiffX, axisX), Pack::mul(vDiffY, axisY)), zero);
+        Mask useProjection = Pack::andNot(Pack::bitAnd(towards, Pack::greater(projectionDist, centerDist)), overlapping);
+        
+        centerDist = Pack::select(useProjection, projectionDist, centerDist);
+        
+        Value circleRadius = Pack::div(Pack::mul(radius, centerDist), dist);
+        
+        Value centerToVX = Pack::sub(vDiffX, Pack::mul(unitX, centerDist));
+        Value centerToVY = Pack::sub(vDiffY, Pack::mul(unitY, centerDist));
+        Value centerToVNorm = Pack::sqrt(Pack::add(Pack::mul(centerToVX, centerToVX), Pack::mul(centerToVY, centerToVY)));
+        
+        // In case v_A - v_B is the center of the circle, the
+        // vector to the border is found using the right leg
+        Mask atCenter = Pack::equal(centerToVNorm, zero);
+        Value scale = Pack::div(circleRadius, centerToVNorm);
+        Value rightLength = Pack::abs(rightDot);
+        
+        Value centerToBorderX = Pack::select(atCenter,
+            Pack::sub(Pack::mul(rightX, rightLength), vDiffX), Pack::mul(centerToVX, scale));
+        Value centerToBorderY = Pack::select(atCenter,
+            Pack::sub(Pack::mul(rightY, rightLength), vDiffY), Pack::mul(centerToVY, scale));
+            
+        // v_A + u / 2, and the direction of the bounding line
+        Pack::store(out.pointX + i, Pack::add(vAX, Pack::mul(Pack::sub(centerToBorderX, centerToVX), half)));
+        Pack::store(out.pointY + i, Pack::add(vAY, Pack::mul(Pack::sub(centerToBorderY, centerToVY), half)));
+        Pack::store(out.directionX + i, centerToBorderY);
+        Pack::store(out.directionY + i, Pack::sub(zero, centerToBorderX));
+        
+    }
+    
+}
+
+#endif // _ORCA_KERNEL_H_
@@ -0,0 +1,164 @@
+/**
+ * File  : orcaKernelAvx2.cpp
+ * Author: Raja Soufi
+ * 
+ * AVX2 version of the kernel defined in orcaKernel.h,
+ * running four double or eight float neighbors at a
+ * time.
+ * 
+ * The whole file is compiled for AVX2, which is only
+ * used once the CPU has been found to support it.
+ * It must therefore not include anything that could
+ * emit inline functions shared with other files.
+ * FMA is left out so that each lane gives the same
+ * results as the scalar version, down to the bit.
+ */
+
+// Compile this file for AVX2
+#if defined(__clang__)
+    #pragma clang attribute push (__attribute__((target("avx2"))), apply_to = function)
+#elif defined(__GNUC__)
+    #pragma GCC push_options
+    #pragma GCC target("avx2")
+#endif
+
+// Include header file
+#include "orcaKernel.h"
+
+#ifdef ORCA_KERNEL_AVX2
+
+#include <immintrin.h>
+
+/*
+    Packs
+*/
+
+namespace {
+
+/**
+ * A pack of four doubles held in a YMM register.
+ */
+struct Avx2Pack {
+    
+    typedef __m256d Value;
+    typedef __m256d Mask;
+    
+    static const size_t WIDTH = 4;
+    
+    static inline Value set(const double X) { return _mm256_set1_pd(X); }
+    static inline Value load(const double* P) { return _mm256_loadu_pd(P); }
+    static inline void store(double* p, const Value A) { _mm256_storeu_pd(p, A); }
+    
+    static inline Value add(const Value A, const Value B) { return _mm256_add_pd(A, B); }
+    static inline Value sub(const Value A, const Value B) { return _mm256_sub_pd(A, B); }
+    static inline Value mul(const Value A, const Value B) { return _mm256_mul_pd(A, B); }
+    static inline Value div(const Value A, const Value B) { return _mm256_div_pd(A, B); }
+    static inline Value sqrt(const Value A) { return _mm256_sqrt_pd(A); }
+    static inline Value abs(const Value A) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), A); }
+    static inline Value max(const Value A, const Value B) { return _mm256_max_pd(A, B); }
+    
+    static inline Mask lessEqual(const Value A, const Value B) { return _mm256_cmp_pd(A, B, _CMP_LE_OQ); }
+    static inline Mask greater(const Value A, const Value B) { return _mm256_cmp_pd(A, B, _CMP_GT_OQ); }
+    static inline Mask equal(const Value A, const Value B) { return _mm256_cmp_pd(A, B, _CMP_EQ_OQ); }
+    static inline Mask bitAnd(const Mask A, const Mask B) { return _mm256_and_pd(A, B); }
+    static inline Mask andNot(const Mask A, const Mask B) { return _mm256_andnot_pd(B, A); }
+    
+    static inline Value select(const Mask M, const Value A, const Value B) { return _mm256_blendv_pd(B, A, M); }
+    
+};
+
+/**
+ * A pack of eight floats held in a YMM register.
+ */
+struct Avx2FloatPack {
+    
+    typedef __m256 Value;
+    typedef __m256 Mask;
+    
+    static const size_t WIDTH = 8;
+    
+    static inline Value set(const float X) { return _mm256_set1_ps(X); }
+    static inline Value load(const float* P) { return _mm256_loadu_ps(P); }
+    static inline void store(float* p, const Value A) { _mm256_storeu_ps(p, A); }
+    
+    static inline Value add(const Value A, const Value B) { return _mm256_add_ps(A, B); }
+    static inline Value sub(const Value A, const Value B) { return _mm256_sub_ps(A, B); }
+    static inline Value mul(const Value A, const Value B) { return _mm256_mul_ps(A, B); }
+    static inline Value div(const Value A, const Value B) { return _mm256_div_ps(A, B); }
+    static inline Value sqrt(const Value A) { return _mm256_sqrt_ps(A); }
+    static inline Value abs(const Value A) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), A); }
+    static inline Value max(const Value A, const Value B) { return _mm256_max_ps(A, B); }
+    
+    static inline Mask lessEqual(const Value A, const Value B) { return _mm256_cmp_ps(A, B, _CMP_LE_OQ); }
+    static inline Mask greater(const Value A, const Value B) { return _mm256_cmp_ps(A, B, _CMP_GT_OQ); }
+    static inline Mask equal(const Value A, const Value B) { return _mm256_cmp_ps(A, B, _CMP_EQ_OQ); }
+    static inline Mask bitAnd(const Mask A, const Mask B) { return _mm256_and_ps(A, B); }
+    static inline Mask andNot(const Mask A, const Mask B) { return _mm256_andnot_ps(B, A); }
+    
+    static inline Value select(const Mask M, const Value A, const Value B) { return _mm256_blendv_ps(B, A, M); }
+    
+};
+
+}
+
+/*
+    Helpers
+*/
+
+/**
+ * Computes ORCA_A|B^TAU for as many of the COUNT
+ * neighbors B as fill whole registers, eight at a
+ * time, and returns the number of neighbors done.
+ * 
+ * @param P_AX  - The x-coordinate of the position of A
+ * @param P_AY  - The y-coordinate of the position of A
+ * @param V_AX  - The x-coordinate of the velocity of A
+ * @param V_AY  - The y-coordinate of the velocity of A
+ * @param R_A   - The radius of A
+ * @param B     - The neighbors of A
+ * @param COUNT - The number of neighbors
+ * @param TAU   - The value of tau to be used when
+ *                computing ORCA_A|B^TAU
+ * @param out   - The arrays receiving the half-planes
+ */
+size_t OrcaKernel::computeAvx2(const float P_AX, const float P_AY, const float V_AX,
+    const float V_AY, const float R_A, const Neighbors<float>& B, const size_t COUNT,
+    const float TAU, const HalfPlanes<float>& out)
+{
+    size_t done = COUNT - COUNT % Avx2FloatPack::WIDTH;
+    OrcaKernel::computeRange<Avx2FloatPack>(P_AX, P_AY, V_AX, V_AY, R_A, B, 0, done, TAU, out);
+    return done;
+}
+
+/**
+ * Computes ORCA_A|B^TAU for as many of the COUNT
+ * neighbors B as fill whole registers, four at a
+ * time, and returns the number of neighbors done.
+ * 
+ * @param P_AX  - The x-coordinate of the position of A
+ * @param P_AY  - The y-coordinate of the position of A
+ * @param V_AX  - The x-coordinate of the velocity of A
+ * @param V_AY  - The y-coordinate of the velocity of A
+ * @param R_A   - The radius of A
+ * @param B     - The neighbors of A
+ * @param COUNT - The number of neighbors
+ * @param TAU   - The value of tau to be used when
+ *                computing ORCA_A|B^TAU
+ * @param out   - The arrays receiving the half-planes
+ */
+size_t OrcaKernel::computeAvx2(const double P_AX, const double P_AY, const double V_AX,
+    const double V_AY, const double R_A, const Neighbors<double>& B, const size_t COUNT,
+    const double TAU, const HalfPlanes<double>& out)
+{
+    size_t done = COUNT - COUNT % Avx2Pack::WIDTH;
+    OrcaKernel::computeRange<Avx2Pack>(P_AX, P_AY, V_AX, V_AY, R_A, B, 0, done, TAU, out);
+    return done;
+}
+
+#endif // ORCA_KERNEL_AVX2
+
+#if defined(__clang__)
+    #pragma clang attribute pop
+#elif defined(__GNUC__)
+    #pragma GCC pop_options
+#endif
@@ -0,0 +1,144 @@
+/**
+ * File  : orcaKernelNeon.cpp
+ * Author: Raja Soufi
+ * 
+ * NEON version of the kernel defined in orcaKernel.h,
+ * running two double or four float neighbors at a
+ * time. NEON is part of
+ * every 64-bit ARM CPU, so no detection is needed.
+ */
+
+// Include header file
+#include "orcaKernel.h"
+
+#ifdef ORCA_KERNEL_NEON
+
+#include <arm_neon.h>
+
+/*
+    Packs
+*/
+
+namespace {
+
+/**
+ * A pack of two doubles held in a NEON register.
+ */
+struct NeonPack {
+    
+    typedef float64x2_t Value;
+    typedef uint64x2_t Mask;
+    
+    static const size_t WIDTH = 2;
+    
+    static inline Value set(const double X) { return vdupq_n_f64(X); }
+    static inline Value load(const double* P) { return vld1q_f64(P); }
+    static inline void store(double* p, const Value A) { vst1q_f64(p, A); }
+    
+    static inline Value add(const Value A, const Value B) { return vaddq_f64(A, B); }
+    static inline Value sub(const Value A, const Value B) { return vsubq_f64(A, B); }
+    static inline Value mul(const Value A, const Value B) { return vmulq_f64(A, B); }
+    static inline Value div(const Value A, const Value B) { return vdivq_f64(A, B); }
+    static inline Value sqrt(const Value A) { return vsqrtq_f64(A); }
+    static inline Value abs(const Value A) { return vabsq_f64(A); }
+    static inline Value max(const Value A, const Value B) { return vbslq_f64(vcgtq_f64(A, B), A, B); }
+    
+    static inline Mask lessEqual(const Value A, const Value B) { return vcleq_f64(A, B); }
+    static inline Mask greater(const Value A, const Value B) { return vcgtq_f64(A, B); }
+    static inline Mask equal(const Value A, const Value B) { return vceqq_f64(A, B); }
+    static inline Mask bitAnd(const Mask A, const Mask B) { return vandq_u64(A, B); }
+    static inline Mask andNot(const Mask A, const Mask B) { return vbicq_u64(A, B); }
+    
+    static inline Value select(const Mask M, const Value A, const Value B) { return vbslq_f64(M, A, B); }
+    
+};
+
+/**
+ * A pack of four floats held in a NEON register.
+ */
+struct NeonFloatPack {
+    
+    typedef float32x4_t Value;
+    typedef uint32x4_t Mask;
+    
+    static const size_t WIDTH = 4;
+    
+    static inline Value set(const float X) { return vdupq_n_f32(X); }
+    static inline Value load(const float* P) { return vld1q_f32(P); }
+    static inline void store(float* p, const Value A) { vst1q_f32(p, A); }
+    
+    static inline Value add(const Value A, const Value B) { return vaddq_f32(A, B); }
+    static inline Value sub(const Value A, const Value B) { return vsubq_f32(A, B); }
+    static inline Value mul(const Value A, const Value B) { return vmulq_f32(A, B); }
+    static inline Value div(const Value A, const Value B) { return vdivq_f32(A, B); }
+    static inline Value sqrt(const Value A) { return vsqrtq_f32(A); }
+    static inline Value abs(const Value A) { return vabsq_f32(A); }
+    static inline Value max(const Value A, const Value B) { return vbslq_f32(vcgtq_f32(A, B), A, B); }
+    
+    static inline Mask lessEqual(const Value A, const Value B) { return vcleq_f32(A, B); }
+    static inline Mask greater(const Value A, const Value B) { return vcgtq_f32(A, B); }
+    static inline Mask equal(const Value A, const Value B) { return vceqq_f32(A, B); }
+    static inline Mask bitAnd(const Mask A, const Mask B) { return vandq_u32(A, B); }
+    static inline Mask andNot(const Mask A, const Mask B) { return vbicq_u32(A, B); }
+    
+    static inline Value select(const Mask M, const Value A, const Value B) { return vbslq_f32(M, A, B); }
+    
+};
+
+}
+
+/*
+    Helpers
+*/
+
+/**
+ * Computes ORCA_A|B^TAU for as many of the COUNT
+ * neighbors B as fill whole registers, four at a
+ * time, and returns the number of neighbors done.
+ * 
+ * @param P_AX  - The x-coordinate of the position of A
+ * @param P_AY  - The y-coordinate of the position of A
+ * @param V_AX  - The x-coordinate of the velocity of A
+ * @param V_AY  - The y-coordinate of the velocity of A
+ * @param R_A   - The radius of A
+ * @param B     - The neighbors of A
+ * @param COUNT - The number of neighbors
+ * @param TAU   - The value of tau to be used when
+ *                computing ORCA_A|B^TAU
+ * @param out   - The arrays receiving the half-planes
+ */
+size_t OrcaKernel::computeNeon(const float P_AX, const float P_AY, const float V_AX,
+    const float V_AY, const float R_A, const Neighbors<float>& B, const size_t COUNT,
+    const float TAU, const HalfPlanes<float>& out)
+{
+    size_t done = COUNT - COUNT % NeonFloatPack::WIDTH;
+    OrcaKernel::computeRange<NeonFloatPack>(P_AX, P_AY, V_AX, V_AY, R_A, B, 0, done, TAU, out);
+    return done;
+}
+
+/**
+ * Computes ORCA_A|B^TAU for as many of the COUNT
+ * neighbors B as fill whole registers, two at a
+ * time, and returns the number of neighbors done.
+ * 
+ * @param P_AX  - The x-coordinate of the position of A
+ * @param P_AY  - The y-coordinate of the position of A
+ * @param V_AX  - The x-coordinate of the velocity of A
+ * @param V_AY  - The y-coordinate of the velocity of A
+ * @param R_A   - The radius of A
+ * @param B     - The neighbors of A
+ * @param COUNT - The number of neighbors
+ * @param TAU   - The value of tau to be used when
+ *                computing ORCA_A|B^TAU
+ * @param out   - The arrays receiving the half-planes
+ */
+size_t OrcaKernel::computeNeon(const double P_AX, const double P_AY, const double V_AX,
+    const double V_AY, const double R_A, const Neighbors<double>& B, const size_t COUNT,
+    const double TAU, const HalfPlanes<double>& out)
+{
+    size_t done = COUNT - COUNT % NeonPack::WIDTH;
+    OrcaKernel::computeRange<NeonPack>(P_AX, P_AY, V_AX, V_AY, R_A, B, 0, done, TAU, out);
+    return done;
+}
+
+#endif // ORCA_KERNEL_NEON
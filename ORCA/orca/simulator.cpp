@@ -0,0 +1,539 @@
+/**
+ * File  : simulator.cpp
+ * Author: Raja Soufi
+ * 
+ * Implementation of the Simulator class defined
+ * in simulator.h.
+ */
+
+// Include header file
+#include "simulator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <thread>
+
+#include "agent.h"
+#include "obstacle.h"
+
+/*
+    Constructors
+*/
+
+/**
+ * Constructs an empty simulation, running on the
+ * calling thread only.
+ */
+template <typename T>
+BasicSimulator<T>::BasicSimulator(void) :
+    agents_(),
+    tau_(0),
+    deltaT_(0),
+    arrivalThreshold_(0),
+    skew_(0),
+    neighborSearch_(BasicSimulator::KD_TREE),
+    warmStart_(true),
+    spatialHash_(),
+    kdTree_(),
+    obstacleTree_(),
+    obstacleTau_(0),
+    threadPool_(),
+    context_(),
+    statistics_(),
+    diagnosedSlots_(),
+    diagnostics_(),
+    sleeping_(false),
+    active_(),
+    asleep_(),
+    arrived_(),
+    arrivedCount_(0),
+    agentsEdited_(false)
+{}
+
+/**
+ * Constructs a simulation of the agents given as a
+ * parameter, running on the calling thread only.
+ * 
+ * @param AGENTS            - The agents of the simulation
+ * @param TAU               - The value of tau to use for the
+ *                            ORCA system
+ * @param DELTA_T           - The duration of an iteration
+ * @param ARRIVAL_THRESHOLD - The arrival threshold to be used
+ */
+template <typename T>
+BasicSimulator<T>::BasicSimulator(const std::vector<Agent>& AGENTS, const double TAU,
+    const double DELTA_T, const double ARRIVAL_THRESHOLD) :
+    BasicSimulator()
+{
+    this->initialize(AGENTS, TAU, DELTA_T, ARRIVAL_THRESHOLD);
+}
+
+/*
+    Setters
+*/
+
+/**
+ * Sets the number of threads used to run the loops
+ * of an iteration, the calling thread included.
+ * A value of 1 runs everything on the calling thread,
+ * while a value of 0 uses all available cores.
+ * 
+ * @param THREAD_COUNT - The number of threads to use
+ */
+template <typename T>
+void BasicSimulator<T>::setThreadCount(const size_t THREAD_COUNT) {
+    
+    size_t threadCount = (THREAD_COUNT == 0) ?
+        std::max(std::thread::hardware_concurrency(), 1u) : THREAD_COUNT;
+        
+    if (threadCount == this->threadCount()) {
+        return;
+    }
+    
+    this->threadPool_.reset((threadCount > 1) ? new ThreadPool(threadCount) : NULL);
+    
+}
+
+/**
+ * Sets the static obstacles of this simulation,
+ * replacing the previous ones. Their edges are stored
+ * in a tree built once here, so that each agent only
+ * considers the edges it could reach within TAU.
+ * 
+ * @param OBSTACLES - The obstacles of the simulation
+ * @param TAU       - The value of tau to use for the
+ *                    obstacles, usually larger than
+ *                    the one used between agents
+ */
+template <typename T>
+void BasicSimulator<T>::setObstacles(const std::vector<Obstacle>& OBSTACLES, const double TAU) {
+    this->obstacleTree_.build(OBSTACLES);
+    this->obstacleTau_ = static_cast<T>(TAU);
+}
+
+/**
+ * Selects the agents whose half-planes and linear
+ * program solution are recorded at each iteration,
+ * by index. Indices past the last agent are ignored,
+ * and an empty list turns the diagnostics off.
+ * 
+ * @param INDICES - The indices of the agents to diagnose
+ */
+template <typename T>
+void BasicSimulator<T>::setDiagnosed(const std::vector<size_t>& INDICES) {
+    
+    this->diagnosedSlots_.clear();
+    this->diagnostics_.clear();
+    
+    for (const size_t INDEX : INDICES) {
+        
+        if (INDEX >= this->agents_.size()) {
+            continue;
+        }
+        
+        if (this->diagnosedSlots_.empty()) {
+            this->diagnosedSlots_.assign(this->agents_.size(), -1);
+        }
+        
+        if (this->diagnosedSlots_[INDEX] < 0) {
+            this->diagnosedSlots_[INDEX] = this->diagnostics_.size();
+            this->diagnostics_.push_back(BasicAgentDiagnostics<T>());
+            this->diagnostics_.back().index = INDEX;
+            this->diagnostics_.back().id = this->agents_.id(INDEX);
+            this->diagnostics_.back().obstacleCount = 0;
+            this->diagnostics_.back().infeasible = false;
+            this->diagnostics_.back().stale = true;
+        }
+        
+    }
+    
+}
+
+/**
+ * Sets whether agents which have arrived and stand
+ * still among still neighbors fall asleep, leaving
+ * the linear programs to the active agents, which is
+ * off by default. Turning it off wakes every agent
+ * up.
+ * 
+ * @param SLEEPING - Whether agents may fall asleep
+ */
+template <typename T>
+void BasicSimulator<T>::setSleeping(const bool SLEEPING) {
+    
+    this->sleeping_ = SLEEPING;
+    
+    if (!SLEEPING && (this->active_.size() != this->agents_.size())) {
+        this->resetActive();
+    }
+    
+}
+
+/*
+    Other methods
+*/
+
+/**
+ * Initializes this simulation with a set of agents, a
+ * value of tau, and an arrival threshold given as
+ * parameters.
+ * 
+ * @param AGENTS            - The agents of the simulation
+ * @param TAU               - The value of tau to use for the
+ *                            ORCA system
+ * @param DELTA_T           - The duration of an iteration
+ * @param ARRIVAL_THRESHOLD - The arrival threshold to be used
+ */
+template <typename T>
+void BasicSimulator<T>::initialize(const std::vector<Agent>& AGENTS, const double TAU,
+    const double DELTA_T, const double ARRIVAL_THRESHOLD)
+{
+    this->agents_ = BasicAgentStore<T>(AGENTS);
+    this->diagnosedSlots_.clear();
+    this->diagnostics_.clear();
+    this->tau_ = static_cast<T>(TAU);
+    this->deltaT_ = static_cast<T>(DELTA_T);
+    this->arrivalThreshold_ = static_cast<T>(ARRIVAL_THRESHOLD);
+    this->resetActive();
+}
+
+/**
+ * Executes a single iteration of ORCA.
+ * The velocities of the active agents are computed
+ * in parallel, each agent only reading the shared
+ * state and writing its own new velocity. Sleeping
+ * agents keep still, but are still found as
+ * neighbors by the active ones. All
+ * temporary lists live in the step context, so
+ * that once it has warmed up, an iteration does
+ * not allocate any memory.
+ */
+template <typename T>
+void BasicSimulator<T>::iteration(void) {
+    
+    if (this->agentsEdited_) {
+        this->resetActive();
+    }
+    
+    this->context_.prepare(this->agents_.size(), this->threadCount());
+    std::vector<BasicVector<T> >& newVelocities = this->context_.velocities();
+    
+    StepStatistics::Clock::time_point lap = StepStatistics::start();
+    
+    // Rebuild the spatial hash with cells large enough for
+    // every agent's neighbors to lie in adjacent cells
+    if (this->neighborSearch_ == BasicSimulator::SPATIAL_HASH) {
+        T cellSize = 0;
+        for (size_t i = 0 ; i < this->agents_.size() ; i++) {
+            cellSize = std::max(cellSize, this->agents_.neighborDist(i));
+        }
+        this->spatialHash_.build(this->agents_, cellSize);
+    }
+    // Or rebuild the k-d tree
+    else if (this->neighborSearch_ == BasicSimulator::KD_TREE) {
+        this->kdTree_.build(this->agents_);
+    }
+    
+    this->statistics_.lap(StepStatistics::NEIGHBOR_SEARCH, lap);
+    
+    // Compute ORCA's and new velocities, timing the
+    // phases of each agent on its own thread
+    auto computeVelocities = [this, &newVelocities](size_t begin, size_t end, size_t thread) {
+        
+        typename BasicStepContext<T>::Workspace& workspace = this->context_.workspace(thread);
+        StepStatistics& statistics = workspace.statistics;
+        
+        for (size_t k = begin ; k < end ; k++) {
+            
+            const size_t I = this->active_[k];
+            StepStatistics::Clock::time_point since = StepStatistics::start();
+            
+            this->agents_.orca_A_O(I, this->obstacleTree_, this->obstacleTau_, workspace);
+            statistics.lap(StepStatistics::HALF_PLANES, since);
+            
+            if (this->neighborSearch_ == BasicSimulator::KD_TREE) {
+                this->agents_.findNeighbors(I, this->kdTree_, workspace);
+            } else if (this->neighborSearch_ == BasicSimulator::SPATIAL_HASH) {
+                this->agents_.findNeighbors(I, this->spatialHash_, workspace);
+            } else {
+                this->agents_.findNeighbors(I, workspace);
+            }
+            statistics.lap(StepStatistics::NEIGHBOR_SEARCH, since);
+            
+            // Put the agent to sleep if it rests and none of
+            // its neighbors moves, or wake its sleeping
+            // neighbors up if it does not rest
+            if (this->sleeping_ && this->resting(I)) {
+                
+                const T THRESHOLD_SQ = this->arrivalThreshold_ * this->arrivalThreshold_;
+                bool still = true;
+                for (const std::pair<T, int>& NEIGHBOR : workspace.neighbors) {
+                    BasicVector<T> velocity = this->agents_.velocity(NEIGHBOR.second);
+                    if (velocity * velocity > THRESHOLD_SQ) {
+                        still = false;
+                        break;
+                    }
+                }
+                
+                if (still) {
+                    newVelocities[I] = BasicVector<T>();
+                    workspace.fallenAsleep.push_back(I);
+                    if (!this->diagnosedSlots_.empty() && (this->diagnosedSlots_[I] >= 0)) {
+                        this->diagnostics_[this->diagnosedSlots_[I]].stale = true;
+                    }
+                    continue;
+                }
+                
+            } else if (this->sleeping_) {
+                for (const std::pair<T, int>& NEIGHBOR : workspace.neighbors) {
+                    if (this->asleep_[NEIGHBOR.second]) {
+                        workspace.woken.push_back(NEIGHBOR.second);
+                    }
+                }
+            }
+            
+            this->agents_.computeHalfPlanes(I, this->tau_, workspace);
+            statistics.lap(StepStatistics::HALF_PLANES, since);
+            
+            newVelocities[I] = this->agents_.solveLinearProgram(I, this->warmStart_, workspace);
+            statistics.lap(StepStatistics::LINEAR_PROGRAMS, since);
+            
+            if (!this->diagnosedSlots_.empty() && (this->diagnosedSlots_[I] >= 0)) {
+                this->diagnose(I, newVelocities[I], workspace);
+            }
+            
+        }
+    };
+    this->parallelFor(this->active_.size(), computeVelocities);
+    
+    // Gather the statistics of the threads, spreading
+    // the wall time of the loop between the phases
+    if (StepStatistics::enabled()) {
+        StepStatistics loop;
+        for (size_t t = 0 ; t < this->threadCount() ; t++) {
+            loop.merge(this->context_.workspace(t).statistics);
+            this->context_.workspace(t).statistics.clear();
+        }
+        StepStatistics::Clock::time_point now = StepStatistics::start();
+        loop.spread(std::chrono::duration<double>(now - lap).count());
+        this->statistics_.merge(loop);
+        lap = now;
+    }
+    
+    // Update velocities
+    auto updateVelocities = [this, &newVelocities](size_t begin, size_t end, size_t) {
+        for (size_t k = begin ; k < end ; k++) {
+            
+            const size_t I = this->active_[k];
+            this->agents_.updateVelocity(I, newVelocities[I]);
+            
+        }
+    };
+    this->parallelFor(this->active_.size(), updateVelocities);
+    
+    // Let the agents which fell asleep or were woken
+    // up leave or join the active set
+    this->updateActive();
+    
+    this->statistics_.lap(StepStatistics::VELOCITY_UPDATE, lap);
+    this->statistics_.iterations++;
+}
+
+/**
+ * Moves the active agents for DELTA_T time, keeping
+ * count of the agents which have arrived, sleeping
+ * agents standing still.
+ * 
+ * @param DELTA_T - The time during which to move
+ *                  the agents
+ */
+template <typename T>
+void BasicSimulator<T>::moveAgents(const T DELTA_T) {
+    
+    if (this->agentsEdited_) {
+        this->resetActive();
+    }
+    
+    StepStatistics::Clock::time_point lap = StepStatistics::start();
+    std::atomic<long> arrivals(0);
+    
+    // Move agents, each run of consecutive active agents
+    // at once, then see which of them arrived or left
+    auto move = [this, DELTA_T, &arrivals](size_t begin, size_t end, size_t) {
+        
+        long count = 0;
+        
+        for (size_t k = begin ; k < end ; ) {
+            
+            const size_t FIRST = this->active_[k];
+            size_t last = FIRST + 1;
+            for (k++ ; (k < end) && (this->active_[k] == last) ; k++) {
+                last++;
+            }
+            
+            this->agents_.move(FIRST, last, DELTA_T, this->skew_);
+            
+            for (size_t i = FIRST ; i < last ; i++) {
+                char arrived = this->agents_.arrived(i, this->arrivalThreshold_);
+                if (arrived != this->arrived_[i]) {
+                    this->arrived_[i] = arrived;
+                    count += arrived ? 1 : -1;
+                }
+            }
+            
+        }
+        
+        arrivals.fetch_add(count, std::memory_order_relaxed);
+        
+    };
+    this->parallelFor(this->active_.size(), move);
+    
+    this->arrivedCount_ += arrivals.load();
+    
+    this->statistics_.lap(StepStatistics::MOVE, lap);
+    
+}
+
+/**
+ * Tests whether this simulation has converged, in
+ * the sense of that all agents are within the
+ * arrival threshold from their respective
+ * destinations. The agents which have arrived are
+ * counted as they move, so this takes constant time.
+ */
+template <typename T>
+bool BasicSimulator<T>::converged(void) {
+    
+    if (this->agentsEdited_) {
+        this->resetActive();
+    }
+    
+    StepStatistics::Clock::time_point lap = StepStatistics::start();
+    
+    // If all agents have arrived,
+    // then return true
+    bool allArrived = (this->arrivedCount_ == this->agents_.size());
+    
+    this->statistics_.lap(StepStatistics::CONVERGENCE_CHECK, lap);
+    
+    return allArrived;
+}
+
+/**
+ * Runs finalization code that is executed when
+ * this simulation converges and is about to
+ * terminate. Any cleaning up that should be done
+ * before terminating goes here.
+ */
+template <typename T>
+void BasicSimulator<T>::finalize(void) {}
+
+/*
+    Helpers
+*/
+
+/**
+ * Records the half-planes and linear program
+ * solution of the I-th agent, found in the workspace
+ * given as a parameter, into its diagnostics. Only
+ * the thread working on the agent writes them.
+ * 
+ * @param I         - The index of the agent
+ * @param SOLUTION  - The solution of its linear program
+ * @param WORKSPACE - The workspace it was solved in
+ */
+template <typename T>
+void BasicSimulator<T>::diagnose(const size_t I, const BasicVector<T>& SOLUTION,
+    const typename BasicStepContext<T>::Workspace& WORKSPACE)
+{
+    BasicAgentDiagnostics<T>& diagnostics = this->diagnostics_[this->diagnosedSlots_[I]];
+    
+    diagnostics.position = this->agents_.position(I);
+    diagnostics.velocity = this->agents_.velocity(I);
+    diagnostics.halfPlanes.assign(WORKSPACE.halfPlanes.begin(), WORKSPACE.halfPlanes.end());
+    diagnostics.obstacleCount = WORKSPACE.obstacleCount;
+    diagnostics.neighbors.resize(WORKSPACE.neighbors.size());
+    for (size_t k = 0 ; k < WORKSPACE.neighbors.size() ; k++) {
+        diagnostics.neighbors[k] = WORKSPACE.neighbors[k].second;
+    }
+    diagnostics.solution = BasicPoint<T>(SOLUTION);
+    diagnostics.infeasible = WORKSPACE.infeasible;
+    diagnostics.stale = false;
+}
+
+/**
+ * Moves the agents which fell asleep during the last
+ * loop out of the active set, and those which were
+ * woken up into it, as listed in the workspaces of
+ * the threads, keeping the active set sorted so that
+ * the agents are visited in memory order.
+ */
+template <typename T>
+void BasicSimulator<T>::updateActive(void) {
+    
+    bool fellAsleep = false, woke = false;
+    
+    for (size_t t = 0 ; t < this->threadCount() ; t++) {
+        std::vector<int>& fallenAsleep = this->context_.workspace(t).fallenAsleep;
+        for (const int I : fallenAsleep) {
+            this->asleep_[I] = 1;
+        }
+        fellAsleep = fellAsleep || !fallenAsleep.empty();
+        fallenAsleep.clear();
+    }
+    
+    if (fellAsleep) {
+        this->active_.erase(std::remove_if(this->active_.begin(), this->active_.end(),
+            [this](const size_t I) { return this->asleep_[I] != 0; }), this->active_.end());
+    }
+    
+    // An agent may be woken up by several neighbors
+    for (size_t t = 0 ; t < this->threadCount() ; t++) {
+        std::vector<int>& woken = this->context_.workspace(t).woken;
+        for (const int I : woken) {
+            if (this->asleep_[I]) {
+                this->asleep_[I] = 0;
+                this->active_.push_back(I);
+                woke = true;
+            }
+        }
+        woken.clear();
+    }
+    
+    if (woke) {
+        std::sort(this->active_.begin(), this->active_.end());
+    }
+    
+}
+
+/**
+ * Wakes every agent up and counts the agents which
+ * have arrived, as when the agents are replaced or
+ * may have been edited.
+ */
+template <typename T>
+void BasicSimulator<T>::resetActive(void) {
+    
+    this->active_.resize(this->agents_.size());
+    std::iota(this->active_.begin(), this->active_.end(), 0);
+    this->asleep_.assign(this->agents_.size(), 0);
+    
+    this->arrived_.resize(this->agents_.size());
+    this->arrivedCount_ = 0;
+    for (size_t i = 0 ; i < this->agents_.size() ; i++) {
+        this->arrived_[i] = this->agents_.arrived(i, this->arrivalThreshold_);
+        this->arrivedCount_ += this->arrived_[i];
+    }
+    
+    this->agentsEdited_ = false;
+    
+}
+
+/*
+    Explicit instantiations
+*/
+
+template class BasicSimulator<float>;
+template class BasicSimulator<double>;
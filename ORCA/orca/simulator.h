@@ -0,0 +1,448 @@
+/**
+ * File  : simulator.h
+ * Author: Raja Soufi
+ * 
+ * Class definition of a simulation of the ORCA
+ * system.
+ * 
+ * Each simulator owns its agents, its parameters,
+ * its neighbor search structures, its thread pool
+ * and the memory reused between iterations, so
+ * that independent simulations can run side by
+ * side, each on its own thread. The algorithms
+ * shared by all simulations are the static
+ * functions of the ORCA class.
+ * 
+ * A simulator runs in the scalar type T, either float
+ * or double, its agents being converted to T when it
+ * is initialized. Simulator is the double precision
+ * version.
+ * 
+ * When built with STEP_STATISTICS defined, a
+ * simulator times the phases of its steps and counts
+ * the work done by its linear programs, from the
+ * last call to resetStatistics on.
+ * 
+ * Agents selected with setDiagnosed have the
+ * half-planes and solution of their linear program
+ * recorded at each iteration, replacing those of
+ * the previous one.
+ * 
+ * Once setSleeping turns it on, an agent which has
+ * arrived and stands still while none of its
+ * neighbors moves falls asleep: it leaves the set of
+ * active agents, for which alone the iterations
+ * solve linear programs and which alone move, while
+ * staying a neighbor of the others. It wakes up as
+ * soon as an agent which does not rest finds it
+ * among its neighbors. Either way, the number of
+ * agents which have arrived is kept up to date as
+ * they move, so that testing for convergence takes
+ * constant time. Editing the agents through agents
+ * wakes every agent up and counts them again at the
+ * next step.
+ */
+
+// Include guard
+#ifndef _SIMULATOR_H_
+#define _SIMULATOR_H_
+
+// Inclusions
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "../utilities/threadPool.h"
+
+#include "agentDiagnostics.h"
+#include "agentStore.h"
+#include "kdTree.h"
+#include "obstacleTree.h"
+#include "spatialHash.h"
+#include "stepContext.h"
+#include "stepStatistics.h"
+
+// Forward-declarations
+class Agent;
+class Obstacle;
+
+// Class definition
+template <typename T>
+class BasicSimulator {
+    
+    public:
+    
+    // Strategies used to find the neighbors of each agent
+    enum NeighborSearch {
+        BRUTE_FORCE,
+        SPATIAL_HASH,
+        KD_TREE
+    };
+    
+    private:
+    
+    // Attributes
+    BasicAgentStore<T> agents_;
+    T tau_;
+    T deltaT_;
+    T arrivalThreshold_;
+    T skew_;
+    
+    NeighborSearch neighborSearch_;
+    bool warmStart_;
+    BasicSpatialHash<T> spatialHash_;
+    BasicKdTree<T> kdTree_;
+    
+    BasicObstacleTree<T> obstacleTree_;
+    T obstacleTau_;
+    
+    std::unique_ptr<ThreadPool> threadPool_;
+    BasicStepContext<T> context_;
+    StepStatistics statistics_;
+    
+    std::vector<int> diagnosedSlots_;
+    std::vector<BasicAgentDiagnostics<T> > diagnostics_;
+    
+    bool sleeping_;
+    std::vector<size_t> active_;
+    std::vector<char> asleep_;
+    std::vector<char> arrived_;
+    size_t arrivedCount_;
+    bool agentsEdited_;
+    
+    // Helpers
+    template <typename Body>
+    void parallelFor(const size_t COUNT, Body& body);
+    void diagnose(const size_t I, const BasicVector<T>& SOLUTION,
+        const typename BasicStepContext<T>::Workspace& WORKSPACE);
+    inline bool resting(const size_t I) const;
+    void updateActive(void);
+    void resetActive(void);
+    
+    // Non-copyable
+    BasicSimulator(const BasicSimulator& THAT);
+    BasicSimulator& operator=(const BasicSimulator& THAT);
+    
+    public:
+    
+    // Constructors
+    BasicSimulator(void);
+    BasicSimulator(const std::vector<Agent>& AGENTS, const double TAU,
+        const double DELTA_T, const double ARRIVAL_THRESHOLD);
+        
+    // Getters
+    inline BasicAgentStore<T>& agents(void);
+    inline const BasicAgentStore<T>& agents(void) const;
+    inline T tau(void) const;
+    inline T deltaT(void) const;
+    inline T arrivalThreshold(void) const;
+    inline T skew(void) const;
+    inline NeighborSearch neighborSearch(void) const;
+    inline bool warmStart(void) const;
+    inline size_t threadCount(void) const;
+    inline const BasicObstacleTree<T>& obstacles(void) const;
+    inline T obstacleTau(void) const;
+    inline const StepStatistics& statistics(void) const;
+    inline const std::vector<BasicAgentDiagnostics<T> >& diagnostics(void) const;
+    inline bool sleeping(void) const;
+    inline bool asleep(const size_t I) const;
+    inline size_t activeCount(void) const;
+    
+    // Setters
+    inline void setNeighborSearch(const NeighborSearch NEIGHBOR_SEARCH);
+    inline void setWarmStart(const bool WARM_START);
+    inline void setSkew(const double SKEW);
+    void setThreadCount(const size_t THREAD_COUNT);
+    void setObstacles(const std::vector<Obstacle>& OBSTACLES, const double TAU);
+    void setDiagnosed(const std::vector<size_t>& INDICES);
+    void setSleeping(const bool SLEEPING);
+    
+    // Other methods
+    inline int agentCount(void) const;
+    
+    void initialize(const std::vector<Agent>& AGENTS, const double TAU,
+        const double DELTA_T, const double ARRIVAL_THRESHOLD);
+        
+    void iteration(void);
+    void moveAgents(const T DELTA_T);
+    bool converged(void);
+    void finalize(void);
+    
+    inline void resetStatistics(void);
+    
+};
+
+/*
+    Getters
+*/
+
+/**
+ * Returns the set of agents of this simulation, for
+ * editing. As the edits cannot be seen, the next step
+ * wakes every agent up and counts again those which
+ * have arrived; read the agents through a constant
+ * simulation to avoid it.
+ */
+template <typename T>
+inline BasicAgentStore<T>& BasicSimulator<T>::agents(void) {
+    this->agentsEdited_ = true;
+    return this->agents_;
+}
+
+/**
+ * Returns the set of agents of this simulation.
+ */
+template <typename T>
+inline const BasicAgentStore<T>& BasicSimulator<T>::agents(void) const {
+    return this->agents_;
+}
+
+/**
+ * Returns the value of tau used by this simulation.
+ */
+template <typename T>
+inline T BasicSimulator<T>::tau(void) const {
+    return this->tau_;
+}
+
+/**
+ * Returns the value of deltaT used by this simulation.
+ */
+template <typename T>
+inline T BasicSimulator<T>::deltaT(void) const {
+    return this->deltaT_;
+}
+
+/**
+ * Returns the maximum distance between an agent A
+ * and its destination for which A would be
+ * considered as arrived.
+ */
+template <typename T>
+inline T BasicSimulator<T>::arrivalThreshold(void) const {
+    return this->arrivalThreshold_;
+}
+
+/**
+ * Returns the maximum slope of the rotation applied
+ * to the preferred velocities of the agents as they
+ * move, 0 by default.
+ */
+template <typename T>
+inline T BasicSimulator<T>::skew(void) const {
+    return this->skew_;
+}
+
+/**
+ * Returns the strategy used to find the neighbors
+ * of each agent during an iteration.
+ */
+template <typename T>
+inline typename BasicSimulator<T>::NeighborSearch BasicSimulator<T>::neighborSearch(void) const {
+    return this->neighborSearch_;
+}
+
+/**
+ * Tests whether the linear program of each agent
+ * first tries the half-planes that bounded its
+ * previous solution.
+ */
+template <typename T>
+inline bool BasicSimulator<T>::warmStart(void) const {
+    return this->warmStart_;
+}
+
+/**
+ * Returns the number of threads used to run the
+ * loops of an iteration.
+ */
+template <typename T>
+inline size_t BasicSimulator<T>::threadCount(void) const {
+    return this->threadPool_ ? this->threadPool_->threadCount() : 1;
+}
+
+/**
+ * Returns the tree holding the edges of the static
+ * obstacles of this simulation.
+ */
+template <typename T>
+inline const BasicObstacleTree<T>& BasicSimulator<T>::obstacles(void) const {
+    return this->obstacleTree_;
+}
+
+/**
+ * Returns the value of tau used for the static
+ * obstacles of this simulation.
+ */
+template <typename T>
+inline T BasicSimulator<T>::obstacleTau(void) const {
+    return this->obstacleTau_;
+}
+
+/**
+ * Returns the statistics gathered since the last
+ * call to resetStatistics, which stay at 0 unless
+ * the program is built with STEP_STATISTICS defined.
+ */
+template <typename T>
+inline const StepStatistics& BasicSimulator<T>::statistics(void) const {
+    return this->statistics_;
+}
+
+/**
+ * Returns the diagnostics of the agents selected
+ * with setDiagnosed, in the order they were given,
+ * as recorded by the last iteration. The records of
+ * the agents asleep during it are marked as stale.
+ */
+template <typename T>
+inline const std::vector<BasicAgentDiagnostics<T> >& BasicSimulator<T>::diagnostics(void) const {
+    return this->diagnostics_;
+}
+
+/**
+ * Tests whether agents which have arrived and stand
+ * still among still neighbors fall asleep.
+ */
+template <typename T>
+inline bool BasicSimulator<T>::sleeping(void) const {
+    return this->sleeping_;
+}
+
+/**
+ * Tests whether the I-th agent is asleep, in which
+ * case the iterations neither solve its linear
+ * program nor move it.
+ * 
+ * @param I - The index of the agent
+ */
+template <typename T>
+inline bool BasicSimulator<T>::asleep(const size_t I) const {
+    return this->asleep_[I] != 0;
+}
+
+/**
+ * Returns the number of agents which are awake, for
+ * which the next iteration solves linear programs.
+ */
+template <typename T>
+inline size_t BasicSimulator<T>::activeCount(void) const {
+    return this->active_.size();
+}
+
+/*
+    Setters
+*/
+
+/**
+ * Sets the strategy used to find the neighbors of
+ * each agent during an iteration. All strategies
+ * yield the same half-planes, the brute-force one
+ * being kept for comparison purposes.
+ * 
+ * @param NEIGHBOR_SEARCH - The strategy to use
+ */
+template <typename T>
+inline void BasicSimulator<T>::setNeighborSearch(const NeighborSearch NEIGHBOR_SEARCH) {
+    this->neighborSearch_ = NEIGHBOR_SEARCH;
+}
+
+/**
+ * Sets whether the linear program of each agent
+ * first tries the half-planes that bounded its
+ * previous solution. This only changes the order in
+ * which the half-planes are considered, which makes
+ * the linear programs faster once the agents move
+ * steadily, not their solutions.
+ * 
+ * @param WARM_START - Whether to warm start the linear
+ *                     programs
+ */
+template <typename T>
+inline void BasicSimulator<T>::setWarmStart(const bool WARM_START) {
+    this->warmStart_ = WARM_START;
+}
+
+/**
+ * Sets the maximum slope of the rotation applied to
+ * the preferred velocities of the agents as they
+ * move. Each agent is rotated by its own tiny angle,
+ * keyed on its index, which breaks the symmetry of
+ * configurations where the agents would otherwise
+ * block each other forever, at the cost of pointing
+ * them slightly off their destinations. A value of
+ * 0, the default, leaves them pointed at their
+ * destinations.
+ * 
+ * @param SKEW - The maximum slope of the rotation
+ */
+template <typename T>
+inline void BasicSimulator<T>::setSkew(const double SKEW) {
+    this->skew_ = static_cast<T>(SKEW);
+}
+
+/*
+    Other methods
+*/
+
+/**
+ * Returns the number of agents of this simulation.
+ */
+template <typename T>
+inline int BasicSimulator<T>::agentCount(void) const {
+    return this->agents_.size();
+}
+
+/**
+ * Resets the statistics gathered so far to 0.
+ */
+template <typename T>
+inline void BasicSimulator<T>::resetStatistics(void) {
+    this->statistics_.clear();
+}
+
+/*
+    Helpers
+*/
+
+/**
+ * Tests whether the I-th agent rests, that is
+ * whether it has arrived and its speed is at most
+ * the arrival threshold per second, so that it would
+ * take it at least a second to leave its
+ * destination.
+ * 
+ * @param I - The index of the agent
+ */
+template <typename T>
+inline bool BasicSimulator<T>::resting(const size_t I) const {
+    BasicVector<T> velocity = this->agents_.velocity(I);
+    return this->agents_.arrived(I, this->arrivalThreshold_) &&
+        (velocity * velocity <= this->arrivalThreshold_ * this->arrivalThreshold_);
+}
+
+/**
+ * Calls body(begin, end, thread) on sub-ranges
+ * covering the agents [0, COUNT), spread over the
+ * threads of the thread pool if there is one, or
+ * all at once on the calling thread, as thread 0,
+ * otherwise.
+ * 
+ * @param COUNT - The number of agents to process
+ * @param body  - The callable processing a range
+ */
+template <typename T>
+template <typename Body>
+void BasicSimulator<T>::parallelFor(const size_t COUNT, Body& body) {
+    if (this->threadPool_) {
+        this->threadPool_->parallelFor(COUNT, body);
+    } else {
+        body(0, COUNT, 0);
+    }
+}
+
+// Precisions
+typedef BasicSimulator<float> SimulatorF;
+typedef BasicSimulator<double> Simulator;
+
+#endif // _SIMULATOR_H_
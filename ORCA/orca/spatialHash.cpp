@@ -0,0 +1,135 @@
+/**
+ * File  : spatialHash.cpp
+ * Author: Raja Soufi
+ * 
+ * Implementation of the SpatialHash class defined
+ * in spatialHash.h.
+ */
+
+// Include header file
+#include "spatialHash.h"
+
+#include "agentStore.h"
+
+/*
+    Constructors
+*/
+
+/**
+ * Constructs an empty spatial hash with unit cells.
+ */
+template <typename T>
+BasicSpatialHash<T>::BasicSpatialHash(void) : cellSize_(1.0), bucketMask_(0), bucketStarts_(), entries_() {}
+
+/*
+    Other methods
+*/
+
+/**
+ * Rebuilds this spatial hash from the agents given
+ * as a parameter, using square cells with sides of
+ * the length given as a parameter. The agents are
+ * referred to by their index in AGENTS, which must
+ * remain valid as long as the hash is queried.
+ * 
+ * The agents are sorted into their buckets with a
+ * counting sort, so that a rebuild takes linear time
+ * and reuses the memory of the previous build.
+ * 
+ * @param AGENTS    - The agents to store in the hash
+ * @param CELL_SIZE - The side length of the cells
+ */
+template <typename T>
+void BasicSpatialHash<T>::build(const BasicAgentStore<T>& AGENTS, const T CELL_SIZE) {
+    
+    this->cellSize_ = (CELL_SIZE > 0.0) ? CELL_SIZE : 1.0;
+    
+    // Use at least twice as many buckets as agents, rounded
+    // up to a power of two so that hashing is a simple mask
+    size_t bucketCount = 1;
+    while (bucketCount < 2 * AGENTS.size()) {
+        bucketCount <<= 1;
+    }
+    this->bucketMask_ = bucketCount - 1;
+    
+    this->bucketStarts_.assign(bucketCount + 1, 0);
+    this->entries_.resize(AGENTS.size());
+    
+    // Count the agents falling into each bucket
+    for (size_t i = 0 ; i < AGENTS.size() ; i++) {
+        size_t b = this->bucket(this->cellCoordinate(AGENTS.positionX()[i]),
+            this->cellCoordinate(AGENTS.positionY()[i]));
+        this->bucketStarts_[b + 1]++;
+    }
+    
+    // Turn the counts into the starting offsets of the buckets
+    for (size_t b = 0 ; b < bucketCount ; b++) {
+        this->bucketStarts_[b + 1] += this->bucketStarts_[b];
+    }
+    
+    // Scatter the agents into their buckets, using the starting
+    // offsets as insertion cursors and restoring them afterwards
+    for (size_t i = 0 ; i < AGENTS.size() ; i++) {
+        Entry entry;
+        entry.index = static_cast<int>(i);
+        entry.cellX = this->cellCoordinate(AGENTS.positionX()[i]);
+        entry.cellY = this->cellCoordinate(AGENTS.positionY()[i]);
+        this->entries_[this->bucketStarts_[this->bucket(entry.cellX, entry.cellY)]++] = entry;
+    }
+    
+    for (size_t b = bucketCount ; b > 0 ; b--) {
+        this->bucketStarts_[b] = this->bucketStarts_[b - 1];
+    }
+    this->bucketStarts_[0] = 0;
+    
+}
+
+/**
+ * Appends to the list given as a parameter the
+ * indices of the agents stored in the cells that
+ * overlap the disc of center P and radius RADIUS.
+ * The returned agents are candidates only, and may
+ * lie slightly outside of the disc. Each agent is
+ * reported at most once.
+ * 
+ * @param P       - The center of the query disc
+ * @param RADIUS  - The radius of the query disc
+ * @param indices - The list to which the indices of
+ *                  the candidate agents are appended
+ */
+template <typename T>
+void BasicSpatialHash<T>::query(const BasicPoint<T>& P, const T RADIUS, std::vector<int>& indices) const {
+    
+    if (this->entries_.empty()) {
+        return;
+    }
+    
+    long long minX = this->cellCoordinate(P.x() - RADIUS);
+    long long maxX = this->cellCoordinate(P.x() + RADIUS);
+    long long minY = this->cellCoordinate(P.y() - RADIUS);
+    long long maxY = this->cellCoordinate(P.y() + RADIUS);
+    
+    for (long long cellX = minX ; cellX <= maxX ; cellX++) {
+        for (long long cellY = minY ; cellY <= maxY ; cellY++) {
+            
+            size_t b = this->bucket(cellX, cellY);
+            
+            // Different cells may share a bucket, so only keep
+            // the entries that belong to the visited cell
+            for (size_t e = this->bucketStarts_[b] ; e < this->bucketStarts_[b + 1] ; e++) {
+                if ((this->entries_[e].cellX == cellX) && (this->entries_[e].cellY == cellY)) {
+                    indices.push_back(this->entries_[e].index);
+                }
+            }
+            
+        }
+    }
+    
+}
+
+/*
+    Explicit instantiations
+*/
+
+template class BasicSpatialHash<float>;
+template class BasicSpatialHash<double>;
@@ -0,0 +1,112 @@
+/**
+ * File  : spatialHash.h
+ * Author: Raja Soufi
+ * 
+ * Class definition of a uniform-grid spatial hash
+ * used to look up the agents lying around a given
+ * position without scanning the whole system.
+ * 
+ * The plane is divided into square cells of equal
+ * size, and each cell is hashed into a fixed number
+ * of buckets. Agents are stored bucket by bucket in
+ * a single array, so that a query only visits the
+ * cells overlapping the query disc. The coordinates
+ * are of the scalar type T of the agents, float or
+ * double.
+ */
+
+// Include guard
+#ifndef _SPATIAL_HASH_H_
+#define _SPATIAL_HASH_H_
+
+// Inclusions
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "../geom/point.h"
+
+// Forward-declarations
+template <typename T> class BasicAgentStore;
+
+// Class definition
+template <typename T>
+class BasicSpatialHash {
+    
+    private:
+    
+    // Cell coordinates of an agent stored in the hash
+    struct Entry {
+        int index;
+        long long cellX, cellY;
+    };
+    
+    // Attributes
+    T cellSize_;
+    size_t bucketMask_;
+    std::vector<size_t> bucketStarts_;
+    std::vector<Entry> entries_;
+    
+    // Helpers
+    inline long long cellCoordinate(const T COORDINATE) const;
+    inline size_t bucket(const long long CELL_X, const long long CELL_Y) const;
+    
+    public:
+    
+    // Constructor
+    BasicSpatialHash(void);
+    
+    // Getters
+    inline T cellSize(void) const;
+    
+    // Other methods
+    void build(const BasicAgentStore<T>& AGENTS, const T CELL_SIZE);
+    void query(const BasicPoint<T>& P, const T RADIUS, std::vector<int>& indices) const;
+    
+};
+
+// Precisions
+typedef BasicSpatialHash<float> SpatialHashF;
+typedef BasicSpatialHash<double> SpatialHash;
+
+/*
+    Getters
+*/
+
+/**
+ * Returns the side length of the cells of this
+ * spatial hash.
+ */
+template <typename T>
+inline T BasicSpatialHash<T>::cellSize(void) const {
+    return this->cellSize_;
+}
+
+/*
+    Helpers
+*/
+
+/**
+ * Returns the index of the cell containing the
+ * coordinate given as a parameter along one axis.
+ * 
+ * @param COORDINATE - The coordinate to locate
+ */
+template <typename T>
+inline long long BasicSpatialHash<T>::cellCoordinate(const T COORDINATE) const {
+    return static_cast<long long>(floor(COORDINATE / this->cellSize_));
+}
+
+/**
+ * Returns the bucket into which the cell with the
+ * coordinates given as parameters is hashed.
+ * 
+ * @param CELL_X - The x-coordinate of the cell
+ * @param CELL_Y - The y-coordinate of the cell
+ */
+template <typename T>
+inline size_t BasicSpatialHash<T>::bucket(const long long CELL_X, const long long CELL_Y) const {
+    return static_cast<size_t>((CELL_X * 73856093LL) ^ (CELL_Y * 19349663LL)) & this->bucketMask_;
+}
+
+#endif // _SPATIAL_HASH_H_
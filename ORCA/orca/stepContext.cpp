@@ -0,0 +1,53 @@
+/**
+ * File  : stepContext.cpp
+ * Author: Raja Soufi
+ * 
+ * Implementation of the StepContext class defined
+ * in stepContext.h.
+ */
+
+// Include header file
+#include "stepContext.h"
+
+/*
+    Constructor
+*/
+
+/**
+ * Constructs a context without any workspace.
+ */
+template <typename T>
+BasicStepContext<T>::BasicStepContext(void) : workspaces_(), velocities_() {}
+
+/*
+    Other methods
+*/
+
+/**
+ * Makes room for an iteration over AGENT_COUNT agents
+ * run by THREAD_COUNT threads. Each workspace lives
+ * in its own allocation, so that threads do not write
+ * to the same cache lines. Nothing is allocated when
+ * the counts are the same as for the previous
+ * iteration.
+ * 
+ * @param AGENT_COUNT  - The number of agents
+ * @param THREAD_COUNT - The number of threads
+ */
+template <typename T>
+void BasicStepContext<T>::prepare(const size_t AGENT_COUNT, const size_t THREAD_COUNT) {
+    
+    while (this->workspaces_.size() < THREAD_COUNT) {
+        this->workspaces_.push_back(std::unique_ptr<Workspace>(new Workspace()));
+    }
+    
+    this->velocities_.resize(AGENT_COUNT);
+    
+}
+
+/*
+    Explicit instantiations
+*/
+
+template class BasicStepContext<float>;
+template class BasicStepContext<double>;
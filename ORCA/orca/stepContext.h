@@ -0,0 +1,118 @@
+/**
+ * File  : stepContext.h
+ * Author: Raja Soufi
+ * 
+ * Class definition of the memory reused from one
+ * iteration of a simulation to the next.
+ * 
+ * Each thread running an iteration gets its own
+ * workspace, holding the neighbors, half-planes and
+ * other temporary lists of the agent it is working
+ * on. The half-planes of static obstacles, if any,
+ * come first in the list of half-planes, followed by
+ * those of the neighbors, in the same order as the
+ * list of neighbors. The lists are cleared rather
+ * than freed, so once they have grown to the largest
+ * size needed, an iteration no longer allocates any
+ * memory.
+ * 
+ * The lists hold values of the scalar type T of the
+ * simulation, float or double. The workspace also
+ * tells whether the last linear program it solved
+ * was infeasible. Each workspace also
+ * gathers the statistics of the agents its thread
+ * works on, merged into those of the simulation at
+ * the end of the loop, along with the agents its
+ * thread put to sleep or woke up during the loop.
+ */
+
+// Include guard
+#ifndef _STEP_CONTEXT_H_
+#define _STEP_CONTEXT_H_
+
+// Inclusions
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "../geom/directedHalfPlane.h"
+#include "../geom/vector.h"
+
+#include "stepStatistics.h"
+
+// Class definition
+template <typename T>
+class BasicStepContext {
+    
+    public:
+    
+    // Temporary lists used by a thread for one agent
+    struct Workspace {
+        std::vector<std::pair<T, int> > neighbors;
+        std::vector<std::pair<T, int> > edges;
+        std::vector<int> candidates;
+        std::vector<T> gathered;
+        std::vector<T> lines;
+        std::vector<BasicDirectedHalfPlane<T> > halfPlanes;
+        std::vector<BasicDirectedHalfPlane<T> > bisectors;
+        size_t obstacleCount;
+        bool infeasible;
+        StepStatistics statistics;
+        std::vector<int> fallenAsleep;
+        std::vector<int> woken;
+    };
+    
+    private:
+    
+    // Attributes
+    std::vector<std::unique_ptr<Workspace> > workspaces_;
+    std::vector<BasicVector<T> > velocities_;
+    
+    // Non-copyable
+    BasicStepContext(const BasicStepContext& THAT);
+    BasicStepContext& operator=(const BasicStepContext& THAT);
+    
+    public:
+    
+    // Constructor
+    BasicStepContext(void);
+    
+    // Getters
+    inline Workspace& workspace(const size_t THREAD);
+    inline std::vector<BasicVector<T> >& velocities(void);
+    
+    // Other methods
+    void prepare(const size_t AGENT_COUNT, const size_t THREAD_COUNT);
+    
+};
+
+// Precisions
+typedef BasicStepContext<float> StepContextF;
+typedef BasicStepContext<double> StepContext;
+
+/*
+    Getters
+*/
+
+/**
+ * Returns the workspace of the thread of index
+ * THREAD in the current iteration.
+ * 
+ * @param THREAD - The index of the thread
+ */
+template <typename T>
+inline typename BasicStepContext<T>::Workspace& BasicStepContext<T>::workspace(const size_t THREAD) {
+    return *this->workspaces_[THREAD];
+}
+
+/**
+ * Returns the list of the new velocities of the
+ * agents, one per agent.
+ */
+template <typename T>
+inline std::vector<BasicVector<T> >& BasicStepContext<T>::velocities(void) {
+    return this->velocities_;
+}
+
+#endif // _STEP_CONTEXT_H_
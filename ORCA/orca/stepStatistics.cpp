@@ -0,0 +1,166 @@
+/**
+ * File  : stepStatistics.cpp
+ * Author: Raja Soufi
+ * 
+ * Implementation of the StepStatistics structure
+ * defined in stepStatistics.h.
+ */
+
+// Include header file
+#include "stepStatistics.h"
+
+#include <algorithm>
+
+/*
+    Constructor
+*/
+
+/**
+ * Constructs statistics of no step at all.
+ */
+StepStatistics::StepStatistics(void) {
+    this->clear();
+}
+
+/*
+    Getters
+*/
+
+/**
+ * Returns the name of the phase given as a
+ * parameter, as used in the CSV and JSON files.
+ * 
+ * @param PHASE - The phase to name
+ */
+const char* StepStatistics::phaseName(const Phase PHASE) {
+    switch (PHASE) {
+        case StepStatistics::NEIGHBOR_SEARCH:   return "neighbor_search";
+        case StepStatistics::HALF_PLANES:       return "half_planes";
+        case StepStatistics::LINEAR_PROGRAMS:   return "linear_programs";
+        case StepStatistics::VELOCITY_UPDATE:   return "velocity_update";
+        case StepStatistics::MOVE:              return "move";
+        case StepStatistics::CONVERGENCE_CHECK: return "convergence_check";
+        default:                                return "unknown";
+    }
+}
+
+/**
+ * Returns the wall time spent in all phases, in
+ * seconds.
+ */
+double StepStatistics::totalSeconds(void) const {
+    double total = 0.0;
+    for (size_t p = 0 ; p < StepStatistics::PHASE_COUNT ; p++) {
+        total += this->seconds[p];
+    }
+    return total;
+}
+
+/**
+ * Returns the mean number of half-planes given to
+ * the linear program of an agent, or 0 if none was
+ * solved.
+ */
+double StepStatistics::halfPlanesPerAgent(void) const {
+    return (this->linearPrograms == 0) ? 0.0 :
+        static_cast<double>(this->halfPlanes) / this->linearPrograms;
+}
+
+/*
+    Other methods
+*/
+
+/**
+ * Resets the times and counters to 0.
+ */
+void StepStatistics::clear(void) {
+    std::fill(this->seconds, this->seconds + StepStatistics::PHASE_COUNT, 0.0);
+    this->iterations = 0;
+    this->linearPrograms = 0;
+    this->halfPlanes = 0;
+    this->maxHalfPlanes = 0;
+    this->violations = 0;
+    this->infeasible = 0;
+}
+
+/**
+ * Adds the times and counters of the statistics
+ * given as a parameter to these ones.
+ * 
+ * @param THAT - The statistics to add
+ */
+void StepStatistics::merge(const StepStatistics& THAT) {
+    for (size_t p = 0 ; p < StepStatistics::PHASE_COUNT ; p++) {
+        this->seconds[p] += THAT.seconds[p];
+    }
+    this->iterations += THAT.iterations;
+    this->linearPrograms += THAT.linearPrograms;
+    this->halfPlanes += THAT.halfPlanes;
+    this->maxHalfPlanes = std::max(this->maxHalfPlanes, THAT.maxHalfPlanes);
+    this->violations += THAT.violations;
+    this->infeasible += THAT.infeasible;
+}
+
+/**
+ * Scales the times of the phases so that they add up
+ * to WALL_SECONDS, keeping their proportions. Used
+ * to turn the time spent by several threads in a
+ * loop into the wall time of the loop.
+ * 
+ * @param WALL_SECONDS - The wall time of the phases
+ */
+void StepStatistics::spread(const double WALL_SECONDS) {
+    double total = this->totalSeconds();
+    for (size_t p = 0 ; p < StepStatistics::PHASE_COUNT ; p++) {
+        this->seconds[p] = (total > 0.0) ? WALL_SECONDS * this->seconds[p] / total : 0.0;
+    }
+}
+
+/**
+ * Writes the names of the columns written by
+ * writeCsv, as a line of CSV.
+ * 
+ * @param file - The file to write to
+ */
+void StepStatistics::writeCsvHeader(FILE* file) {
+    fprintf(file, "step");
+    for (size_t p = 0 ; p < StepStatistics::PHASE_COUNT ; p++) {
+        fprintf(file, ",%s_seconds", StepStatistics::phaseName(static_cast<Phase>(p)));
+    }
+    fprintf(file, ",iterations,linear_programs,half_planes_per_agent,max_half_planes,violations,infeasible\n");
+}
+
+/**
+ * Writes these statistics as a line of CSV.
+ * 
+ * @param file - The file to write to
+ * @param STEP - The number of the step
+ */
+void StepStatistics::writeCsv(FILE* file, const size_t STEP) const {
+    fprintf(file, "%u", (unsigned) STEP);
+    for (size_t p = 0 ; p < StepStatistics::PHASE_COUNT ; p++) {
+        fprintf(file, ",%.9g", this->seconds[p]);
+    }
+    fprintf(file, ",%u,%u,%.4f,%u,%u,%u\n", (unsigned) this->iterations, (unsigned) this->linearPrograms,
+        this->halfPlanesPerAgent(), (unsigned) this->maxHalfPlanes, (unsigned) this->violations,
+        (unsigned) this->infeasible);
+}
+
+/**
+ * Writes these statistics as a JSON object, on a
+ * single line and without a line break.
+ * 
+ * @param file - The file to write to
+ * @param STEP - The number of the step
+ */
+void StepStatistics::writeJson(FILE* file, const size_t STEP) const {
+    fprintf(file, "{\"step\": %u, \"seconds\": {", (unsigned) STEP);
+    for (size_t p = 0 ; p < StepStatistics::PHASE_COUNT ; p++) {
+        fprintf(file, "%s\"%s\": %.9g", (p == 0) ? "" : ", ",
+            StepStatistics::phaseName(static_cast<Phase>(p)), this->seconds[p]);
+    }
+    fprintf(file, "}, \"iterations\": %u, \"linearPrograms\": %u, \"halfPlanesPerAgent\": %.4f, "
+        "\"maxHalfPlanes\": %u, \"violations\": %u, \"infeasible\": %u}", (unsigned) this->iterations,
+        (unsigned) this->linearPrograms, this->halfPlanesPerAgent(), (unsigned) this->maxHalfPlanes,
+        (unsigned) this->violations, (unsigned) this->infeasible);
+}
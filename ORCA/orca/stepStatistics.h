@@ -0,0 +1,134 @@
+/**
+ * File  : stepStatistics.h
+ * Author: Raja Soufi
+ * 
+ * Definition of the statistics a simulation gathers
+ * about its steps: the wall time spent in each phase
+ * of a step, and counters of the work done by the
+ * linear programs.
+ * 
+ * The statistics are only gathered when the program
+ * is built with STEP_STATISTICS defined. Otherwise
+ * enabled returns false, the clocks are never read,
+ * and the statistics stay at 0 and cost nothing.
+ * 
+ * The phases run by the threads of an iteration for
+ * each agent in turn, finding its neighbors, building
+ * its half-planes and solving its linear program,
+ * are timed on each thread. The wall time of the
+ * loop is then split between them in proportion to
+ * the time the threads spent in each.
+ */
+
+// Include guard
+#ifndef _STEP_STATISTICS_H_
+#define _STEP_STATISTICS_H_
+
+// Inclusions
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+// Structure definition
+struct StepStatistics {
+    
+    // The phases of a step
+    enum Phase {
+        NEIGHBOR_SEARCH,
+        HALF_PLANES,
+        LINEAR_PROGRAMS,
+        VELOCITY_UPDATE,
+        MOVE,
+        CONVERGENCE_CHECK,
+        PHASE_COUNT
+    };
+    
+    // The clock timing the phases
+    typedef std::chrono::steady_clock Clock;
+    
+    // The wall time spent in each phase, in seconds
+    double seconds[PHASE_COUNT];
+    
+    // The number of iterations, of linear programs
+    // solved, of half-planes they were given, of
+    // half-planes given to a single one at most, of
+    // half-planes their solution had to be moved onto,
+    // and of linear programs found infeasible
+    size_t iterations;
+    size_t linearPrograms;
+    size_t halfPlanes;
+    size_t maxHalfPlanes;
+    size_t violations;
+    size_t infeasible;
+    
+    // Constructor
+    StepStatistics(void);
+    
+    // Getters
+    static inline bool enabled(void);
+    static const char* phaseName(const Phase PHASE);
+    
+    double totalSeconds(void) const;
+    double halfPlanesPerAgent(void) const;
+    
+    // Other methods
+    static inline Clock::time_point start(void);
+    inline void lap(const Phase PHASE, Clock::time_point& since);
+    
+    void clear(void);
+    void merge(const StepStatistics& THAT);
+    void spread(const double WALL_SECONDS);
+    
+    static void writeCsvHeader(FILE* file);
+    void writeCsv(FILE* file, const size_t STEP) const;
+    void writeJson(FILE* file, const size_t STEP) const;
+    
+};
+
+/*
+    Getters
+*/
+
+/**
+ * Tests whether statistics are being gathered,
+ * which is the case when the program is built with
+ * STEP_STATISTICS defined.
+ */
+inline bool StepStatistics::enabled(void) {
+    #ifdef STEP_STATISTICS
+    return true;
+    #else
+    return false;
+    #endif
+}
+
+/*
+    Other methods
+*/
+
+/**
+ * Returns the time at which a phase starts, or
+ * nothing if statistics are not being gathered.
+ */
+inline StepStatistics::Clock::time_point StepStatistics::start(void) {
+    return StepStatistics::enabled() ? Clock::now() : Clock::time_point();
+}
+
+/**
+ * Adds the time elapsed since SINCE to the phase
+ * given as a parameter, and sets SINCE to now, when
+ * the next phase starts. Does nothing if statistics
+ * are not being gathered.
+ * 
+ * @param PHASE - The phase that just ended
+ * @param since - The time at which it started
+ */
+inline void StepStatistics::lap(const Phase PHASE, Clock::time_point& since) {
+    if (StepStatistics::enabled()) {
+        Clock::time_point now = Clock::now();
+        this->seconds[PHASE] += std::chrono::duration<double>(now - since).count();
+        since = now;
+    }
+}
+
+#endif // _STEP_STATISTICS_H_
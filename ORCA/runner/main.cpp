@@ -0,0 +1,201 @@
+/**
+ * File  : main.cpp
+ * Author: Raja Soufi
+ * 
+ * Implementation of the main function of the
+ * headless runner.
+ */
+
+// Inclusions
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <string>
+#include <thread>
+
+#include "runner.h"
+
+/*
+    Helpers
+*/
+
+/**
+ * Prints how to use the program.
+ * 
+ * @param PROGRAM - The name of the program
+ */
+static void usage(const char* const PROGRAM) {
+    fprintf(stderr,
+        "Usage: %s SCENARIO [options]\n"
+        "\n"
+        "SCENARIO is circle:N, crossing:N, grid:N, random:N[:SEED] or the path\n"
+        "of a scenario file.\n"
+        "\n"
+        "Options:\n"
+        "  --steps N             Stop after N steps, converged or not, instead of\n"
+        "                        failing if the agents have not arrived after 100000\n"
+        "  --threads N           Run on N threads, 0 for all cores (1)\n"
+        "  --float               Run in single precision\n"
+        "  --search NAME         Find neighbors with brute, hash or kdtree (kdtree)\n"
+        "  --no-sleep            Keep solving for the agents which have arrived\n"
+        "  --skew F              Turn the preferred velocities by a slope of at most\n"
+        "                        F, 0 to point them at the destinations (0.01)\n"
+        "  --trajectories PATH   Write the trajectories to PATH as CSV\n"
+        "  --binary              Write the trajectories in the binary format instead\n"
+        "  --every N             Record the trajectories every N steps (1)\n"
+        "  --buffers N           Let N binary frames wait to be written (16)\n"
+        "  --drop                Drop binary frames rather than wait for a buffer\n"
+        "  --timing PATH         Write the time of each step to PATH as CSV\n"
+        "  --statistics PATH     Write the statistics of each step to PATH, as JSON\n"
+        "                        if it ends in .json and as CSV otherwise (needs a\n"
+        "                        build with STEP_STATISTICS defined)\n",
+        PROGRAM);
+}
+
+/**
+ * Reads a positive count from the argument given as
+ * a parameter, or exits if it is not one.
+ * 
+ * @param ARGUMENT - The argument to read
+ * @param PROGRAM  - The name of the program
+ */
+static size_t count(const char* const ARGUMENT, const char* const PROGRAM) {
+    char* end;
+    long value = strtol(ARGUMENT, &end, 10);
+    if ((end == ARGUMENT) || (*end != '\0') || (value <= 0)) {
+        fprintf(stderr, "%s: '%s' is not a positive number\n", PROGRAM, ARGUMENT);
+        exit(EXIT_FAILURE);
+    }
+    return static_cast<size_t>(value);
+}
+
+/**
+ * Reads a number of threads from the argument given
+ * as a parameter, 0 standing for all available
+ * cores, or exits if it is not one.
+ * 
+ * @param ARGUMENT - The argument to read
+ * @param PROGRAM  - The name of the program
+ */
+static size_t threads(const char* const ARGUMENT, const char* const PROGRAM) {
+    if (strcmp(ARGUMENT, "0") == 0) {
+        return std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    return count(ARGUMENT, PROGRAM);
+}
+
+/**
+ * Reads a non-negative number from the argument
+ * given as a parameter, or exits if it is not one.
+ * 
+ * @param ARGUMENT - The argument to read
+ * @param PROGRAM  - The name of the program
+ */
+static double amount(const char* const ARGUMENT, const char* const PROGRAM) {
+    char* end;
+    double value = strtod(ARGUMENT, &end);
+    if ((end == ARGUMENT) || (*end != '\0') || !(value >= 0.0)) {
+        fprintf(stderr, "%s: '%s' is not a non-negative number\n", PROGRAM, ARGUMENT);
+        exit(EXIT_FAILURE);
+    }
+    return value;
+}
+
+/*
+    Main function
+*/
+
+/**
+ * The main function of the program.
+ * 
+ * @param argc - The number of parameters passed to
+ *               the program
+ * @param argv - A pointer to the parameters passed
+ *               to the program
+ */
+int main(int argc, char** argv) {
+    
+    if (argc < 2) {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    
+    Runner::Options options;
+    bool stepsGiven = false;
+    
+    for (int i = 2 ; i < argc ; i++) {
+        
+        bool hasValue = (i + 1 < argc);
+        
+        if (strcmp(argv[i], "--float") == 0) {
+            options.singlePrecision = true;
+        } else if (strcmp(argv[i], "--binary") == 0) {
+            options.binaryTrajectories = true;
+        } else if (strcmp(argv[i], "--drop") == 0) {
+            options.dropFrames = true;
+        } else if (strcmp(argv[i], "--no-sleep") == 0) {
+            options.sleeping = false;
+        } else if ((strcmp(argv[i], "--buffers") == 0) && hasValue) {
+            options.recordBuffers = count(argv[++i], argv[0]);
+        } else if ((strcmp(argv[i], "--steps") == 0) && hasValue) {
+            options.maxSteps = count(argv[++i], argv[0]);
+            stepsGiven = true;
+        } else if ((strcmp(argv[i], "--threads") == 0) && hasValue) {
+            options.threadCount = threads(argv[++i], argv[0]);
+        } else if ((strcmp(argv[i], "--skew") == 0) && hasValue) {
+            options.skew = amount(argv[++i], argv[0]);
+        } else if ((strcmp(argv[i], "--every") == 0) && hasValue) {
+            options.recordEvery = count(argv[++i], argv[0]);
+        } else if ((strcmp(argv[i], "--trajectories") == 0) && hasValue) {
+            options.trajectoryPath = argv[++i];
+        } else if ((strcmp(argv[i], "--timing") == 0) && hasValue) {
+            options.timingPath = argv[++i];
+        } else if ((strcmp(argv[i], "--statistics") == 0) && hasValue) {
+            options.statisticsPath = argv[++i];
+        } else if ((strcmp(argv[i], "--search") == 0) && hasValue) {
+            std::string name = argv[++i];
+            if (name == "brute") {
+                options.neighborSearch = Simulator::BRUTE_FORCE;
+            } else if (name == "hash") {
+                options.neighborSearch = Simulator::SPATIAL_HASH;
+            } else if (name == "kdtree") {
+                options.neighborSearch = Simulator::KD_TREE;
+            } else {
+                usage(argv[0]);
+                return EXIT_FAILURE;
+            }
+        } else {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        
+    }
+    
+    if (!options.statisticsPath.empty() && !StepStatistics::enabled()) {
+        fprintf(stderr, "%s: built without STEP_STATISTICS, the statistics will be 0\n", argv[0]);
+    }
+    
+    try {
+        
+        Scenario scenario = Scenario::named(argv[1]);
+        Runner::Report report = Runner::run(scenario, options);
+        Runner::print(scenario, options, report);
+        
+        // Without a number of steps, the run is expected to
+        // go on until the agents arrive
+        if (!report.converged && !stepsGiven) {
+            fprintf(stderr, "%s: the agents have not arrived after %u steps\n", argv[0],
+                (unsigned) report.steps);
+            return EXIT_FAILURE;
+        }
+        
+    } catch (const std::exception& e) {
+        fprintf(stderr, "%s: %s\n", argv[0], e.what());
+        return EXIT_FAILURE;
+    }
+    
+    return EXIT_SUCCESS;
+    
+}
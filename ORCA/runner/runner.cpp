@@ -0,0 +1,295 @@
+/**
+ * File  : runner.cpp
+ * Author: Raja Soufi
+ * 
+ * Implementation of the Runner class defined
+ * in runner.h.
+ */
+
+// Include header file
+#include "runner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+
+/*
+    Constructors
+*/
+
+/**
+ * Constructs the default options: double precision,
+ * a k-d tree, sleeping agents, the skew of the demo,
+ * one thread, at most 100000 steps, and no file
+ * written.
+ */
+Runner::Options::Options(void) :
+    maxSteps(100000),
+    threadCount(1),
+    singlePrecision(false),
+    neighborSearch(Simulator::KD_TREE),
+    sleeping(true),
+    skew(1e-2),
+    trajectoryPath(),
+    binaryTrajectories(false),
+    recordEvery(1),
+    recordBuffers(16),
+    dropFrames(false),
+    timingPath(),
+    statisticsPath()
+{}
+
+/*
+    Helpers
+*/
+
+// A file closed when it goes out of scope
+typedef std::unique_ptr<FILE, int (*)(FILE*)> Output;
+
+/**
+ * Opens the file with the path given as a parameter
+ * for writing, or returns no file if the path is
+ * empty.
+ * 
+ * @param PATH - The path of the file
+ */
+static Output openOutput(const std::string& PATH) {
+    
+    if (PATH.empty()) {
+        return Output(NULL, fclose);
+    }
+    
+    Output file(fopen(PATH.c_str(), "w"), fclose);
+    if (!file) {
+        throw std::runtime_error(PATH + ": cannot open the file for writing");
+    }
+    
+    return file;
+    
+}
+
+/**
+ * Returns the P-th percentile of the sorted times
+ * given as a parameter, by the nearest rank method,
+ * or 0 if there are none.
+ * 
+ * @param SECONDS - The sorted times
+ * @param P       - The percentile, between 0 and 100
+ */
+static double percentile(const std::vector<double>& SECONDS, const double P) {
+    if (SECONDS.empty()) {
+        return 0.0;
+    }
+    size_t rank = static_cast<size_t>(std::ceil(P / 100.0 * SECONDS.size()));
+    return SECONDS[std::min(std::max<size_t>(rank, 1), SECONDS.size()) - 1];
+}
+
+/**
+ * Writes the positions and velocities of the agents
+ * of a simulation at the step given as a parameter.
+ * 
+ * @param FILE_  - The file to write to
+ * @param AGENTS - The agents of the simulation
+ * @param STEP   - The number of the step
+ * @param TIME   - The simulated time at that step
+ */
+template <typename T>
+static void record(FILE* const FILE_, const BasicAgentStore<T>& AGENTS, const size_t STEP,
+    const double TIME)
+{
+    for (size_t i = 0 ; i < AGENTS.size() ; i++) {
+        fprintf(FILE_, "%u,%.9g,%d,%.9g,%.9g,%.9g,%.9g\n", (unsigned) STEP, TIME, AGENTS.id(i),
+            (double) AGENTS.positionX()[i], (double) AGENTS.positionY()[i],
+            (double) AGENTS.velocityX()[i], (double) AGENTS.velocityY()[i]);
+    }
+}
+
+/**
+ * Runs the scenario given as a parameter in the
+ * scalar type T.
+ * 
+ * @param SCENARIO - The scenario to run
+ * @param OPTIONS  - The options of the run
+ */
+template <typename T>
+Runner::Report Runner::simulate(const Scenario& SCENARIO, const Options& OPTIONS) {
+    
+    Report report;
+    report.agentCount = SCENARIO.agents().size();
+    report.steps = 0;
+    report.converged = false;
+    report.recording = TrajectoryRecorderStatistics();
+    
+    // Set the simulation up
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    
+    BasicSimulator<T> simulator(SCENARIO.agents(), SCENARIO.tau(), SCENARIO.deltaT(),
+        SCENARIO.arrivalThreshold());
+    simulator.setObstacles(SCENARIO.obstacles(), SCENARIO.obstacleTau());
+    simulator.setNeighborSearch(static_cast<typename BasicSimulator<T>::NeighborSearch>(OPTIONS.neighborSearch));
+    simulator.setThreadCount(OPTIONS.threadCount);
+    simulator.setSleeping(OPTIONS.sleeping);
+    simulator.setSkew(OPTIONS.skew);
+    
+    // Read the agents through a constant simulation,
+    // which keeps the sleeping agents asleep
+    const BasicAgentStore<T>& AGENTS = static_cast<const BasicSimulator<T>&>(simulator).agents();
+    
+    report.setupSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    
+    std::unique_ptr<BasicTrajectoryRecorder<T> > recorder;
+    Output trajectories(NULL, fclose);
+    if (OPTIONS.binaryTrajectories && !OPTIONS.trajectoryPath.empty()) {
+        recorder.reset(new BasicTrajectoryRecorder<T>(OPTIONS.trajectoryPath, AGENTS,
+            OPTIONS.recordBuffers, OPTIONS.recordEvery,
+            OPTIONS.dropFrames ? BasicTrajectoryRecorder<T>::DROP : BasicTrajectoryRecorder<T>::BLOCK));
+        recorder->record(0.0, AGENTS);
+    } else {
+        trajectories = openOutput(OPTIONS.trajectoryPath);
+    }
+    Output timings = openOutput(OPTIONS.timingPath);
+    Output statistics = openOutput(OPTIONS.statisticsPath);
+    const bool JSON_STATISTICS = (OPTIONS.statisticsPath.size() >= 5) &&
+        (OPTIONS.statisticsPath.compare(OPTIONS.statisticsPath.size() - 5, 5, ".json") == 0);
+    
+    if (trajectories) {
+        fprintf(trajectories.get(), "step,time,agent,x,y,vx,vy\n");
+        record(trajectories.get(), AGENTS, 0, 0.0);
+    }
+    if (timings) {
+        fprintf(timings.get(), "step,seconds\n");
+    }
+    if (statistics && JSON_STATISTICS) {
+        fprintf(statistics.get(), "[");
+    } else if (statistics) {
+        StepStatistics::writeCsvHeader(statistics.get());
+    }
+    simulator.resetStatistics();
+    
+    // Run the simulation until it converges
+    const T DELTA_T = simulator.deltaT();
+    report.runSeconds = 0.0;
+    std::vector<double> stepSeconds;
+    
+    while ((report.steps < OPTIONS.maxSteps) && !(report.converged = simulator.converged())) {
+        
+        start = std::chrono::steady_clock::now();
+        
+        simulator.iteration();
+        simulator.moveAgents(DELTA_T);
+        
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        report.runSeconds += seconds;
+        report.steps++;
+        stepSeconds.push_back(seconds);
+        
+        if (timings) {
+            fprintf(timings.get(), "%u,%.9g\n", (unsigned) report.steps, seconds);
+        }
+        
+        // The statistics of a step cover the convergence
+        // check made before it
+        if (statistics && JSON_STATISTICS) {
+            fprintf(statistics.get(), "%s\n  ", (report.steps == 1) ? "" : ",");
+            simulator.statistics().writeJson(statistics.get(), report.steps);
+        } else if (statistics) {
+            simulator.statistics().writeCsv(statistics.get(), report.steps);
+        }
+        simulator.resetStatistics();
+        
+        if (recorder) {
+            recorder->record(report.steps * SCENARIO.deltaT(), AGENTS);
+        } else if (trajectories && (report.steps % OPTIONS.recordEvery == 0)) {
+            record(trajectories.get(), AGENTS, report.steps, report.steps * SCENARIO.deltaT());
+        }
+        
+    }
+    
+    simulator.finalize();
+    
+    if (statistics && JSON_STATISTICS) {
+        fprintf(statistics.get(), "%s]\n", (report.steps == 0) ? "" : "\n");
+    }
+    
+    std::sort(stepSeconds.begin(), stepSeconds.end());
+    report.medianStepSeconds = percentile(stepSeconds, 50.0);
+    report.p90StepSeconds = percentile(stepSeconds, 90.0);
+    report.p99StepSeconds = percentile(stepSeconds, 99.0);
+    report.maxStepSeconds = stepSeconds.empty() ? 0.0 : stepSeconds.back();
+    
+    if (recorder) {
+        recorder->close();
+        report.recording = recorder->statistics();
+    }
+    
+    return report;
+    
+}
+
+/*
+    Methods
+*/
+
+/**
+ * Runs the scenario given as a parameter with the
+ * options given as a parameter, and returns how it
+ * went.
+ * 
+ * @param SCENARIO - The scenario to run
+ * @param OPTIONS  - The options of the run
+ */
+Runner::Report Runner::run(const Scenario& SCENARIO, const Options& OPTIONS) {
+    if (OPTIONS.singlePrecision) {
+        return Runner::simulate<float>(SCENARIO, OPTIONS);
+    } else {
+        return Runner::simulate<double>(SCENARIO, OPTIONS);
+    }
+}
+
+/**
+ * Prints a summary of a run on the standard output.
+ * 
+ * @param SCENARIO - The scenario that was run
+ * @param OPTIONS  - The options of the run
+ * @param REPORT   - The outcome of the run
+ */
+void Runner::print(const Scenario& SCENARIO, const Options& OPTIONS, const Report& REPORT) {
+    
+    static const char* const SEARCH_NAMES[] = {"brute", "hash", "kdtree"};
+    
+    printf("scenario     %s\n", SCENARIO.name().c_str());
+    printf("agents       %u\n", (unsigned) REPORT.agentCount);
+    printf("obstacles    %u\n", (unsigned) SCENARIO.obstacles().size());
+    printf("precision    %s\n", OPTIONS.singlePrecision ? "float" : "double");
+    printf("search       %s\n", SEARCH_NAMES[OPTIONS.neighborSearch]);
+    printf("threads      %u\n", (unsigned) OPTIONS.threadCount);
+    printf("sleeping     %s\n", OPTIONS.sleeping ? "yes" : "no");
+    printf("skew         %g\n", OPTIONS.skew);
+    printf("steps        %u\n", (unsigned) REPORT.steps);
+    printf("converged    %s\n", REPORT.converged ? "yes" : "no");
+    printf("setup        %.6f s\n", REPORT.setupSeconds);
+    printf("run          %.6f s\n", REPORT.runSeconds);
+    
+    if (REPORT.steps > 0) {
+        printf("per step     %.3f ms\n", 1e3 * REPORT.runSeconds / REPORT.steps);
+        printf("step p50     %.3f ms\n", 1e3 * REPORT.medianStepSeconds);
+        printf("step p90     %.3f ms\n", 1e3 * REPORT.p90StepSeconds);
+        printf("step p99     %.3f ms\n", 1e3 * REPORT.p99StepSeconds);
+        printf("step max     %.3f ms\n", 1e3 * REPORT.maxStepSeconds);
+        printf("agent steps  %.0f /s\n", REPORT.agentCount * REPORT.steps / REPORT.runSeconds);
+    }
+    
+    if (REPORT.recording.offered > 0) {
+        printf("frames       %u written, %u dropped, %u skipped\n", (unsigned) REPORT.recording.written,
+            (unsigned) REPORT.recording.dropped, (unsigned) REPORT.recording.skipped);
+        printf("stalls       %u, %.6f s\n", (unsigned) REPORT.recording.stalls, REPORT.recording.stallSeconds);
+        printf("high water   %u of %u buffers\n", (unsigned) REPORT.recording.highWater,
+            (unsigned) OPTIONS.recordBuffers);
+    }
+    
+}
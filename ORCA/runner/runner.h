@@ -0,0 +1,95 @@
+/**
+ * File  : runner.h
+ * Author: Raja Soufi
+ * 
+ * Class definition of the Runner class, which runs a
+ * scenario without any window, as fast as the CPU
+ * allows, until the agents converge or a step limit
+ * is reached.
+ * 
+ * The trajectories of the agents can be written to a
+ * CSV file with one line per agent and recorded
+ * step, or to a binary trajectory file, and the time
+ * taken by each step to another CSV file. Binary
+ * trajectories are written by a background thread,
+ * the steps only copying the positions into one of
+ * recordBuffers buffers.
+ * Only the iterations and moves are timed, not the
+ * writing of the files, and the report gives the
+ * percentiles of the time taken by a step along with
+ * the total.
+ */
+
+// Include guard
+#ifndef _RUNNER_H_
+#define _RUNNER_H_
+
+// Inclusions
+#include <cstddef>
+#include <string>
+
+#include "../orca/simulator.h"
+
+#include "../scenario/scenario.h"
+
+#include "../trajectory/trajectoryRecorder.h"
+
+// Class definition
+class Runner {
+    
+    public:
+    
+    // Options of a run
+    struct Options {
+        
+        size_t maxSteps;
+        size_t threadCount;
+        bool singlePrecision;
+        Simulator::NeighborSearch neighborSearch;
+        bool sleeping;
+        double skew;
+        
+        std::string trajectoryPath;
+        bool binaryTrajectories;
+        size_t recordEvery;
+        size_t recordBuffers;
+        bool dropFrames;
+        std::string timingPath;
+        std::string statisticsPath;
+        
+        Options(void);
+        
+    };
+    
+    // Outcome of a run
+    struct Report {
+        size_t agentCount;
+        size_t steps;
+        bool converged;
+        double setupSeconds;
+        double runSeconds;
+        double medianStepSeconds;
+        double p90StepSeconds;
+        double p99StepSeconds;
+        double maxStepSeconds;
+        TrajectoryRecorderStatistics recording;
+    };
+    
+    private:
+    
+    // Constructor
+    Runner(void);
+    
+    // Helpers
+    template <typename T>
+    static Report simulate(const Scenario& SCENARIO, const Options& OPTIONS);
+    
+    public:
+    
+    // Methods
+    static Report run(const Scenario& SCENARIO, const Options& OPTIONS);
+    static void print(const Scenario& SCENARIO, const Options& OPTIONS, const Report& REPORT);
+    
+};
+
+#endif // _RUNNER_H_
@@ -0,0 +1,406 @@
+/**
+ * File  : scenario.cpp
+ * Author: Raja Soufi
+ * 
+ * Implementation of the Scenario class defined
+ * in scenario.h.
+ */
+
+// Include header file
+#include "scenario.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+#include "../utilities/exceptions.h"
+
+/*
+    Constants
+*/
+
+/**
+ * The parameters used when a scenario does not give
+ * its own, which are those of the demo.
+ */
+const double Scenario::DEFAULT_TAU = 0.01;
+const double Scenario::DEFAULT_DELTA_T = 0.01;
+const double Scenario::DEFAULT_ARRIVAL_THRESHOLD = 0.1;
+const double Scenario::DEFAULT_OBSTACLE_TAU = 2.0;
+
+/**
+ * The radius and maximum speed of the agents of the
+ * generated scenarios, which are those of the demo.
+ */
+const double Scenario::AGENT_RADIUS = 8.0;
+const double Scenario::AGENT_MAX_SPEED = 20.0;
+
+/*
+    Helpers
+*/
+
+/**
+ * The distance between the centers of two
+ * neighboring agents in the generated scenarios, at
+ * a density of 1, and the smallest one whatever the
+ * density, a little more than the diameter of an
+ * agent. At a density of 1, an agent fits between
+ * two agents which have already arrived, which it
+ * could not get past otherwise.
+ */
+static const double BASE_SPACING = 45.0;
+static const double MIN_SPACING = 18.0;
+
+/**
+ * The largest offset of an agent from its place in
+ * the circle, crossing and grid layouts, as a
+ * fraction of the spacing, and the seed it is drawn
+ * with. It keeps the agents from meeting exactly
+ * head-on, where they would block each other.
+ */
+static const double JITTER = 0.1;
+static const unsigned JITTER_SEED = 1;
+
+/**
+ * Returns the distance between the centers of two
+ * neighboring agents at the density given as a
+ * parameter, the number of agents per unit of area
+ * being proportional to the density.
+ * 
+ * @param DENSITY - The density of the agents
+ */
+static double spacing(const double DENSITY) {
+    return std::max(BASE_SPACING / std::sqrt(DENSITY), MIN_SPACING);
+}
+
+/**
+ * Returns the length of the side of the smallest
+ * square grid holding COUNT cells.
+ * 
+ * @param COUNT - The number of cells
+ */
+static size_t gridSide(const size_t COUNT) {
+    size_t side = 1;
+    while (side * side < COUNT) {
+        side++;
+    }
+    return side;
+}
+
+/**
+ * Returns the point given as a parameter moved by at
+ * most AMPLITUDE along each axis, at random.
+ * 
+ * @param P         - The point to move
+ * @param AMPLITUDE - The largest offset along an axis
+ * @param engine    - The random engine to draw from
+ */
+static Point jittered(const Point& P, const double AMPLITUDE, std::mt19937& engine) {
+    std::uniform_real_distribution<double> offset(-AMPLITUDE, AMPLITUDE);
+    double x = P.x() + offset(engine);
+    double y = P.y() + offset(engine);
+    return Point(x, y);
+}
+
+/**
+ * Throws an exception telling that the line LINE of
+ * the file PATH could not be read.
+ * 
+ * @param PATH    - The path of the file
+ * @param LINE    - The number of the line
+ * @param MESSAGE - What is wrong with the line
+ */
+static void fail(const std::string& PATH, const size_t LINE, const std::string& MESSAGE) {
+    std::ostringstream message;
+    message << PATH << ":" << LINE << ": " << MESSAGE;
+    throw ScenarioFormatException(message.str());
+}
+
+/*
+    Constructor
+*/
+
+/**
+ * Constructs an empty scenario with the name given
+ * as a parameter and the default parameters.
+ * 
+ * @param NAME - The name of the scenario
+ */
+Scenario::Scenario(const std::string& NAME) :
+    name_(NAME),
+    agents_(),
+    obstacles_(),
+    tau_(Scenario::DEFAULT_TAU),
+    deltaT_(Scenario::DEFAULT_DELTA_T),
+    arrivalThreshold_(Scenario::DEFAULT_ARRIVAL_THRESHOLD),
+    obstacleTau_(Scenario::DEFAULT_OBSTACLE_TAU)
+{}
+
+/*
+    Factories
+*/
+
+/**
+ * Returns a scenario with COUNT agents laid out in a
+ * circle around the origin, each going to the
+ * antipode of its initial position. The circle
+ * grows with COUNT so that the agents do not touch,
+ * and shrinks as the density grows. The agents start
+ * slightly off the circle.
+ * 
+ * @param COUNT   - The number of agents
+ * @param DENSITY - The density of the agents on the
+ *                  circle
+ */
+Scenario Scenario::circle(const size_t COUNT, const double DENSITY) {
+    
+    Scenario scenario("circle:" + std::to_string(COUNT));
+    
+    const double PI = std::acos(-1.0);
+    double arc = std::max(2.5 * Scenario::AGENT_RADIUS / std::sqrt(DENSITY), MIN_SPACING);
+    double radius = std::max(60.0, COUNT * arc / (2.0 * PI));
+    std::mt19937 engine(JITTER_SEED);
+    
+    for (size_t i = 0 ; i < COUNT ; i++) {
+        double angle = 2.0 * PI * i / COUNT;
+        Point position(radius * std::cos(angle), radius * std::sin(angle));
+        scenario.agents_.push_back(Agent(jittered(position, JITTER * arc, engine),
+            Point(-position.x(), -position.y()), Scenario::AGENT_RADIUS, Scenario::AGENT_MAX_SPEED));
+    }
+    
+    return scenario;
+    
+}
+
+/**
+ * Returns a scenario with two groups of COUNT / 2
+ * agents on either side of the origin, each group
+ * walking through the other to the opposite side.
+ * The rows of the two groups are staggered, and the
+ * agents start slightly off their rows, so that no
+ * two agents meet head-on.
+ * 
+ * @param COUNT   - The number of agents
+ * @param DENSITY - The density of the agents
+ */
+Scenario Scenario::crossing(const size_t COUNT, const double DENSITY) {
+    
+    Scenario scenario("crossing:" + std::to_string(COUNT));
+    
+    const double SPACING = spacing(DENSITY);
+    size_t side = gridSide((COUNT + 1) / 2);
+    double offset = 2.0 * SPACING;
+    std::mt19937 engine(JITTER_SEED);
+    
+    for (size_t i = 0 ; i < COUNT ; i++) {
+        size_t k = i / 2;
+        double x = offset + (k % side) * SPACING;
+        double sign = (i % 2 == 0) ? -1.0 : 1.0;
+        double y = ((k / side) - 0.5 * (side - 1) + 0.25 * sign) * SPACING;
+        scenario.agents_.push_back(Agent(jittered(Point(sign * x, y), JITTER * SPACING, engine),
+            Point(-sign * x, y), Scenario::AGENT_RADIUS, Scenario::AGENT_MAX_SPEED));
+    }
+    
+    return scenario;
+    
+}
+
+/**
+ * Returns a scenario with COUNT agents on a square
+ * grid centered at the origin, each going to the
+ * point symmetric to its place on the grid, so that
+ * they all meet around the origin. The agents start
+ * slightly off their places.
+ * 
+ * @param COUNT   - The number of agents
+ * @param DENSITY - The density of the agents
+ */
+Scenario Scenario::grid(const size_t COUNT, const double DENSITY) {
+    
+    Scenario scenario("grid:" + std::to_string(COUNT));
+    
+    const double SPACING = spacing(DENSITY);
+    size_t side = gridSide(COUNT);
+    std::mt19937 engine(JITTER_SEED);
+    
+    for (size_t i = 0 ; i < COUNT ; i++) {
+        double x = ((i % side) - 0.5 * (side - 1)) * SPACING;
+        double y = ((i / side) - 0.5 * (side - 1)) * SPACING;
+        scenario.agents_.push_back(Agent(jittered(Point(x, y), JITTER * SPACING, engine),
+            Point(-x, -y), Scenario::AGENT_RADIUS, Scenario::AGENT_MAX_SPEED));
+    }
+    
+    return scenario;
+    
+}
+
+/**
+ * Returns a scenario with COUNT agents scattered
+ * over a square grid, each going to another cell of
+ * the grid drawn at random. The same seed always
+ * gives the same scenario.
+ * 
+ * @param COUNT   - The number of agents
+ * @param SEED    - The seed of the random draws
+ * @param DENSITY - The density of the agents
+ */
+Scenario Scenario::random(const size_t COUNT, const unsigned SEED, const double DENSITY) {
+    
+    Scenario scenario("random:" + std::to_string(COUNT) + ":" + std::to_string(SEED));
+    
+    const double SPACING = spacing(DENSITY);
+    std::mt19937 engine(SEED);
+    std::uniform_real_distribution<double> jitter(-0.15 * SPACING, 0.15 * SPACING);
+    
+    size_t side = gridSide(COUNT);
+    std::vector<size_t> cells(side * side);
+    for (size_t i = 0 ; i < cells.size() ; i++) {
+        cells[i] = i;
+    }
+    
+    std::shuffle(cells.begin(), cells.end(), engine);
+    std::vector<size_t> destinations(cells.begin(), cells.begin() + COUNT);
+    std::shuffle(cells.begin(), cells.end(), engine);
+    
+    for (size_t i = 0 ; i < COUNT ; i++) {
+        Point position(((cells[i] % side) - 0.5 * (side - 1)) * SPACING + jitter(engine),
+            ((cells[i] / side) - 0.5 * (side - 1)) * SPACING + jitter(engine));
+        Point destination(((destinations[i] % side) - 0.5 * (side - 1)) * SPACING,
+            ((destinations[i] / side) - 0.5 * (side - 1)) * SPACING);
+        scenario.agents_.push_back(Agent(position, destination,
+            Scenario::AGENT_RADIUS, Scenario::AGENT_MAX_SPEED));
+    }
+    
+    return scenario;
+    
+}
+
+/**
+ * Reads the scenario stored in the file given as a
+ * parameter, in the format described in scenario.h.
+ * Throws a ScenarioFormatException telling which
+ * line is wrong if the file cannot be read.
+ * 
+ * @param PATH - The path of the file
+ */
+Scenario Scenario::load(const std::string& PATH) {
+    
+    std::ifstream file(PATH.c_str());
+    if (!file) {
+        throw ScenarioFormatException(PATH + ": cannot open the file");
+    }
+    
+    Scenario scenario(PATH);
+    std::string line;
+    
+    for (size_t number = 1 ; std::getline(file, line) ; number++) {
+        
+        // Skip blank lines and comments
+        std::istringstream entry(line);
+        std::string keyword;
+        if (!(entry >> keyword) || (keyword[0] == '#')) {
+            continue;
+        }
+        
+        std::vector<double> values;
+        std::string token;
+        while (entry >> token) {
+            char* end;
+            double value = std::strtod(token.c_str(), &end);
+            if ((end == token.c_str()) || (*end != '\0')) {
+                fail(PATH, number, "'" + token + "' is not a number");
+            }
+            values.push_back(value);
+        }
+        
+        if ((keyword == "tau") || (keyword == "deltaT") ||
+            (keyword == "arrivalThreshold") || (keyword == "obstacleTau"))
+        {
+            if ((values.size() != 1) || !(values[0] >= 0.0)) {
+                fail(PATH, number, keyword + " takes one non-negative value");
+            }
+            double& parameter = (keyword == "tau") ? scenario.tau_ :
+                (keyword == "deltaT") ? scenario.deltaT_ :
+                (keyword == "arrivalThreshold") ? scenario.arrivalThreshold_ : scenario.obstacleTau_;
+            parameter = values[0];
+        }
+        else if (keyword == "agent") {
+            if ((values.size() != 6) && (values.size() != 8)) {
+                fail(PATH, number, "agent takes 6 or 8 values");
+            }
+            if (!(values[4] > 0.0) || !(values[5] > 0.0)) {
+                fail(PATH, number, "the radius and maximum speed of an agent must be positive");
+            }
+            Point position(values[0], values[1]);
+            Point destination(values[2], values[3]);
+            if (values.size() == 6) {
+                scenario.agents_.push_back(Agent(position, destination, values[4], values[5]));
+            } else {
+                scenario.agents_.push_back(Agent(position, destination, values[4], values[5],
+                    values[6], static_cast<int>(values[7])));
+            }
+        }
+        else if (keyword == "obstacle") {
+            if ((values.size() < 4) || (values.size() % 2 != 0)) {
+                fail(PATH, number, "obstacle takes the coordinates of at least 2 vertices");
+            }
+            std::vector<Point> vertices;
+            for (size_t i = 0 ; i < values.size() ; i += 2) {
+                vertices.push_back(Point(values[i], values[i + 1]));
+            }
+            scenario.obstacles_.push_back(Obstacle(vertices));
+        }
+        else {
+            fail(PATH, number, "unknown entry '" + keyword + "'");
+        }
+        
+    }
+    
+    return scenario;
+    
+}
+
+/**
+ * Returns the scenario with the name given as a
+ * parameter: circle:N, crossing:N, grid:N, or
+ * random:N[:SEED] for the generated ones, and the
+ * path of a file otherwise.
+ * 
+ * @param NAME - The name of the scenario
+ */
+Scenario Scenario::named(const std::string& NAME) {
+    
+    size_t colon = NAME.find(':');
+    std::string kind = NAME.substr(0, colon);
+    
+    if ((colon == std::string::npos) ||
+        ((kind != "circle") && (kind != "crossing") && (kind != "grid") && (kind != "random")))
+    {
+        return Scenario::load(NAME);
+    }
+    
+    std::istringstream arguments(NAME.substr(colon + 1));
+    size_t count = 0;
+    unsigned seed = 1;
+    char separator;
+    if (!(arguments >> count) || (count == 0) ||
+        ((arguments >> separator) && ((separator != ':') || !(arguments >> seed))))
+    {
+        throw ScenarioFormatException(NAME + ": expected " + kind + ":COUNT" +
+            ((kind == "random") ? "[:SEED]" : ""));
+    }
+    
+    if (kind == "circle") {
+        return Scenario::circle(count);
+    } else if (kind == "crossing") {
+        return Scenario::crossing(count);
+    } else if (kind == "grid") {
+        return Scenario::grid(count);
+    } else {
+        return Scenario::random(count, seed);
+    }
+    
+}
@@ -0,0 +1,147 @@
+/**
+ * File  : scenario.h
+ * Author: Raja Soufi
+ * 
+ * Class definition of a scenario, that is, the
+ * agents, obstacles and parameters a simulation
+ * starts from.
+ * 
+ * A scenario is either generated, by name, or read
+ * from a text file holding one entry per line:
+ * 
+ *     # A comment
+ *     tau 0.01
+ *     deltaT 0.01
+ *     arrivalThreshold 0.1
+ *     obstacleTau 2.0
+ *     agent PX PY DX DY RADIUS MAX_SPEED [NEIGHBOR_DIST MAX_NEIGHBORS]
+ *     obstacle X1 Y1 X2 Y2 ...
+ * 
+ * where (PX, PY) is the initial position of an agent
+ * and (DX, DY) its destination, and the vertices of
+ * an obstacle are listed counterclockwise. The
+ * parameters left out keep the values used by the
+ * demo.
+ * 
+ * The generated scenarios scale the configurations
+ * of the demo to any number of agents, and can be
+ * made denser or sparser than the demo: at a density
+ * of D, the agents are sqrt(D) times closer to each
+ * other, though never close enough to overlap.
+ */
+
+// Include guard
+#ifndef _SCENARIO_H_
+#define _SCENARIO_H_
+
+// Inclusions
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "../orca/agent.h"
+#include "../orca/obstacle.h"
+
+// Class definition
+class Scenario {
+    
+    private:
+    
+    // Constants
+    static const double DEFAULT_TAU;
+    static const double DEFAULT_DELTA_T;
+    static const double DEFAULT_ARRIVAL_THRESHOLD;
+    static const double DEFAULT_OBSTACLE_TAU;
+    
+    static const double AGENT_RADIUS;
+    static const double AGENT_MAX_SPEED;
+    
+    // Attributes
+    std::string name_;
+    std::vector<Agent> agents_;
+    std::vector<Obstacle> obstacles_;
+    double tau_;
+    double deltaT_;
+    double arrivalThreshold_;
+    double obstacleTau_;
+    
+    public:
+    
+    // Constructor
+    Scenario(const std::string& NAME);
+    
+    // Getters
+    inline const std::string& name(void) const;
+    inline const std::vector<Agent>& agents(void) const;
+    inline const std::vector<Obstacle>& obstacles(void) const;
+    inline double tau(void) const;
+    inline double deltaT(void) const;
+    inline double arrivalThreshold(void) const;
+    inline double obstacleTau(void) const;
+    
+    // Factories
+    static Scenario circle(const size_t COUNT, const double DENSITY = 1.0);
+    static Scenario crossing(const size_t COUNT, const double DENSITY = 1.0);
+    static Scenario grid(const size_t COUNT, const double DENSITY = 1.0);
+    static Scenario random(const size_t COUNT, const unsigned SEED, const double DENSITY = 1.0);
+    static Scenario load(const std::string& PATH);
+    static Scenario named(const std::string& NAME);
+    
+};
+
+/*
+    Getters
+*/
+
+/**
+ * Returns the name of this scenario.
+ */
+inline const std::string& Scenario::name(void) const {
+    return this->name_;
+}
+
+/**
+ * Returns the agents of this scenario, at their
+ * initial positions.
+ */
+inline const std::vector<Agent>& Scenario::agents(void) const {
+    return this->agents_;
+}
+
+/**
+ * Returns the static obstacles of this scenario.
+ */
+inline const std::vector<Obstacle>& Scenario::obstacles(void) const {
+    return this->obstacles_;
+}
+
+/**
+ * Returns the value of tau used between agents.
+ */
+inline double Scenario::tau(void) const {
+    return this->tau_;
+}
+
+/**
+ * Returns the duration of an iteration.
+ */
+inline double Scenario::deltaT(void) const {
+    return this->deltaT_;
+}
+
+/**
+ * Returns the distance to its destination within
+ * which an agent has arrived.
+ */
+inline double Scenario::arrivalThreshold(void) const {
+    return this->arrivalThreshold_;
+}
+
+/**
+ * Returns the value of tau used for the obstacles.
+ */
+inline double Scenario::obstacleTau(void) const {
+    return this->obstacleTau_;
+}
+
+#endif // _SCENARIO_H_
@@ -0,0 +1,220 @@
+/**
+ * File  : simulationTests.cpp
+ * Author: Raja Soufi
+ * 
+ * Implementation of the main function of the tests
+ * of the simulation, which run small simulations and
+ * check properties of their outcome that the demo
+ * and the benchmarks cannot show.
+ * 
+ * An agent walking down a corridor must stay out of
+ * both walls, the half-planes of the nearer wall not
+ * hiding the edges of the farther one.
+ * 
+ * The steps of a simulation must not allocate any
+ * memory once they have warmed up. The allocations
+ * are counted by AllocationCounter, which only counts
+ * them when every source is built with
+ * COUNT_ALLOCATIONS defined, so the tests are built
+ * and run from the ORCA directory with
+ * 
+ *     g++ -std=c++14 -O2 -pthread -DCOUNT_ALLOCATIONS \
+ *         tests/simulationTests.cpp \
+ *         $(find orca utilities -name '*.cpp') \
+ *         -o simulationTests
+ *     ./simulationTests
+ * 
+ * The program prints a line per test and fails if
+ * any of them does not pass, or if it was built
+ * without COUNT_ALLOCATIONS.
+ */
+
+// Inclusions
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <random>
+#include <vector>
+
+#include "../geom/point.h"
+
+#include "../orca/agent.h"
+#include "../orca/obstacle.h"
+#include "../orca/simulator.h"
+
+#include "../utilities/allocationCounter.h"
+
+/*
+    Constants
+*/
+
+// The radius and maximum speed of the agents
+static const double AGENT_RADIUS = 8.0;
+static const double AGENT_MAX_SPEED = 20.0;
+
+// The value of tau
+static const double TAU = 2.0;
+
+// The simulation whose steps must not allocate: its
+// number of agents, the half-side of the square they
+// cross, and its numbers of steps
+static const size_t ALLOCATION_AGENTS = 500;
+static const double ALLOCATION_SIDE = 300.0;
+static const double ALLOCATION_DELTA_T = 0.05;
+static const size_t WARM_UP_STEPS = 300;
+static const size_t CHECKED_STEPS = 100;
+
+/*
+    Tests
+*/
+
+/**
+ * Runs an agent heading into the lower wall of a
+ * corridor, starting closer to the upper one, and
+ * tests whether it stays out of the lower wall, as it
+ * does when the corridor has no upper wall.
+ */
+static bool testCorridor(void) {
+    
+    const double RADIUS = 0.3;
+    const double HALF_WIDTH = 1.0;
+    const double DELTA_T = 0.5;
+    
+    std::vector<Obstacle> walls;
+    walls.push_back(Obstacle(std::vector<Point>{Point(-20.0, -HALF_WIDTH), Point(20.0, -HALF_WIDTH)}));
+    walls.push_back(Obstacle(std::vector<Point>{Point(-20.0, HALF_WIDTH), Point(20.0, HALF_WIDTH)}));
+    
+    const std::vector<Agent> AGENTS(1, Agent(Point(0.0, 0.6), Point(1.0, -100.0), RADIUS, 4.0, 5.0, 10));
+    
+    Simulator simulator(AGENTS, 1.0, DELTA_T, 0.0);
+    simulator.setObstacles(walls, 1.0);
+    const Simulator& SIMULATOR = simulator;
+    
+    double lowest = HALF_WIDTH;
+    for (size_t k = 0 ; k < 20 ; k++) {
+        simulator.iteration();
+        simulator.moveAgents(DELTA_T);
+        lowest = std::min(lowest, SIMULATOR.agents().position(0).y());
+    }
+    
+    if (lowest < - HALF_WIDTH + RADIUS - 1e-6) {
+        fprintf(stderr, "the agent went down to y = %g in a corridor whose lower wall stops it at %g\n",
+            lowest, - HALF_WIDTH + RADIUS);
+        return false;
+    }
+    
+    return true;
+    
+}
+
+/**
+ * Runs a simulation of agents crossing a square, with
+ * each neighbor search and on one and two threads,
+ * and tests whether its steps make no heap allocation
+ * once they have warmed up.
+ */
+static bool testAllocations(void) {
+    
+    static const Simulator::NeighborSearch SEARCHES[] = {
+        Simulator::BRUTE_FORCE, Simulator::SPATIAL_HASH, Simulator::KD_TREE
+    };
+    static const char* const SEARCH_NAMES[] = {"brute", "hash", "kdtree"};
+    static const size_t THREAD_COUNTS[] = {1, 2};
+    
+    if (!AllocationCounter::enabled()) {
+        fprintf(stderr, "built without COUNT_ALLOCATIONS, the allocations are not counted\n");
+        return false;
+    }
+    
+    std::minstd_rand engine(1);
+    std::uniform_real_distribution<double> coordinate(-ALLOCATION_SIDE, ALLOCATION_SIDE);
+    
+    std::vector<Agent> agents;
+    for (size_t i = 0 ; i < ALLOCATION_AGENTS ; i++) {
+        Point p(coordinate(engine), coordinate(engine));
+        agents.push_back(Agent(p, Point(-p.x(), -p.y()), AGENT_RADIUS, AGENT_MAX_SPEED,
+            10.0 * AGENT_RADIUS, 10));
+    }
+    
+    bool passed = true;
+    
+    for (size_t s = 0 ; s < sizeof(SEARCHES) / sizeof(SEARCHES[0]) ; s++) {
+        for (const size_t THREAD_COUNT : THREAD_COUNTS) {
+            
+            Simulator simulator(agents, TAU, ALLOCATION_DELTA_T, 0.0);
+            simulator.setNeighborSearch(SEARCHES[s]);
+            simulator.setThreadCount(THREAD_COUNT);
+            
+            for (size_t k = 0 ; k < WARM_UP_STEPS ; k++) {
+                simulator.iteration();
+                simulator.moveAgents(simulator.deltaT());
+            }
+            
+            const unsigned long long BEFORE = AllocationCounter::count();
+            for (size_t k = 0 ; k < CHECKED_STEPS ; k++) {
+                simulator.iteration();
+                simulator.moveAgents(simulator.deltaT());
+                simulator.converged();
+            }
+            const unsigned long long ALLOCATIONS = AllocationCounter::count() - BEFORE;
+            
+            if (ALLOCATIONS > 0) {
+                fprintf(stderr, "%llu allocations in %u steps after warming up, with the %s search "
+                    "on %u threads\n", ALLOCATIONS, (unsigned) CHECKED_STEPS, SEARCH_NAMES[s],
+                    (unsigned) THREAD_COUNT);
+                passed = false;
+            }
+            
+        }
+    }
+    
+    return passed;
+    
+}
+
+/*
+    Main function
+*/
+
+/**
+ * The main function of the program.
+ */
+int main(void) {
+    
+    // The tests, by name
+    static const struct {
+        const char* name;
+        bool (*run)(void);
+    } TESTS[] = {
+        {"corridor", testCorridor},
+        {"allocations", testAllocations}
+    };
+    
+    size_t failures = 0;
+    
+    for (const auto& TEST : TESTS) {
+        
+        bool passed;
+        try {
+            passed = TEST.run();
+        } catch (const std::exception& e) {
+            fprintf(stderr, "%s\n", e.what());
+            passed = false;
+        }
+        
+        printf("%-14s %s\n", TEST.name, passed ? "ok" : "FAILED");
+        if (!passed) {
+            failures++;
+        }
+        
+    }
+    
+    if (failures > 0) {
+        printf("%u of %u tests failed\n", (unsigned) failures, (unsigned) (sizeof(TESTS) / sizeof(TESTS[0])));
+        return EXIT_FAILURE;
+    }
+    
+    return EXIT_SUCCESS;
+    
+}
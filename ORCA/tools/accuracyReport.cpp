@@ -0,0 +1,291 @@
+/**
+ * File  : accuracyReport.cpp
+ * Author: Raja Soufi
+ * 
+ * Compares the algebraic computation of ORCA_A|B^TAU
+ * with the trigonometric one it replaces, and prints
+ * how far apart they are and how long each takes.
+ * 
+ * The pairs of agents are drawn at random in four
+ * categories: far apart, nearly touching, overlapping,
+ * and moving at the same velocity. Each category is
+ * run with a short and a long time horizon. For every
+ * pair, the report measures the angle between the two
+ * directions, and the distance from the point of the
+ * algebraic half-plane to the boundary of the
+ * trigonometric one. It then solves the linear program
+ * of a crowd of neighbors with both sets of
+ * half-planes and measures the distance between the
+ * two solutions.
+ * 
+ * The program exits with a failure status if any of
+ * these differences exceeds its tolerance, so that it
+ * can be run as a check. It is meant to be built with
+ * the sources of orca/ and utilities/ at -O2, where
+ * undefined behavior in either path shows up.
+ */
+
+// Inclusions
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "../orca/orca.h"
+
+// Open std namespace
+using namespace std;
+
+/*
+    Constants
+*/
+
+// Number of pairs drawn in each category
+static const size_t PAIR_COUNT = 200000;
+
+// Number of neighbors in each linear program
+static const size_t NEIGHBOR_COUNT = 20;
+
+// Largest accepted angle in radians between the two
+// directions of a pair
+static const double ANGLE_TOLERANCE = 1e-6;
+
+// Largest accepted distance between the two
+// half-planes of a pair
+static const double OFFSET_TOLERANCE = 1e-6;
+
+// Largest accepted distance between the two solutions
+// of a linear program
+static const double SOLUTION_TOLERANCE = 1e-5;
+
+// Categories of pairs of agents
+enum Category {
+    FAR,
+    TANGENT,
+    OVERLAPPING,
+    SAME_VELOCITY
+};
+
+static const char* const CATEGORY_NAMES[] = {"far", "tangent", "overlapping", "same velocity"};
+
+// Whether the program was built with optimizations,
+// which the report is only meaningful with
+#ifdef __OPTIMIZE__
+static const bool OPTIMIZED = true;
+#else
+static const bool OPTIMIZED = false;
+#endif
+
+/*
+    Helpers
+*/
+
+/**
+ * Draws the neighbors of an agent of radius R_A at
+ * the origin, in the category CATEGORY.
+ * 
+ * @param CATEGORY  - The category of the pairs
+ * @param R_A       - The radius of the agent
+ * @param V_A       - The velocity of the agent
+ * @param COUNT     - The number of neighbors to draw
+ * @param random    - The random engine to draw from
+ * @param neighbors - The arrays receiving the neighbors,
+ *                    in the order px, py, vx, vy, r
+ */
+static void draw(const Category CATEGORY, const double R_A, const Vector& V_A,
+    const size_t COUNT, mt19937& random, vector<double> (&neighbors)[5])
+{
+    uniform_real_distribution<double> unit(0.0, 1.0);
+    const double PI = acos(-1.0);
+    
+    for (int k = 0; k < 5; k++) {
+        neighbors[k].resize(COUNT);
+    }
+    
+    for (size_t i = 0; i < COUNT; i++) {
+        
+        double r_B = 0.5 + 2.0 * unit(random);
+        double angle = 2.0 * PI * unit(random);
+        double distance;
+        
+        switch (CATEGORY) {
+            case FAR:
+                distance = (R_A + r_B) * (2.0 + 50.0 * unit(random));
+                break;
+            case TANGENT:
+                distance = (R_A + r_B) * (1.0 + 1e-6 * unit(random));
+                break;
+            case OVERLAPPING:
+                distance = (R_A + r_B) * (0.05 + 0.9 * unit(random));
+                break;
+            default:
+                distance = (R_A + r_B) * (1.0 + 20.0 * unit(random));
+                break;
+        }
+        
+        neighbors[0][i] = distance * cos(angle);
+        neighbors[1][i] = distance * sin(angle);
+        
+        if (CATEGORY == SAME_VELOCITY) {
+            neighbors[2][i] = V_A.x();
+            neighbors[3][i] = V_A.y();
+        } else {
+            neighbors[2][i] = 20.0 * unit(random) - 10.0;
+            neighbors[3][i] = 20.0 * unit(random) - 10.0;
+        }
+        
+        neighbors[4][i] = r_B;
+        
+    }
+}
+
+/**
+ * Returns the angle in radians between the directions
+ * of the half-planes H1 and H2.
+ * 
+ * @param H1 - The first half-plane
+ * @param H2 - The second half-plane
+ */
+static double angleBetween(const DirectedHalfPlane& H1, const DirectedHalfPlane& H2) {
+    const Vector& D1 = H1.direction();
+    const Vector& D2 = H2.direction();
+    return abs(atan2(D1.x() * D2.y() - D1.y() * D2.x(), D1.x() * D2.x() + D1.y() * D2.y()));
+}
+
+/**
+ * Runs the report for one category and one value of
+ * tau, prints a line of results, and returns whether
+ * the differences are within the tolerances.
+ * 
+ * @param CATEGORY - The category of the pairs
+ * @param TAU      - The value of tau
+ */
+static bool report(const Category CATEGORY, const double TAU) {
+    
+    mt19937 random(1 + (int) CATEGORY);
+    uniform_real_distribution<double> unit(0.0, 1.0);
+    
+    const Point P_A(0.0, 0.0);
+    const double R_A = 0.5 + 2.0 * unit(random);
+    const Vector V_A(20.0 * unit(random) - 10.0, 20.0 * unit(random) - 10.0);
+    
+    vector<double> neighbors[5];
+    draw(CATEGORY, R_A, V_A, PAIR_COUNT, random, neighbors);
+    
+    OrcaKernel::Neighbors<double> B = {neighbors[0].data(), neighbors[1].data(),
+        neighbors[2].data(), neighbors[3].data(), neighbors[4].data()};
+        
+    // Trigonometric half-planes, timed one pair at a time
+    vector<DirectedHalfPlane> trigonometric;
+    trigonometric.reserve(PAIR_COUNT);
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (size_t i = 0; i < PAIR_COUNT; i++) {
+        trigonometric.push_back(ORCA::orca_A_B_trigonometric(P_A, V_A, R_A,
+            Point(B.positionX[i], B.positionY[i]), Vector(B.velocityX[i], B.velocityY[i]),
+            B.radius[i], TAU));
+    }
+    double trigonometricTime = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+    
+    // Algebraic half-planes, timed with the scalar and the best kernels
+    vector<double> buffer(4 * PAIR_COUNT);
+    OrcaKernel::HalfPlanes<double> out = {&buffer[0], &buffer[PAIR_COUNT],
+        &buffer[2 * PAIR_COUNT], &buffer[3 * PAIR_COUNT]};
+        
+    start = chrono::steady_clock::now();
+    OrcaKernel::compute(OrcaKernel::instructionSet(), P_A.x(), P_A.y(), V_A.x(), V_A.y(), R_A,
+        B, PAIR_COUNT, TAU, out);
+    double bestTime = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+    
+    start = chrono::steady_clock::now();
+    OrcaKernel::compute(OrcaKernel::SCALAR, P_A.x(), P_A.y(), V_A.x(), V_A.y(), R_A,
+        B, PAIR_COUNT, TAU, out);
+    double scalarTime = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+    
+    // Differences between the half-planes
+    double maxAngle = 0.0, sumAngle = 0.0, maxOffset = 0.0, sumOffset = 0.0;
+    vector<DirectedHalfPlane> algebraic;
+    algebraic.reserve(PAIR_COUNT);
+    for (size_t i = 0; i < PAIR_COUNT; i++) {
+        
+        algebraic.push_back(DirectedHalfPlane(Point(out.pointX[i], out.pointY[i]),
+            Vector(out.directionX[i], out.directionY[i])));
+            
+        double angle = angleBetween(algebraic[i], trigonometric[i]);
+        double offset = abs(trigonometric[i].violation(algebraic[i].point()));
+        
+        maxAngle = max(maxAngle, angle);
+        maxOffset = max(maxOffset, offset);
+        sumAngle += angle;
+        sumOffset += offset;
+        
+    }
+    
+    // Differences between the solutions of the linear programs
+    double maxSolution = 0.0, sumSolution = 0.0;
+    size_t programCount = PAIR_COUNT / NEIGHBOR_COUNT;
+    vector<DirectedHalfPlane> bisectors, h1, h2;
+    for (size_t k = 0; k < programCount; k++) {
+        
+        h1.assign(trigonometric.begin() + k * NEIGHBOR_COUNT,
+            trigonometric.begin() + (k + 1) * NEIGHBOR_COUNT);
+        h2.assign(algebraic.begin() + k * NEIGHBOR_COUNT,
+            algebraic.begin() + (k + 1) * NEIGHBOR_COUNT);
+            
+        Point s1(0.0, 0.0), s2(0.0, 0.0);
+        ORCA::solveOrderedLinearProgram(h1, V_A, 15.0, s1, bisectors);
+        ORCA::solveOrderedLinearProgram(h2, V_A, 15.0, s2, bisectors);
+        
+        double distance = Vector(s1 - s2).norm();
+        maxSolution = max(maxSolution, distance);
+        sumSolution += distance;
+        
+    }
+    
+    printf("%-14s %5.2f | %9.2e %9.2e | %9.2e %9.2e | %9.2e %9.2e | %6.1f %6.1f %6.1f\n",
+        CATEGORY_NAMES[CATEGORY], TAU,
+        maxAngle, sumAngle / PAIR_COUNT, maxOffset, sumOffset / PAIR_COUNT,
+        maxSolution, sumSolution / programCount,
+        trigonometricTime / PAIR_COUNT, scalarTime / PAIR_COUNT, bestTime / PAIR_COUNT);
+        
+    return (maxAngle <= ANGLE_TOLERANCE) && (maxOffset <= OFFSET_TOLERANCE) &&
+        (maxSolution <= SOLUTION_TOLERANCE);
+}
+
+/*
+    Main function
+*/
+
+/**
+ * The main function of the program.
+ */
+int main(void) {
+    
+    printf("Algebraic against trigonometric ORCA_A|B^TAU, %u pairs per line, kernel %s%s\n\n",
+        (unsigned) PAIR_COUNT, OrcaKernel::instructionSetName(OrcaKernel::instructionSet()),
+        OPTIMIZED ? "" : ", NOT OPTIMIZED");
+    printf("%-14s %5s | %-19s | %-19s | %-19s | %-20s\n",
+        "category", "tau", "angle max / mean", "offset max / mean", "LP max / mean", "ns/pair trig/sc/best");
+        
+    const Category CATEGORIES[] = {FAR, TANGENT, OVERLAPPING, SAME_VELOCITY};
+    const double TAUS[] = {0.01, 2.0};
+    
+    size_t failures = 0;
+    for (int c = 0; c < 4; c++) {
+        for (int t = 0; t < 2; t++) {
+            if (!report(CATEGORIES[c], TAUS[t])) {
+                failures++;
+            }
+        }
+    }
+    
+    if (failures > 0) {
+        printf("\n%u lines exceed the tolerances (angle %.0e, offset %.0e, LP %.0e)\n",
+            (unsigned) failures, ANGLE_TOLERANCE, OFFSET_TOLERANCE, SOLUTION_TOLERANCE);
+        return EXIT_FAILURE;
+    }
+    
+    return EXIT_SUCCESS;
+    
+}
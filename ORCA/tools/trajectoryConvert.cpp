@@ -0,0 +1,192 @@
+/**
+ * File  : trajectoryConvert.cpp
+ * Author: Raja Soufi
+ * 
+ * Converts the text trajectories used to train CADRL
+ * into the binary format of trajectoryFormat.h.
+ * 
+ * A text trajectory starts with a line per agent
+ * holding its goal, radius and preferred speed:
+ * 
+ *     goal_x goal_y radius v_pref
+ * 
+ * followed by a line per frame holding the time and
+ * the position of each agent:
+ * 
+ *     time x1 y1 x2 y2 ...
+ * 
+ * Each INPUT is converted to a file with the same
+ * name and the extension .traj, next to it.
+ */
+
+// Inclusions
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../trajectory/trajectoryWriter.h"
+#include "../utilities/exceptions.h"
+
+// Open std namespace
+using namespace std;
+
+/*
+    Helpers
+*/
+
+/**
+ * Throws an exception telling that the line LINE of
+ * the file PATH could not be read.
+ * 
+ * @param PATH    - The path of the file
+ * @param LINE    - The number of the line
+ * @param MESSAGE - What is wrong with the line
+ */
+static void fail(const string& PATH, const size_t LINE, const string& MESSAGE) {
+    ostringstream message;
+    message << PATH << ":" << LINE << ": " << MESSAGE;
+    throw TrajectoryFileException(message.str());
+}
+
+/**
+ * Returns the path of the binary file converted from
+ * the text file with the path given as a parameter.
+ * 
+ * @param PATH - The path of the text file
+ */
+static string outputPath(const string& PATH) {
+    size_t dot = PATH.find_last_of('.');
+    size_t slash = PATH.find_last_of("/\\");
+    if ((dot == string::npos) || ((slash != string::npos) && (dot < slash))) {
+        return PATH + ".traj";
+    }
+    return PATH.substr(0, dot) + ".traj";
+}
+
+/**
+ * Converts the text trajectory INPUT into the binary
+ * trajectory OUTPUT, with coordinates of type T, and
+ * returns the number of frames written.
+ * 
+ * @param INPUT  - The path of the text file
+ * @param OUTPUT - The path of the binary file
+ */
+template <typename T>
+static size_t convert(const string& INPUT, const string& OUTPUT) {
+    
+    ifstream file(INPUT.c_str());
+    if (!file) {
+        throw TrajectoryFileException(INPUT + ": cannot open the file");
+    }
+    
+    vector<TrajectoryAgent> agents;
+    vector<T> x, y;
+    unique_ptr<BasicTrajectoryWriter<T> > writer;
+    string line;
+    
+    for (size_t number = 1 ; getline(file, line) ; number++) {
+        
+        istringstream entry(line);
+        vector<double> values;
+        double value;
+        while (entry >> value) {
+            values.push_back(value);
+        }
+        if (!entry.eof()) {
+            fail(INPUT, number, "expected numbers only");
+        }
+        if (values.empty()) {
+            continue;
+        }
+        
+        // Agent lines come first, with four values each, which a frame
+        // line never has since it holds an odd number of values
+        if (!writer && (values.size() == 4)) {
+            TrajectoryAgent agent;
+            agent.id = static_cast<int32_t>(agents.size());
+            agent.reserved = 0;
+            agent.goalX = values[0];
+            agent.goalY = values[1];
+            agent.radius = values[2];
+            agent.maxSpeed = values[3];
+            agents.push_back(agent);
+            continue;
+        }
+        
+        if (values.size() != 1 + 2 * agents.size()) {
+            fail(INPUT, number, "expected the time and the positions of " +
+                to_string(agents.size()) + " agents");
+        }
+        
+        if (!writer) {
+            writer.reset(new BasicTrajectoryWriter<T>(OUTPUT, agents));
+            x.resize(agents.size());
+            y.resize(agents.size());
+        }
+        
+        for (size_t i = 0 ; i < agents.size() ; i++) {
+            x[i] = static_cast<T>(values[1 + 2 * i]);
+            y[i] = static_cast<T>(values[2 + 2 * i]);
+        }
+        writer->write(values[0], x.data(), y.data());
+        
+    }
+    
+    if (!writer) {
+        throw TrajectoryFileException(INPUT + ": no frame found");
+    }
+    
+    writer->close();
+    return writer->frameCount();
+    
+}
+
+/*
+    Main function
+*/
+
+/**
+ * The main function of the program.
+ * 
+ * @param argc - The number of parameters passed to
+ *               the program
+ * @param argv - A pointer to the parameters passed
+ *               to the program
+ */
+int main(int argc, char** argv) {
+    
+    bool singlePrecision = (argc > 1) && (strcmp(argv[1], "--float") == 0);
+    int first = singlePrecision ? 2 : 1;
+    
+    if (first >= argc) {
+        fprintf(stderr, "Usage: %s [--float] INPUT...\n", argv[0]);
+        return 1;
+    }
+    
+    int failures = 0;
+    
+    for (int i = first ; i < argc ; i++) {
+        string output = outputPath(argv[i]);
+        if (output == argv[i]) {
+            fprintf(stderr, "%s: already a binary trajectory\n", argv[i]);
+            failures++;
+            continue;
+        }
+        try {
+            size_t frames = singlePrecision ? convert<float>(argv[i], output) : convert<double>(argv[i], output);
+            printf("%s -> %s, %u frames\n", argv[i], output.c_str(), (unsigned) frames);
+        } catch (const exception& e) {
+            fprintf(stderr, "%s\n", e.what());
+            remove(output.c_str());
+            failures++;
+        }
+    }
+    
+    return (failures == 0) ? 0 : 1;
+    
+}
@@ -0,0 +1,213 @@
+/**
+ * File  : trajectoryFile.cpp
+ * Author: Raja Soufi
+ * 
+ * Implementation of the TrajectoryFile class defined
+ * in trajectoryFile.h.
+ */
+
+// Include header file
+#include "trajectoryFile.h"
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif // _WIN32
+
+#include "../utilities/exceptions.h"
+
+/*
+    Constructor
+*/
+
+/**
+ * Maps the file with the path given as a parameter
+ * into memory, and checks that it is a complete
+ * trajectory file with coordinates of type T.
+ * 
+ * @param PATH - The path of the file
+ */
+template <typename T>
+BasicTrajectoryFile<T>::BasicTrajectoryFile(const std::string& PATH) :
+    data_(NULL), size_(0)
+    #ifdef _WIN32
+    , file_(NULL), mapping_(NULL)
+    #endif // _WIN32
+{
+    this->map(PATH);
+    
+    std::string error;
+    const TrajectoryHeader& header = *reinterpret_cast<const TrajectoryHeader*>(this->data_);
+    
+    if ((this->size_ < sizeof(TrajectoryHeader)) ||
+        (std::memcmp(header.magic, TRAJECTORY_MAGIC, sizeof(TRAJECTORY_MAGIC)) != 0))
+    {
+        error = "not a trajectory file";
+    }
+    else if (header.byteOrder != TRAJECTORY_BYTE_ORDER) {
+        error = "written with another byte order";
+    }
+    else if (header.version != TRAJECTORY_VERSION) {
+        error = "unsupported version " + std::to_string(header.version);
+    }
+    else if (header.scalarSize != sizeof(T)) {
+        error = "holds coordinates of " + std::to_string(header.scalarSize) +
+            " bytes instead of " + std::to_string(sizeof(T));
+    }
+    else if (header.indexOffset == 0) {
+        error = "the writer did not close the file";
+    }
+    else if ((header.frameStride != trajectoryFrameStride(header.agentCount, sizeof(T))) ||
+        (header.agentOffset + header.agentCount * sizeof(TrajectoryAgent) > header.frameOffset) ||
+        (header.frameOffset % sizeof(double) != 0) ||
+        (header.indexOffset != header.frameOffset + header.frameCount * header.frameStride) ||
+        (header.indexOffset + header.frameCount * sizeof(TrajectoryIndexEntry) > this->size_))
+    {
+        error = "truncated or corrupted";
+    }
+    
+    if (!error.empty()) {
+        this->unmap();
+        throw TrajectoryFileException(PATH + ": " + error);
+    }
+}
+
+/*
+    Destructor
+*/
+
+/**
+ * Unmaps the file.
+ */
+template <typename T>
+BasicTrajectoryFile<T>::~BasicTrajectoryFile(void) {
+    this->unmap();
+}
+
+/*
+    Other methods
+*/
+
+/**
+ * Returns the index of the last frame whose time is
+ * not after TIME, or 0 if they all are. The frame
+ * index is searched, so that only its pages are
+ * touched.
+ * 
+ * @param TIME - The time to look for
+ */
+template <typename T>
+size_t BasicTrajectoryFile<T>::frameAt(const double TIME) const {
+    
+    const TrajectoryIndexEntry* BEGIN =
+        reinterpret_cast<const TrajectoryIndexEntry*>(this->data_ + this->header().indexOffset);
+    const TrajectoryIndexEntry* END = BEGIN + this->frameCount();
+    
+    const TrajectoryIndexEntry* after = std::upper_bound(BEGIN, END, TIME,
+        [](const double VALUE, const TrajectoryIndexEntry& ENTRY) { return VALUE < ENTRY.time; });
+        
+    return (after == BEGIN) ? 0 : static_cast<size_t>(after - BEGIN) - 1;
+    
+}
+
+/*
+    Helpers
+*/
+
+/**
+ * Maps the whole file with the path given as a
+ * parameter into memory, read-only.
+ * 
+ * @param PATH - The path of the file
+ */
+template <typename T>
+void BasicTrajectoryFile<T>::map(const std::string& PATH) {
+    
+    #ifdef _WIN32
+    
+    HANDLE file = CreateFileA(PATH.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL, NULL);
+    LARGE_INTEGER size;
+    if ((file == INVALID_HANDLE_VALUE) || !GetFileSizeEx(file, &size) || (size.QuadPart == 0)) {
+        if (file != INVALID_HANDLE_VALUE) {
+            CloseHandle(file);
+        }
+        throw TrajectoryFileException(PATH + ": cannot open the file");
+    }
+    
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    const void* data = (mapping == NULL) ? NULL : MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (data == NULL) {
+        if (mapping != NULL) {
+            CloseHandle(mapping);
+        }
+        CloseHandle(file);
+        throw TrajectoryFileException(PATH + ": cannot map the file");
+    }
+    
+    this->file_ = file;
+    this->mapping_ = mapping;
+    this->data_ = static_cast<const unsigned char*>(data);
+    this->size_ = static_cast<size_t>(size.QuadPart);
+    
+    #else
+    
+    int file = open(PATH.c_str(), O_RDONLY);
+    struct stat status;
+    if ((file < 0) || (fstat(file, &status) != 0) || (status.st_size == 0)) {
+        if (file >= 0) {
+            ::close(file);
+        }
+        throw TrajectoryFileException(PATH + ": cannot open the file");
+    }
+    
+    void* data = mmap(NULL, static_cast<size_t>(status.st_size), PROT_READ, MAP_SHARED, file, 0);
+    ::close(file);
+    if (data == MAP_FAILED) {
+        throw TrajectoryFileException(PATH + ": cannot map the file");
+    }
+    
+    this->data_ = static_cast<const unsigned char*>(data);
+    this->size_ = static_cast<size_t>(status.st_size);
+    
+    #endif // _WIN32
+    
+}
+
+/**
+ * Unmaps the file, if it is mapped.
+ */
+template <typename T>
+void BasicTrajectoryFile<T>::unmap(void) {
+    
+    if (this->data_ == NULL) {
+        return;
+    }
+    
+    #ifdef _WIN32
+    UnmapViewOfFile(this->data_);
+    CloseHandle(this->mapping_);
+    CloseHandle(this->file_);
+    this->file_ = this->mapping_ = NULL;
+    #else
+    munmap(const_cast<unsigned char*>(this->data_), this->size_);
+    #endif // _WIN32
+    
+    this->data_ = NULL;
+    this->size_ = 0;
+    
+}
+
+/*
+    Explicit instantiations
+*/
+
+template class BasicTrajectoryFile<float>;
+template class BasicTrajectoryFile<double>;
@@ -0,0 +1,159 @@
+/**
+ * File  : trajectoryFile.h
+ * Author: Raja Soufi
+ * 
+ * Class definition of a binary trajectory file, as
+ * described in trajectoryFormat.h, mapped read-only
+ * into memory.
+ * 
+ * Nothing is copied or parsed when the file is
+ * opened apart from the header, which is checked
+ * against the size of the file. The agents, frames
+ * and index are read in place, the operating system
+ * only loading the pages that are touched. The
+ * coordinates must be of the scalar type T of the
+ * reader.
+ */
+
+// Include guard
+#ifndef _TRAJECTORY_FILE_H_
+#define _TRAJECTORY_FILE_H_
+
+// Inclusions
+#include <cstddef>
+#include <string>
+
+#include "../geom/point.h"
+
+#include "trajectoryFormat.h"
+
+// Class definition
+template <typename T>
+class BasicTrajectoryFile {
+    
+    private:
+    
+    // Attributes
+    const unsigned char* data_;
+    size_t size_;
+    
+    #ifdef _WIN32
+    void* file_;
+    void* mapping_;
+    #endif // _WIN32
+    
+    // Copy constructor and assignment
+    BasicTrajectoryFile(const BasicTrajectoryFile& THAT);
+    BasicTrajectoryFile& operator=(const BasicTrajectoryFile& THAT);
+    
+    // Helpers
+    void map(const std::string& PATH);
+    void unmap(void);
+    inline const TrajectoryHeader& header(void) const;
+    
+    public:
+    
+    // Constructor
+    BasicTrajectoryFile(const std::string& PATH);
+    
+    // Destructor
+    ~BasicTrajectoryFile(void);
+    
+    // Getters
+    inline size_t agentCount(void) const;
+    inline size_t frameCount(void) const;
+    inline const TrajectoryAgent& agent(const size_t I) const;
+    inline double time(const size_t FRAME) const;
+    inline const T* positions(const size_t FRAME) const;
+    inline BasicPoint<T> position(const size_t FRAME, const size_t I) const;
+    
+    // Other methods
+    size_t frameAt(const double TIME) const;
+    
+};
+
+// Precisions
+typedef BasicTrajectoryFile<float> TrajectoryFileF;
+typedef BasicTrajectoryFile<double> TrajectoryFile;
+
+/*
+    Getters
+*/
+
+/**
+ * Returns the number of agents in each frame.
+ */
+template <typename T>
+inline size_t BasicTrajectoryFile<T>::agentCount(void) const {
+    return this->header().agentCount;
+}
+
+/**
+ * Returns the number of frames in this file.
+ */
+template <typename T>
+inline size_t BasicTrajectoryFile<T>::frameCount(void) const {
+    return static_cast<size_t>(this->header().frameCount);
+}
+
+/**
+ * Returns the description of the I-th agent.
+ * 
+ * @param I - The index of the agent
+ */
+template <typename T>
+inline const TrajectoryAgent& BasicTrajectoryFile<T>::agent(const size_t I) const {
+    return reinterpret_cast<const TrajectoryAgent*>(this->data_ + this->header().agentOffset)[I];
+}
+
+/**
+ * Returns the time of the frame with the index
+ * given as a parameter.
+ * 
+ * @param FRAME - The index of the frame
+ */
+template <typename T>
+inline double BasicTrajectoryFile<T>::time(const size_t FRAME) const {
+    return *reinterpret_cast<const double*>(this->data_ + this->header().frameOffset +
+        FRAME * this->header().frameStride);
+}
+
+/**
+ * Returns the coordinates of the agents in the
+ * frame with the index given as a parameter, in the
+ * order x0 y0 x1 y1 ...
+ * 
+ * @param FRAME - The index of the frame
+ */
+template <typename T>
+inline const T* BasicTrajectoryFile<T>::positions(const size_t FRAME) const {
+    return reinterpret_cast<const T*>(this->data_ + this->header().frameOffset +
+        FRAME * this->header().frameStride + sizeof(double));
+}
+
+/**
+ * Returns the position of the I-th agent in the
+ * frame with the index given as a parameter.
+ * 
+ * @param FRAME - The index of the frame
+ * @param I     - The index of the agent
+ */
+template <typename T>
+inline BasicPoint<T> BasicTrajectoryFile<T>::position(const size_t FRAME, const size_t I) const {
+    const T* coordinates = this->positions(FRAME);
+    return BasicPoint<T>(coordinates[2 * I], coordinates[2 * I + 1]);
+}
+
+/*
+    Helpers
+*/
+
+/**
+ * Returns the header of this file.
+ */
+template <typename T>
+inline const TrajectoryHeader& BasicTrajectoryFile<T>::header(void) const {
+    return *reinterpret_cast<const TrajectoryHeader*>(this->data_);
+}
+
+#endif // _TRAJECTORY_FILE_H_
@@ -0,0 +1,124 @@
+/**
+ * File  : trajectoryFormat.h
+ * Author: Raja Soufi
+ * 
+ * Layout of the binary trajectory files, meant to be
+ * mapped into memory and read in place, from C++ or
+ * with numpy.memmap. A file is made of:
+ * 
+ *     - a TrajectoryHeader, at offset 0;
+ *     - a TrajectoryAgent per agent, at agentOffset;
+ *     - the frames, at frameOffset, each frameStride
+ *       bytes long, holding the time as a double and
+ *       then x0 y0 x1 y1 ... as scalars of
+ *       scalarSize bytes;
+ *     - a TrajectoryIndexEntry per frame, at
+ *       indexOffset, giving the time and the offset
+ *       of each frame.
+ * 
+ * The frames start on a 64 byte boundary and their
+ * stride is a multiple of 8 bytes, so that every
+ * value is aligned. All values are stored in the
+ * byte order of the writing machine, which the
+ * byteOrder field lets readers check; every target
+ * of this project is little-endian. The index is
+ * written when the file is closed, an indexOffset
+ * of zero telling that the writer did not finish.
+ */
+
+// Include guard
+#ifndef _TRAJECTORY_FORMAT_H_
+#define _TRAJECTORY_FORMAT_H_
+
+// Inclusions
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/*
+    Constants
+*/
+
+// The first bytes of every trajectory file
+static const char TRAJECTORY_MAGIC[8] = {'O', 'R', 'C', 'A', 'T', 'R', 'A', 'J'};
+
+// The version of the layout described here
+static const uint32_t TRAJECTORY_VERSION = 1;
+
+// The byte order marker, as written by the machine
+static const uint32_t TRAJECTORY_BYTE_ORDER = 0x01020304;
+
+// The alignment of the first frame
+static const size_t TRAJECTORY_FRAME_ALIGNMENT = 64;
+
+/*
+    Records
+*/
+
+// Header at the start of a trajectory file
+struct TrajectoryHeader {
+    char magic[8];
+    uint32_t byteOrder;
+    uint32_t version;
+    uint32_t scalarSize;
+    uint32_t agentCount;
+    uint64_t frameCount;
+    uint64_t frameStride;
+    uint64_t agentOffset;
+    uint64_t frameOffset;
+    uint64_t indexOffset;
+};
+
+// Description of an agent, which does not change
+// from one frame to the next
+struct TrajectoryAgent {
+    int32_t id;
+    uint32_t reserved;
+    double goalX, goalY;
+    double radius;
+    double maxSpeed;
+};
+
+// Entry of the frame index
+struct TrajectoryIndexEntry {
+    double time;
+    uint64_t offset;
+};
+
+// Layout
+static_assert(sizeof(TrajectoryHeader) == 64, "TrajectoryHeader must be 64 bytes");
+static_assert(sizeof(TrajectoryAgent) == 40, "TrajectoryAgent must be 40 bytes");
+static_assert(sizeof(TrajectoryIndexEntry) == 16, "TrajectoryIndexEntry must be 16 bytes");
+static_assert(std::is_trivially_copyable<TrajectoryHeader>::value &&
+    std::is_trivially_copyable<TrajectoryAgent>::value &&
+    std::is_trivially_copyable<TrajectoryIndexEntry>::value,
+    "Trajectory records must be trivially copyable");
+    
+/*
+    Helpers
+*/
+
+/**
+ * Returns the number of bytes taken by a frame of
+ * AGENT_COUNT agents whose coordinates are
+ * SCALAR_SIZE bytes long, rounded up to 8 bytes.
+ * 
+ * @param AGENT_COUNT - The number of agents
+ * @param SCALAR_SIZE - The size of a coordinate
+ */
+inline constexpr uint64_t trajectoryFrameStride(const uint64_t AGENT_COUNT, const uint64_t SCALAR_SIZE) {
+    return (sizeof(double) + 2 * AGENT_COUNT * SCALAR_SIZE + 7) / 8 * 8;
+}
+
+/**
+ * Returns the offset of the first frame of a file
+ * holding AGENT_COUNT agents.
+ * 
+ * @param AGENT_COUNT - The number of agents
+ */
+inline constexpr uint64_t trajectoryFrameOffset(const uint64_t AGENT_COUNT) {
+    return (sizeof(TrajectoryHeader) + AGENT_COUNT * sizeof(TrajectoryAgent) +
+        TRAJECTORY_FRAME_ALIGNMENT - 1) / TRAJECTORY_FRAME_ALIGNMENT * TRAJECTORY_FRAME_ALIGNMENT;
+}
+
+#endif // _TRAJECTORY_FORMAT_H_
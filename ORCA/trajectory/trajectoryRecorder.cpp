@@ -0,0 +1,244 @@
+/**
+ * File  : trajectoryRecorder.cpp
+ * Author: Raja Soufi
+ * 
+ * Implementation of the TrajectoryRecorder class
+ * defined in trajectoryRecorder.h.
+ */
+
+// Include header file
+#include "trajectoryRecorder.h"
+
+#include <algorithm>
+#include <chrono>
+
+/*
+    Constructor
+*/
+
+/**
+ * Creates the trajectory file with the path given as
+ * a parameter for the agents given as a parameter,
+ * allocates the buffers and starts the thread
+ * writing them.
+ * 
+ * @param PATH         - The path of the file
+ * @param AGENTS       - The agents to record
+ * @param BUFFER_COUNT - The number of frames that can
+ *                       wait to be written
+ * @param EVERY        - Only one frame out of EVERY
+ *                       given to record is kept
+ * @param OVERFLOW     - What to do with a frame when
+ *                       every buffer is in use
+ */
+template <typename T>
+BasicTrajectoryRecorder<T>::BasicTrajectoryRecorder(const std::string& PATH,
+    const BasicAgentStore<T>& AGENTS, const size_t BUFFER_COUNT, const size_t EVERY,
+    const Overflow OVERFLOW) :
+    writer_(PATH, AGENTS),
+    frames_(new Frame[std::max<size_t>(BUFFER_COUNT, 1)]),
+    capacity_(std::max<size_t>(BUFFER_COUNT, 1)),
+    every_(std::max<size_t>(EVERY, 1)),
+    overflow_(OVERFLOW),
+    head_(0), tail_(0),
+    mutex_(), filled_(), drained_(),
+    stopping_(false),
+    statistics_(),
+    written_(0),
+    error_(),
+    thread_()
+{
+    for (size_t i = 0 ; i < this->capacity_ ; i++) {
+        this->frames_[i].time = 0.0;
+        this->frames_[i].x.resize(AGENTS.size());
+        this->frames_[i].y.resize(AGENTS.size());
+    }
+    
+    this->thread_ = std::thread(&BasicTrajectoryRecorder::drain, this);
+}
+
+/*
+    Destructor
+*/
+
+/**
+ * Writes the frames still waiting and closes the
+ * file. Errors cannot be reported from here, so
+ * callers who care about them should call close
+ * themselves.
+ */
+template <typename T>
+BasicTrajectoryRecorder<T>::~BasicTrajectoryRecorder(void) {
+    try {
+        this->close();
+    } catch (const std::exception&) {}
+}
+
+/*
+    Getters
+*/
+
+/**
+ * Returns the counters of what happened to the
+ * frames given to this recorder so far. Must be
+ * called from the thread calling record.
+ */
+template <typename T>
+typename BasicTrajectoryRecorder<T>::Statistics BasicTrajectoryRecorder<T>::statistics(void) const {
+    Statistics statistics = this->statistics_;
+    statistics.written = this->written_.load(std::memory_order_acquire);
+    return statistics;
+}
+
+/*
+    Other methods
+*/
+
+/**
+ * Hands the positions of the agents given as a
+ * parameter at time TIME over to the writing thread.
+ * Only one call out of every EVERY records a frame.
+ * The positions are copied into a free buffer, and
+ * when there is none the frame is either dropped or
+ * waited for, depending on the overflow policy.
+ * Nothing is written to the file from here.
+ * 
+ * @param TIME   - The time of the frame
+ * @param AGENTS - The agents, in the same order as
+ *                 when the recorder was created
+ */
+template <typename T>
+void BasicTrajectoryRecorder<T>::record(const double TIME, const BasicAgentStore<T>& AGENTS) {
+    
+    if (this->statistics_.offered++ % this->every_ != 0) {
+        this->statistics_.skipped++;
+        return;
+    }
+    
+    const size_t HEAD = this->head_.load(std::memory_order_relaxed);
+    
+    // Wait for, or give up on, a free buffer
+    if (HEAD - this->tail_.load(std::memory_order_acquire) == this->capacity_) {
+        
+        if (this->overflow_ == BasicTrajectoryRecorder::DROP) {
+            this->statistics_.dropped++;
+            return;
+        }
+        
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        {
+            std::unique_lock<std::mutex> lock(this->mutex_);
+            this->drained_.wait(lock, [this, HEAD]() {
+                return HEAD - this->tail_.load(std::memory_order_acquire) < this->capacity_;
+            });
+        }
+        this->statistics_.stalls++;
+        this->statistics_.stallSeconds +=
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            
+    }
+    
+    // Fill the buffer and publish it
+    Frame& frame = this->frames_[HEAD % this->capacity_];
+    frame.time = TIME;
+    std::copy(AGENTS.positionX(), AGENTS.positionX() + frame.x.size(), frame.x.begin());
+    std::copy(AGENTS.positionY(), AGENTS.positionY() + frame.y.size(), frame.y.begin());
+    
+    this->head_.store(HEAD + 1, std::memory_order_release);
+    this->statistics_.queued++;
+    this->statistics_.highWater = std::max(this->statistics_.highWater,
+        HEAD + 1 - this->tail_.load(std::memory_order_relaxed));
+        
+    // Wake the writing thread up if it is waiting
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+    }
+    this->filled_.notify_one();
+    
+}
+
+/**
+ * Waits for every frame handed over to be written,
+ * stops the writing thread and closes the file.
+ * Rethrows the first error met while writing. Does
+ * nothing if the recorder is already closed.
+ */
+template <typename T>
+void BasicTrajectoryRecorder<T>::close(void) {
+    
+    if (!this->thread_.joinable()) {
+        return;
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        this->stopping_ = true;
+    }
+    this->filled_.notify_one();
+    this->thread_.join();
+    
+    if (this->error_) {
+        std::rethrow_exception(this->error_);
+    }
+    this->writer_.close();
+    
+}
+
+/*
+    Helpers
+*/
+
+/**
+ * Runs on the writing thread, writing the buffers
+ * in the order they were filled until the recorder
+ * is closed and the ring is empty. After an error,
+ * the buffers are still drained so that the
+ * simulation thread never waits forever, but no
+ * longer written.
+ */
+template <typename T>
+void BasicTrajectoryRecorder<T>::drain(void) {
+    
+    for (;;) {
+        
+        const size_t TAIL = this->tail_.load(std::memory_order_relaxed);
+        
+        // Sleep until a buffer is filled or the recorder is closed
+        if (this->head_.load(std::memory_order_acquire) == TAIL) {
+            std::unique_lock<std::mutex> lock(this->mutex_);
+            this->filled_.wait(lock, [this, TAIL]() {
+                return this->stopping_ || (this->head_.load(std::memory_order_acquire) != TAIL);
+            });
+            if (this->head_.load(std::memory_order_acquire) == TAIL) {
+                return;
+            }
+        }
+        
+        const Frame& FRAME = this->frames_[TAIL % this->capacity_];
+        
+        if (!this->error_) {
+            try {
+                this->writer_.write(FRAME.time, FRAME.x.data(), FRAME.y.data());
+                this->written_.fetch_add(1, std::memory_order_release);
+            } catch (...) {
+                this->error_ = std::current_exception();
+            }
+        }
+        
+        // Give the buffer back
+        this->tail_.store(TAIL + 1, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+        }
+        this->drained_.notify_one();
+        
+    }
+    
+}
+
+/*
+    Explicit instantiations
+*/
+
+template class BasicTrajectoryRecorder<float>;
+template class BasicTrajectoryRecorder<double>;
@@ -0,0 +1,125 @@
+/**
+ * File  : trajectoryRecorder.h
+ * Author: Raja Soufi
+ * 
+ * Class definition of a recorder writing binary
+ * trajectories from a background thread, so that the
+ * simulation thread never waits on the disk.
+ * 
+ * The simulation thread copies each recorded frame
+ * into a ring of buffers allocated up front, and a
+ * thread owned by the recorder drains the ring into
+ * a TrajectoryWriter. The ring is shared by a single
+ * producer and a single consumer, which only go
+ * through the mutex to sleep and wake each other.
+ * When the disk falls behind and the ring is full,
+ * the producer either waits for a buffer or drops
+ * the frame, and keeps count of it.
+ */
+
+// Include guard
+#ifndef _TRAJECTORY_RECORDER_H_
+#define _TRAJECTORY_RECORDER_H_
+
+// Inclusions
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../orca/agentStore.h"
+
+#include "trajectoryWriter.h"
+
+// Counters of what happened to the frames given to
+// a recorder: offered to it, skipped by decimation,
+// queued for writing, dropped for lack of a buffer,
+// and written. The stalls are the times the producer
+// waited for a buffer, and the high water mark is
+// the largest number of frames waiting at once.
+struct TrajectoryRecorderStatistics {
+    size_t offered;
+    size_t skipped;
+    size_t queued;
+    size_t dropped;
+    size_t written;
+    size_t stalls;
+    double stallSeconds;
+    size_t highWater;
+};
+
+// Class definition
+template <typename T>
+class BasicTrajectoryRecorder {
+    
+    public:
+    
+    // What to do with a frame when every buffer is in use
+    enum Overflow {
+        BLOCK,
+        DROP
+    };
+    
+    // Counters of what happened to the frames
+    typedef TrajectoryRecorderStatistics Statistics;
+    
+    private:
+    
+    // Buffer holding a frame on its way to the disk
+    struct Frame {
+        double time;
+        std::vector<T> x, y;
+    };
+    
+    // Attributes
+    BasicTrajectoryWriter<T> writer_;
+    std::unique_ptr<Frame[]> frames_;
+    size_t capacity_;
+    size_t every_;
+    Overflow overflow_;
+    
+    std::atomic<size_t> head_, tail_;
+    std::mutex mutex_;
+    std::condition_variable filled_, drained_;
+    bool stopping_;
+    
+    Statistics statistics_;
+    std::atomic<size_t> written_;
+    std::exception_ptr error_;
+    std::thread thread_;
+    
+    // Helpers
+    void drain(void);
+    
+    // Non-copyable
+    BasicTrajectoryRecorder(const BasicTrajectoryRecorder& THAT);
+    BasicTrajectoryRecorder& operator=(const BasicTrajectoryRecorder& THAT);
+    
+    public:
+    
+    // Constructor
+    BasicTrajectoryRecorder(const std::string& PATH, const BasicAgentStore<T>& AGENTS,
+        const size_t BUFFER_COUNT, const size_t EVERY = 1, const Overflow OVERFLOW = BLOCK);
+        
+    // Destructor
+    ~BasicTrajectoryRecorder(void);
+    
+    // Getters
+    Statistics statistics(void) const;
+    
+    // Other methods
+    void record(const double TIME, const BasicAgentStore<T>& AGENTS);
+    void close(void);
+    
+};
+
+// Precisions
+typedef BasicTrajectoryRecorder<float> TrajectoryRecorderF;
+typedef BasicTrajectoryRecorder<double> TrajectoryRecorder;
+
+#endif // _TRAJECTORY_RECORDER_H_
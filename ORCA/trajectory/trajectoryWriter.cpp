@@ -0,0 +1,241 @@
+/**
+ * File  : trajectoryWriter.cpp
+ * Author: Raja Soufi
+ * 
+ * Implementation of the TrajectoryWriter class
+ * defined in trajectoryWriter.h.
+ */
+
+// Include header file
+#include "trajectoryWriter.h"
+
+#include <cstring>
+
+#include "../utilities/exceptions.h"
+
+/*
+    Constructors
+*/
+
+/**
+ * Creates the file with the path given as a
+ * parameter, replacing any file already there, and
+ * writes the description of the agents given as a
+ * parameter to it.
+ * 
+ * @param PATH   - The path of the file
+ * @param AGENTS - The description of the agents
+ */
+template <typename T>
+BasicTrajectoryWriter<T>::BasicTrajectoryWriter(const std::string& PATH,
+    const std::vector<TrajectoryAgent>& AGENTS) :
+    path_(PATH), file_(NULL), header_(), frame_(), index_()
+{
+    this->file_ = fopen(PATH.c_str(), "wb");
+    if (this->file_ == NULL) {
+        throw TrajectoryFileException(PATH + ": cannot open the file for writing");
+    }
+    
+    std::memcpy(this->header_.magic, TRAJECTORY_MAGIC, sizeof(TRAJECTORY_MAGIC));
+    this->header_.byteOrder = TRAJECTORY_BYTE_ORDER;
+    this->header_.version = TRAJECTORY_VERSION;
+    this->header_.scalarSize = sizeof(T);
+    this->header_.agentCount = static_cast<uint32_t>(AGENTS.size());
+    this->header_.frameCount = 0;
+    this->header_.frameStride = trajectoryFrameStride(AGENTS.size(), sizeof(T));
+    this->header_.agentOffset = sizeof(TrajectoryHeader);
+    this->header_.frameOffset = trajectoryFrameOffset(AGENTS.size());
+    this->header_.indexOffset = 0;
+    
+    this->frame_.assign(this->header_.frameStride, 0);
+    
+    // Write the header, the agents, and the padding up
+    // to the first frame
+    std::vector<unsigned char> prefix(this->header_.frameOffset, 0);
+    std::memcpy(prefix.data(), &this->header_, sizeof(TrajectoryHeader));
+    if (!AGENTS.empty()) {
+        std::memcpy(prefix.data() + this->header_.agentOffset, AGENTS.data(),
+            AGENTS.size() * sizeof(TrajectoryAgent));
+    }
+    this->writeAt(0, prefix.data(), prefix.size());
+}
+
+/**
+ * Creates the file with the path given as a
+ * parameter for the agents given as a parameter.
+ * 
+ * @param PATH   - The path of the file
+ * @param AGENTS - The agents whose trajectories will
+ *                 be written
+ */
+template <typename T>
+BasicTrajectoryWriter<T>::BasicTrajectoryWriter(const std::string& PATH,
+    const BasicAgentStore<T>& AGENTS) :
+    BasicTrajectoryWriter(PATH, BasicTrajectoryWriter::describe(AGENTS))
+{}
+
+/*
+    Destructor
+*/
+
+/**
+ * Closes the file if it is still open. Errors
+ * cannot be reported from here, so callers who care
+ * about them should call close themselves.
+ */
+template <typename T>
+BasicTrajectoryWriter<T>::~BasicTrajectoryWriter(void) {
+    try {
+        this->close();
+    } catch (const TrajectoryFileException&) {}
+}
+
+/*
+    Other methods
+*/
+
+/**
+ * Appends a frame holding the positions of the
+ * agents at time TIME, given as two arrays of
+ * agentCount() coordinates.
+ * 
+ * @param TIME - The time of the frame
+ * @param X    - The x-coordinates of the agents
+ * @param Y    - The y-coordinates of the agents
+ */
+template <typename T>
+void BasicTrajectoryWriter<T>::write(const double TIME, const T* X, const T* Y) {
+    
+    if (this->file_ == NULL) {
+        throw TrajectoryFileException(this->path_ + ": the file is already closed");
+    }
+    
+    unsigned char* frame = this->frame_.data();
+    std::memcpy(frame, &TIME, sizeof(double));
+    
+    T* coordinates = reinterpret_cast<T*>(frame + sizeof(double));
+    for (size_t i = 0 ; i < this->header_.agentCount ; i++) {
+        coordinates[2 * i] = X[i];
+        coordinates[2 * i + 1] = Y[i];
+    }
+    
+    TrajectoryIndexEntry entry;
+    entry.time = TIME;
+    entry.offset = this->header_.frameOffset + this->index_.size() * this->header_.frameStride;
+    
+    if (fwrite(frame, 1, this->frame_.size(), this->file_) != this->frame_.size()) {
+        this->fail("cannot write a frame");
+    }
+    this->index_.push_back(entry);
+    
+}
+
+/**
+ * Appends a frame holding the positions of the
+ * agents given as a parameter at time TIME.
+ * 
+ * @param TIME   - The time of the frame
+ * @param AGENTS - The agents, in the same order as
+ *                 when the file was created
+ */
+template <typename T>
+void BasicTrajectoryWriter<T>::write(const double TIME, const BasicAgentStore<T>& AGENTS) {
+    this->write(TIME, AGENTS.positionX(), AGENTS.positionY());
+}
+
+/**
+ * Writes the frame index and the final header, and
+ * closes the file. Does nothing if the file is
+ * already closed.
+ */
+template <typename T>
+void BasicTrajectoryWriter<T>::close(void) {
+    
+    if (this->file_ == NULL) {
+        return;
+    }
+    
+    this->header_.frameCount = this->index_.size();
+    this->header_.indexOffset = this->header_.frameOffset +
+        this->header_.frameCount * this->header_.frameStride;
+        
+    if (!this->index_.empty() && (fwrite(this->index_.data(), sizeof(TrajectoryIndexEntry),
+        this->index_.size(), this->file_) != this->index_.size()))
+    {
+        this->fail("cannot write the frame index");
+    }
+    this->writeAt(0, &this->header_, sizeof(TrajectoryHeader));
+    
+    FILE* file = this->file_;
+    this->file_ = NULL;
+    if (fclose(file) != 0) {
+        throw TrajectoryFileException(this->path_ + ": cannot close the file");
+    }
+    
+}
+
+/**
+ * Returns the description of the agents given as a
+ * parameter, as stored in a trajectory file.
+ * 
+ * @param AGENTS - The agents to describe
+ */
+template <typename T>
+std::vector<TrajectoryAgent> BasicTrajectoryWriter<T>::describe(const BasicAgentStore<T>& AGENTS) {
+    
+    std::vector<TrajectoryAgent> agents(AGENTS.size());
+    
+    for (size_t i = 0 ; i < AGENTS.size() ; i++) {
+        agents[i].id = AGENTS.id(i);
+        agents[i].reserved = 0;
+        agents[i].goalX = AGENTS.destination(i).x();
+        agents[i].goalY = AGENTS.destination(i).y();
+        agents[i].radius = AGENTS.radius(i);
+        agents[i].maxSpeed = AGENTS.maxSpeed(i);
+    }
+    
+    return agents;
+    
+}
+
+/*
+    Helpers
+*/
+
+/**
+ * Writes SIZE bytes of DATA at the offset OFFSET of
+ * the file, and moves back to its end.
+ * 
+ * @param OFFSET - Where to write in the file
+ * @param DATA   - The bytes to write
+ * @param SIZE   - The number of bytes to write
+ */
+template <typename T>
+void BasicTrajectoryWriter<T>::writeAt(const uint64_t OFFSET, const void* DATA, const size_t SIZE) {
+    if ((fseek(this->file_, static_cast<long>(OFFSET), SEEK_SET) != 0) ||
+        (fwrite(DATA, 1, SIZE, this->file_) != SIZE) ||
+        (fseek(this->file_, 0, SEEK_END) != 0))
+    {
+        this->fail("cannot write the header");
+    }
+}
+
+/**
+ * Closes the file and throws an exception telling
+ * what could not be done.
+ * 
+ * @param MESSAGE - What could not be done
+ */
+template <typename T>
+void BasicTrajectoryWriter<T>::fail(const std::string& MESSAGE) {
+    fclose(this->file_);
+    this->file_ = NULL;
+    throw TrajectoryFileException(this->path_ + ": " + MESSAGE);
+}
+
+/*
+    Explicit instantiations
+*/
+
+template class BasicTrajectoryWriter<float>;
+template class BasicTrajectoryWriter<double>;
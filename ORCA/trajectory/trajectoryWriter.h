@@ -0,0 +1,95 @@
+/**
+ * File  : trajectoryWriter.h
+ * Author: Raja Soufi
+ * 
+ * Class definition of a writer of the binary
+ * trajectory files described in trajectoryFormat.h.
+ * 
+ * The frames are appended one at a time, with the
+ * coordinates of the scalar type T, float or double.
+ * The index is kept in memory and written, along
+ * with the final header, when the file is closed.
+ */
+
+// Include guard
+#ifndef _TRAJECTORY_WRITER_H_
+#define _TRAJECTORY_WRITER_H_
+
+// Inclusions
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "../orca/agentStore.h"
+
+#include "trajectoryFormat.h"
+
+// Class definition
+template <typename T>
+class BasicTrajectoryWriter {
+    
+    private:
+    
+    // Attributes
+    std::string path_;
+    FILE* file_;
+    TrajectoryHeader header_;
+    std::vector<unsigned char> frame_;
+    std::vector<TrajectoryIndexEntry> index_;
+    
+    // Copy constructor and assignment
+    BasicTrajectoryWriter(const BasicTrajectoryWriter& THAT);
+    BasicTrajectoryWriter& operator=(const BasicTrajectoryWriter& THAT);
+    
+    // Helpers
+    void writeAt(const uint64_t OFFSET, const void* DATA, const size_t SIZE);
+    void fail(const std::string& MESSAGE);
+    
+    public:
+    
+    // Constructors
+    BasicTrajectoryWriter(const std::string& PATH, const std::vector<TrajectoryAgent>& AGENTS);
+    BasicTrajectoryWriter(const std::string& PATH, const BasicAgentStore<T>& AGENTS);
+    
+    // Destructor
+    ~BasicTrajectoryWriter(void);
+    
+    // Getters
+    inline size_t agentCount(void) const;
+    inline size_t frameCount(void) const;
+    
+    // Other methods
+    void write(const double TIME, const T* X, const T* Y);
+    void write(const double TIME, const BasicAgentStore<T>& AGENTS);
+    void close(void);
+    
+    static std::vector<TrajectoryAgent> describe(const BasicAgentStore<T>& AGENTS);
+    
+};
+
+// Precisions
+typedef BasicTrajectoryWriter<float> TrajectoryWriterF;
+typedef BasicTrajectoryWriter<double> TrajectoryWriter;
+
+/*
+    Getters
+*/
+
+/**
+ * Returns the number of agents in each frame.
+ */
+template <typename T>
+inline size_t BasicTrajectoryWriter<T>::agentCount(void) const {
+    return this->header_.agentCount;
+}
+
+/**
+ * Returns the number of frames written so far.
+ */
+template <typename T>
+inline size_t BasicTrajectoryWriter<T>::frameCount(void) const {
+    return this->index_.size();
+}
+
+#endif // _TRAJECTORY_WRITER_H_
@@ -0,0 +1,67 @@
+/**
+ * File  : allocationCounter.cpp
+ * Author: Raja Soufi
+ * 
+ * Implementation of the AllocationCounter class
+ * defined in allocationCounter.h, along with the
+ * replacement of the global operator new that
+ * feeds it when COUNT_ALLOCATIONS is defined.
+ */
+
+// Include header file
+#include "allocationCounter.h"
+
+#ifdef COUNT_ALLOCATIONS
+    #include <cstdlib>
+    #include <new>
+#endif
+
+/*
+    Attributes
+*/
+
+std::atomic<unsigned long long> AllocationCounter::count_(0);
+
+#ifdef COUNT_ALLOCATIONS
+
+/*
+    Global operators
+*/
+
+/**
+ * Allocates SIZE bytes on the heap and counts the
+ * allocation. The array and non-throwing versions
+ * of operator new, as well as all versions of
+ * operator delete, go through these two.
+ * 
+ * @param SIZE - The number of bytes to allocate
+ */
+void* operator new(std::size_t SIZE) {
+    AllocationCounter::increment();
+    void* memory = std::malloc((SIZE > 0) ? SIZE : 1);
+    if (memory == NULL) {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+/**
+ * Frees memory allocated by operator new.
+ * 
+ * @param memory - The memory to free
+ */
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+/**
+ * Frees memory of a known size allocated by
+ * operator new.
+ * 
+ * @param memory - The memory to free
+ */
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+#endif // COUNT_ALLOCATIONS
@@ -0,0 +1,84 @@
+/**
+ * File  : allocationCounter.h
+ * Author: Raja Soufi
+ * 
+ * Class definition of a counter of the heap
+ * allocations made by the program, used to check
+ * that the iterations of a simulation do not
+ * allocate any memory once they have warmed up.
+ * 
+ * The counter only counts when the program is
+ * built with COUNT_ALLOCATIONS defined, in which
+ * case the global operator new is replaced by one
+ * that counts its calls. Otherwise it stays at 0
+ * and costs nothing. The header of
+ * tests/simulationTests.cpp tells how to build the
+ * tests which use it.
+ */
+
+// Include guard
+#ifndef _ALLOCATION_COUNTER_H_
+#define _ALLOCATION_COUNTER_H_
+
+// Inclusions
+#include <atomic>
+
+// Class definition
+class AllocationCounter {
+    
+    private:
+    
+    // Attributes
+    static std::atomic<unsigned long long> count_;
+    
+    // Constructor
+    AllocationCounter(void);
+    
+    public:
+    
+    // Getters
+    static inline bool enabled(void);
+    static inline unsigned long long count(void);
+    
+    // Other methods
+    static inline void increment(void);
+    
+};
+
+/*
+    Getters
+*/
+
+/**
+ * Tests whether allocations are being counted,
+ * which is the case when the program is built with
+ * COUNT_ALLOCATIONS defined.
+ */
+inline bool AllocationCounter::enabled(void) {
+    #ifdef COUNT_ALLOCATIONS
+    return true;
+    #else
+    return false;
+    #endif
+}
+
+/**
+ * Returns the number of heap allocations made by
+ * the program so far, on all threads.
+ */
+inline unsigned long long AllocationCounter::count(void) {
+    return AllocationCounter::count_.load(std::memory_order_relaxed);
+}
+
+/*
+    Other methods
+*/
+
+/**
+ * Counts one more heap allocation.
+ */
+inline void AllocationCounter::increment(void) {
+    AllocationCounter::count_.fetch_add(1, std::memory_order_relaxed);
+}
+
+#endif // _ALLOCATION_COUNTER_H_
@@ -1,46 +1,84 @@
-/**
- * File  : exceptions.cpp
- * Author: Raja Soufi
- * 
- * Implementations of the what functions for the
- * different exceptions defined in exceptions.h.
- */
-
-// Include header file
-#include "exceptions.h"
-
-/*
-    Line exceptions
-*/
-
-/**
- * Returns the description of the exception thrown.
- */
-const char* LinesParallelException::what(void) const throw() {
-    return "The two given lines do not have a unique intersection point.";
-}
-
-/**
- * Returns the description of the exception thrown.
- */
-const char* LineVerticalException::what(void) const throw() {
-    return "The given line does not contain a unique point with the given x coordinate.";
-}
-
-/**
- * Returns the description of the exception thrown.
- */
-const char* LineHorizontalException::what(void) const throw() {
-    return "The given line does not contain a unique point with the given y coordinate.";
-}
-
-/*
-    ORCA exceptions
-*/
-
-/**
- * Returns the description of the exception thrown.
- */
-const char* LinearProgramInfeasibleException::what() const throw() {
-    return "The linear program was found to be infeasible during an iteration of ORCA.";
-}
+/**
+ * File  : exceptions.cpp
+ * Author: Raja Soufi
+ * 
+ * Implementations of the what functions for the
+ * different exceptions defined in exceptions.h.
+ */
+
+// Include header file
+#include "exceptions.h"
+
+/*
+    Line exceptions
+*/
+
+/**
+ * Returns the description of the exception thrown.
+ */
+const char* LinesParallelException::what(void) const throw() {
+    return "The two given lines do not have a unique intersection point.";
+}
+
+/**
+ * Returns the description of the exception thrown.
+ */
+const char* LineVerticalException::what(void) const throw() {
+    return "The given line does not contain a unique point with the given x coordinate.";
+}
+
+/**
+ * Returns the description of the exception thrown.
+ */
+const char* LineHorizontalException::what(void) const throw() {
+    return "The given line does not contain a unique point with the given y coordinate.";
+}
+
+/*
+    ORCA exceptions
+*/
+
+/**
+ * Returns the description of the exception thrown.
+ */
+const char* LinearProgramInfeasibleException::what() const throw() {
+    return "The linear program was found to be infeasible during an iteration of ORCA.";
+}
+
+/*
+    Scenario exceptions
+*/
+
+/**
+ * Constructs an exception with the description
+ * given as a parameter.
+ * 
+ * @param MESSAGE - What is wrong with the scenario
+ */
+ScenarioFormatException::ScenarioFormatException(const std::string& MESSAGE) : message_(MESSAGE) {}
+
+/**
+ * Returns the description of the exception thrown.
+ */
+const char* ScenarioFormatException::what(void) const throw() {
+    return this->message_.c_str();
+}
+
+/*
+    Trajectory exceptions
+*/
+
+/**
+ * Constructs an exception with the description
+ * given as a parameter.
+ * 
+ * @param MESSAGE - What is wrong with the file
+ */
+TrajectoryFileException::TrajectoryFileException(const std::string& MESSAGE) : message_(MESSAGE) {}
+
+/**
+ * Returns the description of the exception thrown.
+ */
+const char* TrajectoryFileException::what(void) const throw() {
+    return this->message_.c_str();
+}
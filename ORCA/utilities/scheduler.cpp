@@ -0,0 +1,142 @@
+/**
+ * File  : scheduler.cpp
+ * Author: Raja Soufi
+ * 
+ * Implementation of the Scheduler class defined
+ * in scheduler.h.
+ */
+
+// Include header file
+#include "scheduler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+/*
+    Constructor
+*/
+
+/**
+ * Constructs a throttled scheduler running steps of
+ * DELTA_T at the pace of the real time, in frames
+ * at least FRAME_PERIOD apart and of at most
+ * MAX_STEPS steps each.
+ * 
+ * @param DELTA_T      - The simulated duration of a step,
+ *                       in seconds
+ * @param FRAME_PERIOD - The shortest real time between two
+ *                       frames, in seconds
+ * @param MAX_STEPS    - The largest number of steps of a
+ *                       frame, at least 1
+ */
+Scheduler::Scheduler(const double DELTA_T, const double FRAME_PERIOD, const size_t MAX_STEPS) :
+    deltaT_(DELTA_T),
+    framePeriod_(FRAME_PERIOD),
+    maxSteps_(std::max(MAX_STEPS, static_cast<size_t>(1))),
+    speed_(1.0),
+    throttled_(true),
+    last_(Clock::now()),
+    accumulator_(0.0),
+    behind_(false),
+    frames_(0),
+    steps_(0),
+    lateFrames_(0),
+    droppedSteps_(0)
+{}
+
+/*
+    Setters
+*/
+
+/**
+ * Sets the factor by which the simulated time runs
+ * faster than the real time.
+ * 
+ * @param SPEED - The new speed factor, greater than 0
+ */
+void Scheduler::setSpeed(const double SPEED) {
+    this->speed_ = SPEED;
+}
+
+/**
+ * Sets whether this scheduler keeps the simulated
+ * time at the pace of the real time. Throttling
+ * again starts from the current time, without any
+ * step due.
+ * 
+ * @param THROTTLED - Whether to throttle the simulation
+ */
+void Scheduler::setThrottled(const bool THROTTLED) {
+    if (THROTTLED && !this->throttled_) {
+        this->reset();
+    }
+    this->throttled_ = THROTTLED;
+}
+
+/*
+    Other methods
+*/
+
+/**
+ * Forgets the real time elapsed since the last
+ * frame, as after a pause, so that the next frame
+ * does not try to catch up with it.
+ */
+void Scheduler::reset(void) {
+    this->last_ = Clock::now();
+    this->accumulator_ = 0.0;
+    this->behind_ = false;
+}
+
+/**
+ * Waits until the next frame is due, and returns
+ * the number of steps of deltaT it must run, which
+ * is at least 1 unless the clock went backwards.
+ * A throttled scheduler sleeps until a frame period
+ * has passed since the last frame and a step is due;
+ * an unthrottled one returns the largest number of
+ * steps right away.
+ */
+size_t Scheduler::nextFrame(void) {
+    
+    this->frames_++;
+    
+    if (!this->throttled_) {
+        this->last_ = Clock::now();
+        this->steps_ += this->maxSteps_;
+        return this->maxSteps_;
+    }
+    
+    // Sleep until the frame is due and a step is owed
+    Clock::time_point now = Clock::now();
+    double elapsed = std::chrono::duration<double>(now - this->last_).count();
+    double wait = std::max(this->framePeriod_ - elapsed,
+        (this->deltaT_ - this->accumulator_) / this->speed_ - elapsed);
+        
+    if (wait > 0.0) {
+        std::this_thread::sleep_for(std::chrono::duration<double>(wait));
+        now = Clock::now();
+        elapsed = std::chrono::duration<double>(now - this->last_).count();
+    }
+    
+    this->last_ = now;
+    this->accumulator_ += elapsed * this->speed_;
+    
+    size_t steps = static_cast<size_t>(std::floor(this->accumulator_ / this->deltaT_));
+    this->accumulator_ -= steps * this->deltaT_;
+    
+    // Drop the steps that do not fit in the frame rather
+    // than pile them up for the next ones
+    this->behind_ = (steps > this->maxSteps_);
+    if (this->behind_) {
+        this->lateFrames_++;
+        this->droppedSteps_ += steps - this->maxSteps_;
+        steps = this->maxSteps_;
+    }
+    
+    this->steps_ += steps;
+    
+    return steps;
+    
+}
@@ -0,0 +1,149 @@
+/**
+ * File  : scheduler.h
+ * Author: Raja Soufi
+ * 
+ * Class definition of a fixed timestep scheduler,
+ * which tells a simulation loop how many steps of
+ * deltaT to run at each frame so that the simulated
+ * time keeps pace with the real time, whatever the
+ * time the steps take to compute.
+ * 
+ * The real time elapsed between frames, scaled by
+ * the speed factor, is added to an accumulator, from
+ * which each step run takes deltaT away. A frame
+ * runs at most a given number of sub-steps; if more
+ * are due, the simulation has fallen behind the real
+ * time, and the steps in excess are dropped rather
+ * than owed to the next frames.
+ * 
+ * An unthrottled scheduler never sleeps and always
+ * asks for the largest number of sub-steps, so that
+ * the simulation runs as fast as it can.
+ */
+
+// Include guard
+#ifndef _SCHEDULER_H_
+#define _SCHEDULER_H_
+
+// Inclusions
+#include <chrono>
+#include <cstddef>
+
+// Class definition
+class Scheduler {
+    
+    private:
+    
+    // The clock measuring the real time
+    typedef std::chrono::steady_clock Clock;
+    
+    // Attributes
+    double deltaT_;
+    double framePeriod_;
+    size_t maxSteps_;
+    double speed_;
+    bool throttled_;
+    
+    Clock::time_point last_;
+    double accumulator_;
+    bool behind_;
+    size_t frames_;
+    size_t steps_;
+    size_t lateFrames_;
+    size_t droppedSteps_;
+    
+    public:
+    
+    // Constructor
+    Scheduler(const double DELTA_T, const double FRAME_PERIOD, const size_t MAX_STEPS);
+    
+    // Getters
+    inline double deltaT(void) const;
+    inline double speed(void) const;
+    inline bool throttled(void) const;
+    inline bool behind(void) const;
+    inline size_t frames(void) const;
+    inline size_t steps(void) const;
+    inline size_t lateFrames(void) const;
+    inline size_t droppedSteps(void) const;
+    
+    // Setters
+    void setSpeed(const double SPEED);
+    void setThrottled(const bool THROTTLED);
+    
+    // Other methods
+    void reset(void);
+    size_t nextFrame(void);
+    
+};
+
+/*
+    Getters
+*/
+
+/**
+ * Returns the simulated duration of a step, in
+ * seconds.
+ */
+inline double Scheduler::deltaT(void) const {
+    return this->deltaT_;
+}
+
+/**
+ * Returns the factor by which the simulated time
+ * runs faster than the real time.
+ */
+inline double Scheduler::speed(void) const {
+    return this->speed_;
+}
+
+/**
+ * Tests whether this scheduler keeps the simulated
+ * time at the pace of the real time, rather than
+ * running as fast as it can.
+ */
+inline bool Scheduler::throttled(void) const {
+    return this->throttled_;
+}
+
+/**
+ * Tests whether the last frame had more steps due
+ * than it could run, that is whether the simulation
+ * is falling behind the real time.
+ */
+inline bool Scheduler::behind(void) const {
+    return this->behind_;
+}
+
+/**
+ * Returns the number of frames scheduled so far.
+ */
+inline size_t Scheduler::frames(void) const {
+    return this->frames_;
+}
+
+/**
+ * Returns the number of steps scheduled so far.
+ */
+inline size_t Scheduler::steps(void) const {
+    return this->steps_;
+}
+
+/**
+ * Returns the number of frames so far that fell
+ * behind the real time.
+ */
+inline size_t Scheduler::lateFrames(void) const {
+    return this->lateFrames_;
+}
+
+/**
+ * Returns the number of steps so far that were due
+ * but dropped, because they would not fit in their
+ * frame.
+ */
+inline size_t Scheduler::droppedSteps(void) const {
+    return this->droppedSteps_;
+}
+
+#endif // _SCHEDULER_H_
@@ -0,0 +1,273 @@
+/**
+ * File  : threadPool.cpp
+ * Author: Raja Soufi
+ * 
+ * Implementation of the ThreadPool class defined
+ * in threadPool.h.
+ */
+
+// Include header file
+#include "threadPool.h"
+
+#include <algorithm>
+
+/*
+    Constructors
+*/
+
+/**
+ * Constructs a pool running its loops on the number
+ * of threads given as a parameter, the calling
+ * thread included. The workers are started right
+ * away and sleep between loops.
+ * 
+ * @param THREAD_COUNT - The number of threads of the
+ *                       new pool, at least 1
+ */
+ThreadPool::ThreadPool(const size_t THREAD_COUNT) :
+    threadCount_(std::max(THREAD_COUNT, static_cast<size_t>(1))),
+    shares_(new Share[threadCount_]),
+    workers_(),
+    mutex_(),
+    start_(),
+    finish_(),
+    generation_(0),
+    running_(0),
+    stopping_(false),
+    invoker_(NULL),
+    body_(NULL),
+    grain_(1),
+    error_()
+{
+    for (size_t i = 0 ; i < this->threadCount_ ; i++) {
+        this->shares_[i].begin = 0;
+        this->shares_[i].end = 0;
+    }
+    
+    this->workers_.reserve(this->threadCount_ - 1);
+    for (size_t i = 1 ; i < this->threadCount_ ; i++) {
+        this->workers_.push_back(std::thread(&ThreadPool::workerLoop, this, i));
+    }
+}
+
+/*
+    Destructor
+*/
+
+/**
+ * Stops and joins the workers of this pool.
+ */
+ThreadPool::~ThreadPool(void) {
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        this->stopping_ = true;
+    }
+    this->start_.notify_all();
+    
+    for (std::thread& worker : this->workers_) {
+        worker.join();
+    }
+}
+
+/*
+    Helpers
+*/
+
+/**
+ * Runs a loop over [0, COUNT) on all the threads of
+ * this pool and waits for its completion.
+ * 
+ * @param invoker - The function calling the body
+ * @param body    - The body of the loop
+ * @param COUNT   - The number of indices to process
+ */
+void ThreadPool::run(Invoker invoker, void* body, const size_t COUNT) {
+    
+    if (COUNT == 0) {
+        return;
+    }
+    
+    // Without workers, simply run the whole loop here
+    if (this->threadCount_ == 1) {
+        invoker(body, 0, COUNT, 0);
+        return;
+    }
+    
+    // Split the loop evenly, with grains small enough for
+    // stealing to even out differences in cost
+    for (size_t i = 0 ; i < this->threadCount_ ; i++) {
+        std::lock_guard<std::mutex> lock(this->shares_[i].mutex);
+        this->shares_[i].begin = COUNT * i / this->threadCount_;
+        this->shares_[i].end = COUNT * (i + 1) / this->threadCount_;
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        this->invoker_ = invoker;
+        this->body_ = body;
+        this->grain_ = std::max(COUNT / (16 * this->threadCount_), static_cast<size_t>(1));
+        this->error_ = std::exception_ptr();
+        this->running_ = this->threadCount_ - 1;
+        this->generation_++;
+    }
+    this->start_.notify_all();
+    
+    this->work(0);
+    
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(this->mutex_);
+        this->finish_.wait(lock, [this] { return this->running_ == 0; });
+        std::swap(error, this->error_);
+    }
+    
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    
+}
+
+/**
+ * Processes grains of the current loop, first from
+ * the share of the thread given as a parameter, then
+ * from the shares of other threads, until none is
+ * left.
+ * 
+ * @param SELF - The index of the calling thread
+ */
+void ThreadPool::work(const size_t SELF) {
+    
+    size_t begin, end;
+    
+    do {
+        while (this->take(SELF, begin, end)) {
+            try {
+                this->invoker_(this->body_, begin, end, SELF);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(this->mutex_);
+                if (!this->error_) {
+                    this->error_ = std::current_exception();
+                }
+            }
+        }
+    } while (this->steal(SELF));
+    
+}
+
+/**
+ * Takes the next grain from the front of the share
+ * of the thread given as a parameter. Returns false
+ * if that share is empty.
+ * 
+ * @param SELF  - The index of the calling thread
+ * @param begin - Set to the first index of the grain
+ * @param end   - Set to one past the last index of
+ *                the grain
+ */
+bool ThreadPool::take(const size_t SELF, size_t& begin, size_t& end) {
+    
+    Share& share = this->shares_[SELF];
+    std::lock_guard<std::mutex> lock(share.mutex);
+    
+    if (share.begin >= share.end) {
+        return false;
+    }
+    
+    begin = share.begin;
+    end = std::min(begin + this->grain_, static_cast<size_t>(share.end));
+    share.begin = end;
+    
+    return true;
+    
+}
+
+/**
+ * Moves the back half of the largest share of the
+ * other threads into the share of the thread given
+ * as a parameter. Returns false if all shares are
+ * empty.
+ * 
+ * @param SELF - The index of the calling thread
+ */
+bool ThreadPool::steal(const size_t SELF) {
+    
+    while (true) {
+        
+        // Look for the largest share left
+        size_t victim = SELF;
+        size_t largest = 0;
+        for (size_t i = 1 ; i < this->threadCount_ ; i++) {
+            size_t other = (SELF + i) % this->threadCount_;
+            size_t begin = this->shares_[other].begin;
+            size_t end = this->shares_[other].end;
+            if ((end > begin) && (end - begin > largest)) {
+                victim = other;
+                largest = end - begin;
+            }
+        }
+        
+        if (victim == SELF) {
+            return false;
+        }
+        
+        size_t begin, end;
+        {
+            Share& share = this->shares_[victim];
+            std::lock_guard<std::mutex> lock(share.mutex);
+            // The victim may have eaten its share in the meantime
+            if (share.begin >= share.end) {
+                continue;
+            }
+            end = share.end;
+            begin = share.begin + (share.end - share.begin) / 2;
+            share.end = begin;
+        }
+        
+        {
+            Share& share = this->shares_[SELF];
+            std::lock_guard<std::mutex> lock(share.mutex);
+            share.begin = begin;
+            share.end = end;
+        }
+        
+        return true;
+        
+    }
+    
+}
+
+/**
+ * Runs the loop of a worker, waiting for new loops
+ * to process until the pool is destroyed.
+ * 
+ * @param SELF - The index of the worker
+ */
+void ThreadPool::workerLoop(const size_t SELF) {
+    
+    unsigned long long generation = 0;
+    
+    while (true) {
+        
+        {
+            std::unique_lock<std::mutex> lock(this->mutex_);
+            this->start_.wait(lock, [this, generation] {
+                return this->stopping_ || (this->generation_ != generation);
+            });
+            if (this->stopping_) {
+                return;
+            }
+            generation = this->generation_;
+        }
+        
+        this->work(SELF);
+        
+        {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+            if (--this->running_ == 0) {
+                this->finish_.notify_one();
+            }
+        }
+        
+    }
+    
+}
@@ -0,0 +1,143 @@
+/**
+ * File  : threadPool.h
+ * Author: Raja Soufi
+ * 
+ * Class definition of a persistent pool of worker
+ * threads running parallel loops over index ranges.
+ * 
+ * The range of a loop is split evenly between the
+ * calling thread and the workers. Each of them eats
+ * its own share from the front, a grain at a time,
+ * and once it runs dry it steals the back half of
+ * the largest share left, so that threads finishing
+ * early help with the costlier parts of the loop.
+ */
+
+// Include guard
+#ifndef _THREAD_POOL_H_
+#define _THREAD_POOL_H_
+
+// Inclusions
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Class definition
+class ThreadPool {
+    
+    private:
+    
+    // Share of the current loop owned by a thread
+    struct Share {
+        std::mutex mutex;
+        std::atomic<size_t> begin, end;
+    };
+    
+    // Type-erased body of the current loop
+    typedef void (*Invoker)(void* body, size_t begin, size_t end, size_t thread);
+    
+    // Attributes
+    size_t threadCount_;
+    std::unique_ptr<Share[]> shares_;
+    std::vector<std::thread> workers_;
+    
+    std::mutex mutex_;
+    std::condition_variable start_, finish_;
+    unsigned long long generation_;
+    size_t running_;
+    bool stopping_;
+    
+    Invoker invoker_;
+    void* body_;
+    size_t grain_;
+    std::exception_ptr error_;
+    
+    // Helpers
+    template <typename Body>
+    static void invoke(void* body, size_t begin, size_t end, size_t thread);
+    
+    void run(Invoker invoker, void* body, const size_t COUNT);
+    void work(const size_t SELF);
+    bool take(const size_t SELF, size_t& begin, size_t& end);
+    bool steal(const size_t SELF);
+    void workerLoop(const size_t SELF);
+    
+    // Non-copyable
+    ThreadPool(const ThreadPool& THAT);
+    ThreadPool& operator=(const ThreadPool& THAT);
+    
+    public:
+    
+    // Constructor
+    explicit ThreadPool(const size_t THREAD_COUNT);
+    
+    // Destructor
+    ~ThreadPool(void);
+    
+    // Getters
+    inline size_t threadCount(void) const;
+    
+    // Other methods
+    template <typename Body>
+    void parallelFor(const size_t COUNT, Body& body);
+    
+};
+
+/*
+    Getters
+*/
+
+/**
+ * Returns the number of threads running the loops
+ * of this pool, including the calling thread.
+ */
+inline size_t ThreadPool::threadCount(void) const {
+    return this->threadCount_;
+}
+
+/*
+    Other methods
+*/
+
+/**
+ * Calls body(begin, end, thread) on disjoint
+ * sub-ranges covering [0, COUNT), in parallel on
+ * the threads of this pool, and returns once they
+ * have all been processed. The calling thread takes
+ * part in the loop as thread 0, the workers being
+ * numbered from 1, so that the body can pick the
+ * memory it works in by thread. If the body throws, the first exception
+ * is rethrown to the caller once the loop is over.
+ * 
+ * @param COUNT - The number of indices to process
+ * @param body  - The callable processing a range
+ */
+template <typename Body>
+void ThreadPool::parallelFor(const size_t COUNT, Body& body) {
+    this->run(&ThreadPool::invoke<Body>, &body, COUNT);
+}
+
+/*
+    Helpers
+*/
+
+/**
+ * Calls the body of a loop, given as an untyped
+ * pointer, on the range given as parameters.
+ * 
+ * @param body   - The callable processing a range
+ * @param begin  - The first index of the range
+ * @param end    - One past the last index of the range
+ * @param thread - The index of the calling thread
+ */
+template <typename Body>
+void ThreadPool::invoke(void* body, size_t begin, size_t end, size_t thread) {
+    (*static_cast<Body*>(body))(begin, end, thread);
+}
+
+#endif // _THREAD_POOL_H_
@@ -0,0 +1,134 @@
+/**
+ * File  : tripleBuffer.h
+ * Author: Raja Soufi
+ * 
+ * Class definition of a lock-free triple buffer,
+ * through which a single writer thread hands the
+ * latest version of a value over to a single reader
+ * thread.
+ * 
+ * The writer fills the back buffer and publishes it
+ * by swapping it with the middle one, while the
+ * reader takes the middle buffer over as its front
+ * buffer whenever a newer one was published. Neither
+ * thread ever waits for the other: the writer may
+ * publish faster than the reader reads, in which
+ * case the versions in between are skipped, and the
+ * front buffer stays untouched until the reader asks
+ * for the next one.
+ */
+
+// Include guard
+#ifndef _TRIPLE_BUFFER_H_
+#define _TRIPLE_BUFFER_H_
+
+// Inclusions
+#include <atomic>
+
+// Class definition
+template <typename T>
+class TripleBuffer {
+    
+    private:
+    
+    // Constants
+    static const unsigned FRESH = 4;
+    static const unsigned INDEX = 3;
+    
+    // Attributes
+    T buffers_[3];
+    unsigned back_;
+    std::atomic<unsigned> middle_;
+    unsigned front_;
+    
+    // Non-copyable
+    TripleBuffer(const TripleBuffer& THAT);
+    TripleBuffer& operator=(const TripleBuffer& THAT);
+    
+    public:
+    
+    // Constructor
+    TripleBuffer(void);
+    
+    // Getters
+    inline const T& front(void) const;
+    
+    // Other methods
+    inline T& back(void);
+    inline void publish(void);
+    inline bool update(void);
+    
+};
+
+/*
+    Constructor
+*/
+
+/**
+ * Constructs a triple buffer whose three buffers are
+ * default-constructed, with nothing published yet.
+ */
+template <typename T>
+TripleBuffer<T>::TripleBuffer(void) : buffers_(), back_(0), middle_(1), front_(2) {}
+
+/*
+    Getters
+*/
+
+/**
+ * Returns the front buffer, holding the version the
+ * reader took over by its last successful call to
+ * update. Must only be called by the reader.
+ */
+template <typename T>
+inline const T& TripleBuffer<T>::front(void) const {
+    return this->buffers_[this->front_];
+}
+
+/*
+    Other methods
+*/
+
+/**
+ * Returns the back buffer, in which the writer
+ * prepares the next version. It holds an older
+ * version, which may be overwritten in place to
+ * reuse its memory. Must only be called by the
+ * writer.
+ */
+template <typename T>
+inline T& TripleBuffer<T>::back(void) {
+    return this->buffers_[this->back_];
+}
+
+/**
+ * Publishes the back buffer as the latest version,
+ * and gives the writer the middle buffer as its new
+ * back buffer. Must only be called by the writer.
+ */
+template <typename T>
+inline void TripleBuffer<T>::publish(void) {
+    this->back_ = this->middle_.exchange(this->back_ | TripleBuffer::FRESH,
+        std::memory_order_acq_rel) & TripleBuffer::INDEX;
+}
+
+/**
+ * Takes the latest version over as the front buffer
+ * if one was published since the last call, and
+ * returns whether it did so. Must only be called by
+ * the reader.
+ */
+template <typename T>
+inline bool TripleBuffer<T>::update(void) {
+    
+    // Nothing new since the last call
+    if ((this->middle_.load(std::memory_order_relaxed) & TripleBuffer::FRESH) == 0) {
+        return false;
+    }
+    
+    this->front_ = this->middle_.exchange(this->front_, std::memory_order_acq_rel) & TripleBuffer::INDEX;
+    return true;
+    
+}
+
+#endif // _TRIPLE_BUFFER_H_